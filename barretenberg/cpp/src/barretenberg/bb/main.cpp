@@ -6,10 +6,12 @@
 #include "barretenberg/dsl/acir_format/acir_format.hpp"
 #include "barretenberg/dsl/acir_format/proof_surgeon.hpp"
 #include "barretenberg/dsl/acir_proofs/honk_contract.hpp"
+#include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/honk/proof_system/types/proof.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 #include "barretenberg/plonk/proof_system/proving_key/serialize.hpp"
 #include "barretenberg/plonk_honk_shared/types/aggregation_object_type.hpp"
+#include "barretenberg/relations/relation_profiler.hpp"
 #include "barretenberg/serialize/cbind.hpp"
 #include "barretenberg/stdlib/client_ivc_verifier/client_ivc_recursive_verifier.hpp"
 #include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
@@ -35,6 +37,7 @@
 #include <barretenberg/common/timer.hpp>
 #include <barretenberg/dsl/acir_format/acir_to_constraint_buf.hpp>
 #include <barretenberg/dsl/acir_proofs/acir_composer.hpp>
+#include <barretenberg/srs/factories/mapped_prover_crs.hpp>
 #include <barretenberg/srs/global_crs.hpp>
 #include <cstdint>
 #include <fstream>
@@ -56,6 +59,19 @@ std::string CRS_PATH = getHomeDir() + "/.bb-crs";
 const std::filesystem::path current_path = std::filesystem::current_path();
 const auto current_dir = current_path.filename().string();
 
+// TODO(https://github.com/AztecProtocol/barretenberg/issues/1097): tighter bound needed
+// currently using 1.6x points in CRS because of structured polys, see notes for how to minimize
+size_t get_bn254_crs_size(size_t dyadic_circuit_size)
+{
+    // Must +1 for Plonk only!
+    return dyadic_circuit_size + dyadic_circuit_size * 6 / 10 + 1;
+}
+
+size_t get_grumpkin_crs_size(size_t eccvm_dyadic_circuit_size)
+{
+    return eccvm_dyadic_circuit_size + eccvm_dyadic_circuit_size * 6 / 10;
+}
+
 /**
  * @brief Initialize the global crs_factory for bn254 based on a known dyadic circuit size
  *
@@ -63,11 +79,15 @@ const auto current_dir = current_path.filename().string();
  */
 void init_bn254_crs(size_t dyadic_circuit_size)
 {
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1097): tighter bound needed
-    // currently using 1.6x points in CRS because of structured polys, see notes for how to minimize
-    // Must +1 for Plonk only!
-    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, dyadic_circuit_size + dyadic_circuit_size * 6 / 10 + 1);
+    const size_t num_points = get_bn254_crs_size(dyadic_circuit_size);
     auto bn254_g2_data = get_bn254_g2_data(CRS_PATH);
+    // Map the precomputed point table written by write_point_table, if it is large enough
+    if (auto prover_crs = srs::factories::MappedProverCrs<curve::BN254>::map(
+            CRS_PATH + "/" + srs::factories::get_point_table_filename<curve::BN254>(), num_points)) {
+        srs::init_crs_factory_from_prover_crs(prover_crs, bn254_g2_data);
+        return;
+    }
+    auto bn254_g1_data = get_bn254_g1_data(CRS_PATH, num_points);
     srs::init_crs_factory(bn254_g1_data, bn254_g2_data);
 }
 
@@ -79,13 +99,49 @@ void init_bn254_crs(size_t dyadic_circuit_size)
  */
 void init_grumpkin_crs(size_t eccvm_dyadic_circuit_size)
 {
-    // TODO(https://github.com/AztecProtocol/barretenberg/issues/1097): tighter bound needed
-    // currently using 1.6x points in CRS because of structured polys, see notes for how to minimize
-    auto grumpkin_g1_data =
-        get_grumpkin_g1_data(CRS_PATH, eccvm_dyadic_circuit_size + eccvm_dyadic_circuit_size * 6 / 10);
+    const size_t num_points = get_grumpkin_crs_size(eccvm_dyadic_circuit_size);
+    // Map the precomputed point table written by write_point_table, if it is large enough
+    if (auto prover_crs = srs::factories::MappedProverCrs<curve::Grumpkin>::map(
+            CRS_PATH + "/" + srs::factories::get_point_table_filename<curve::Grumpkin>(), num_points)) {
+        srs::init_grumpkin_crs_factory_from_prover_crs(prover_crs);
+        return;
+    }
+    auto grumpkin_g1_data = get_grumpkin_g1_data(CRS_PATH, num_points);
     srs::init_grumpkin_crs_factory(grumpkin_g1_data);
 }
 
+/**
+ * @brief Write the pippenger point table of a set of SRS points to a file, for init_bn254_crs or init_grumpkin_crs to
+ * map instead of computing the point table
+ */
+template <typename Curve>
+void write_point_table_file(std::vector<typename Curve::AffineElement> const& points, std::string const& path)
+{
+    const size_t num_points = points.size();
+    auto point_table = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+    std::copy(points.begin(), points.end(), point_table.get());
+    scalar_multiplication::generate_pippenger_point_table<Curve>(point_table.get(), point_table.get(), num_points);
+    srs::factories::write_point_table<Curve>(path, { point_table.get(), num_points * 2 });
+    vinfo("point table of ", Curve::name, " CRS of size ", num_points, " written to: ", path);
+}
+
+/**
+ * @brief Write the point tables of the bn254 and grumpkin CRS, sized for the given circuit sizes, to the CRS directory
+ * @details Every later bb process that needs at most as many points maps the tables read-only, rather than reading
+ * the CRS and computing the endomorphism points. The mapped pages are shared between concurrent processes.
+ *
+ * @param dyadic_circuit_size power-of-2 circuit size
+ * @param eccvm_dyadic_circuit_size power-of-2 ECCVM circuit size
+ */
+void write_point_table(size_t dyadic_circuit_size, size_t eccvm_dyadic_circuit_size)
+{
+    write_point_table_file<curve::BN254>(get_bn254_g1_data(CRS_PATH, get_bn254_crs_size(dyadic_circuit_size)),
+                                         CRS_PATH + "/" + srs::factories::get_point_table_filename<curve::BN254>());
+    write_point_table_file<curve::Grumpkin>(
+        get_grumpkin_g1_data(CRS_PATH, get_grumpkin_crs_size(eccvm_dyadic_circuit_size)),
+        CRS_PATH + "/" + srs::factories::get_point_table_filename<curve::Grumpkin>());
+}
+
 // Initializes without loading G1
 // TODO(https://github.com/AztecProtocol/barretenberg/issues/811) adapt for grumpkin
 acir_proofs::AcirComposer verifier_init()
@@ -1409,6 +1465,38 @@ void prove_honk_output_all(const std::string& bytecodePath,
     vinfo("vk as fields written to: ", vkFieldsOutputPath);
 }
 
+/**
+ * @brief Writes the relation profile collected while running a command when it goes out of scope, so that it is written
+ * however the command returns. The profile is only collected by builds with -DBB_PROFILE_RELATIONS (the
+ * relation-profile preset), see RelationProfiler.
+ */
+// NOLINTNEXTLINE(cppcoreguidelines-special-member-functions)
+struct RelationProfileWriter {
+    std::string output_path;
+
+    ~RelationProfileWriter()
+    {
+        if (output_path.empty()) {
+            return;
+        }
+        if (!RelationProfiler::ENABLED) {
+            info("relation profiling is not enabled in this build, see the relation-profile preset");
+            return;
+        }
+        const std::string json = RelationProfiler::to_json();
+        if (output_path == "-") {
+            writeStringToStdout(json);
+            return;
+        }
+        try {
+            write_file(output_path, { json.begin(), json.end() });
+            vinfo("relation profile written to: ", output_path);
+        } catch (std::runtime_error const& err) {
+            std::cerr << err.what() << std::endl;
+        }
+    }
+};
+
 bool flag_present(std::vector<std::string>& args, const std::string& flag)
 {
     return std::find(args.begin(), args.end(), flag) != args.end();
@@ -1440,12 +1528,20 @@ int main(int argc, char* argv[])
         std::string pk_path = get_option(args, "-r", "./target/pk");
         bool honk_recursion = flag_present(args, "-h");
         CRS_PATH = get_option(args, "-c", CRS_PATH);
+        RelationProfileWriter relation_profile_writer{ get_option(args, "--relation-profile", "") };
 
         // Skip CRS initialization for any command which doesn't require the CRS.
         if (command == "--version") {
             writeStringToStdout(BB_VERSION);
             return 0;
         }
+        if (command == "write_point_table") {
+            const size_t circuit_size = std::stoul(get_option(args, "--circuit-size", std::to_string(1 << 22)));
+            const size_t eccvm_circuit_size =
+                std::stoul(get_option(args, "--eccvm-circuit-size", std::to_string(1 << 16)));
+            write_point_table(circuit_size, eccvm_circuit_size);
+            return 0;
+        }
         if (command == "prove_and_verify") {
             return proveAndVerify(bytecode_path, witness_path) ? 0 : 1;
         }
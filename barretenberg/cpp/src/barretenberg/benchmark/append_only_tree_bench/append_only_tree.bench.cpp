@@ -10,9 +10,13 @@
 #include "barretenberg/crypto/merkle_tree/response.hpp"
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/numeric/random/engine.hpp"
+#include <algorithm>
 #include <benchmark/benchmark.h>
+#include <chrono>
 #include <cstdint>
 #include <filesystem>
+#include <mutex>
+#include <vector>
 
 using namespace benchmark;
 using namespace bb::crypto::merkle_tree;
@@ -82,6 +86,116 @@ BENCHMARK(append_only_tree_bench<Poseidon2>)
     ->Range(2, MAX_BATCH_SIZE)
     ->Iterations(1000);
 
+// Measures committing batches of leaves, reporting the average time spent in each phase of the commit
+template <typename TreeType> void commit_tree_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    uint32_t num_threads = 16;
+    LMDBEnvironment environment = LMDBEnvironment(directory, 1024 * 1024, 2, num_threads);
+
+    LMDBStore db(environment, name, false, false, integer_key_cmp);
+    StoreType store(name, depth, db);
+    ThreadPool workers(num_threads);
+    TreeType tree = TreeType(store, workers);
+
+    CommitStats totals;
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<fr> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        perform_batch_insert(tree, values);
+        state.ResumeTiming();
+        commit_tree(tree);
+
+        CommitStats stats = store.get_last_commit_stats();
+        totals.readTimeNs += stats.readTimeNs;
+        totals.serialiseTimeNs += stats.serialiseTimeNs;
+        totals.writeTimeNs += stats.writeTimeNs;
+        totals.commitTimeNs += stats.commitTimeNs;
+        totals.numWrites += stats.numWrites;
+    }
+    state.counters["read_us"] = Counter(double(totals.readTimeNs) / 1000, Counter::kAvgIterations);
+    state.counters["serialise_us"] = Counter(double(totals.serialiseTimeNs) / 1000, Counter::kAvgIterations);
+    state.counters["write_us"] = Counter(double(totals.writeTimeNs) / 1000, Counter::kAvgIterations);
+    state.counters["commit_us"] = Counter(double(totals.commitTimeNs) / 1000, Counter::kAvgIterations);
+    state.counters["writes"] = Counter(double(totals.numWrites), Counter::kAvgIterations);
+
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(commit_tree_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(64, 4096)
+    ->Iterations(20);
+
+// Measures concurrent sibling path queries against the committed state, reporting the p99 latency and the hit rate of
+// the committed node cache
+template <typename TreeType> void committed_sibling_path_bench(State& state) noexcept
+{
+    const size_t num_queries = size_t(state.range(0));
+    const size_t depth = TREE_DEPTH;
+    const size_t num_leaves = 4096;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    uint32_t num_threads = 16;
+    LMDBEnvironment environment = LMDBEnvironment(directory, 1024 * 1024, 2, num_threads);
+
+    LMDBStore db(environment, name, false, false, integer_key_cmp);
+    StoreType store(name, depth, db);
+    ThreadPool workers(num_threads);
+    TreeType tree = TreeType(store, workers);
+
+    std::vector<fr> values(num_leaves);
+    for (size_t i = 0; i < num_leaves; ++i) {
+        values[i] = fr(random_engine.get_random_uint256());
+    }
+    perform_batch_insert(tree, values);
+    commit_tree(tree);
+
+    std::vector<int64_t> latencies;
+    std::mutex latencyMutex;
+    NodeCacheStats initialStats = store.get_node_cache_stats();
+    for (auto _ : state) {
+        Signal signal(uint32_t(num_queries));
+        for (size_t i = 0; i < num_queries; ++i) {
+            auto start = std::chrono::steady_clock::now();
+            auto completion = [&, start](const TypedResponse<GetSiblingPathResponse>&) -> void {
+                auto elapsed = std::chrono::steady_clock::now() - start;
+                {
+                    std::lock_guard<std::mutex> lock(latencyMutex);
+                    latencies.push_back(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+                }
+                signal.signal_decrement();
+            };
+            tree.get_sibling_path(random_engine.get_random_uint64() % num_leaves, completion, false);
+        }
+        signal.wait_for_level(0);
+    }
+
+    NodeCacheStats stats = store.get_node_cache_stats();
+    uint64_t hits = stats.hits - initialStats.hits;
+    uint64_t misses = stats.misses - initialStats.misses;
+    std::sort(latencies.begin(), latencies.end());
+    state.counters["p99_us"] = double(latencies[latencies.size() * 99 / 100]) / 1000;
+    state.counters["cache_hit_rate"] = double(hits) / double(std::max<uint64_t>(hits + misses, 1));
+
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(committed_sibling_path_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->RangeMultiplier(4)
+    ->Range(16, 1024)
+    ->Iterations(50);
+
 } // namespace
 
 BENCHMARK_MAIN();
\ No newline at end of file
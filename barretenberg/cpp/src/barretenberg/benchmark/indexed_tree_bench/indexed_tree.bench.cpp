@@ -83,6 +83,36 @@ template <typename TreeType> void single_thread_indexed_tree_bench(State& state)
         add_values(tree, values);
     }
 }
+template <typename TreeType> void thread_scaling_indexed_tree_bench(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    const uint32_t num_threads = uint32_t(state.range(1));
+    const size_t depth = TREE_DEPTH;
+
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    LMDBEnvironment environment = LMDBEnvironment(directory, 1024 * 1024, 2, num_threads);
+
+    LMDBStore db(environment, name, false, false, integer_key_cmp);
+    StoreType store(name, depth, db);
+    ThreadPool workers(num_threads);
+    TreeType tree = TreeType(store, workers, batch_size);
+
+    for (auto _ : state) {
+        state.PauseTiming();
+        std::vector<NullifierLeafValue> values(batch_size);
+        for (size_t i = 0; i < batch_size; ++i) {
+            values[i] = fr(random_engine.get_random_uint256());
+        }
+        state.ResumeTiming();
+        add_values(tree, values);
+    }
+    state.counters["threads"] = num_threads;
+    state.counters["leaves_per_second"] =
+        Counter(double(batch_size) * double(state.iterations()), Counter::kIsRate);
+}
+
 BENCHMARK(single_thread_indexed_tree_bench<Pedersen>)
     ->Unit(benchmark::kMillisecond)
     ->RangeMultiplier(2)
@@ -106,4 +136,11 @@ BENCHMARK(multi_thread_indexed_tree_bench<Poseidon2>)
     ->Range(2, MAX_BATCH_SIZE)
     ->Iterations(1000);
 
+// Throughput of a batch as the number of worker threads grows
+BENCHMARK(thread_scaling_indexed_tree_bench<Poseidon2>)
+    ->Unit(benchmark::kMillisecond)
+    ->ArgsProduct({ { 64, MAX_BATCH_SIZE }, { 1, 2, 4, 8, 16, 32 } })
+    ->UseRealTime()
+    ->Iterations(200);
+
 BENCHMARK_MAIN();
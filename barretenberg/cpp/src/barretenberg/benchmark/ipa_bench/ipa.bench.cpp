@@ -1,10 +1,31 @@
+// This define is needed to make IPABenchProxy a friend of IPA
+#define IPA_BENCH
 #include "barretenberg/commitment_schemes/ipa/ipa.hpp"
 #include "barretenberg/polynomials/polynomial.hpp"
 #include <benchmark/benchmark.h>
+#include <chrono>
+#include <map>
 
 using namespace benchmark;
 using namespace bb;
 
+namespace bb {
+/**
+ * @brief Class that allows us to call the IPA prover with a transcript other than NativeTranscript
+ *
+ */
+class IPABenchProxy {
+  public:
+    template <typename Transcript>
+    static void compute_opening_proof_internal(const std::shared_ptr<CommitmentKey<curve::Grumpkin>>& ck,
+                                               const ProverOpeningClaim<curve::Grumpkin>& opening_claim,
+                                               const std::shared_ptr<Transcript>& transcript)
+    {
+        IPA<curve::Grumpkin>::compute_opening_proof_internal(ck, opening_claim, transcript);
+    }
+};
+} // namespace bb
+
 namespace {
 using Curve = curve::Grumpkin;
 using Fr = Curve::ScalarField;
@@ -18,6 +39,26 @@ std::shared_ptr<VerifierCommitmentKey<Curve>> vk;
 std::vector<std::shared_ptr<NativeTranscript>> prover_transcripts(MAX_POLYNOMIAL_DEGREE_LOG2 -
                                                                   MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
 std::vector<OpeningClaim<Curve>> opening_claims(MAX_POLYNOMIAL_DEGREE_LOG2 - MIN_POLYNOMIAL_DEGREE_LOG2 + 1);
+
+/**
+ * @brief A prover transcript that records when the IPA round challenges are drawn
+ *
+ * @details The prover draws the challenge of a round between computing L_i, R_i and folding the vectors, so the time
+ * between two consecutive challenges covers the fold of one round and the L, R MSMs of the next.
+ */
+class RoundTimingTranscript : public NativeTranscript {
+  public:
+    using Clock = std::chrono::steady_clock;
+    std::vector<Clock::time_point> challenge_times;
+
+    template <typename ChallengeType> ChallengeType get_challenge(const std::string& label)
+    {
+        if (label.starts_with("IPA:")) {
+            challenge_times.push_back(Clock::now());
+        }
+        return NativeTranscript::get_challenge<ChallengeType>(label);
+    }
+};
 static void DoSetup(const benchmark::State&)
 {
     srs::init_grumpkin_crs_factory("../srs_db/grumpkin");
@@ -29,6 +70,7 @@ static void DoSetup(const benchmark::State&)
 void ipa_open(State& state) noexcept
 {
     numeric::RNG& engine = numeric::get_debug_randomness();
+    std::map<std::string, double> round_times_us;
     for (auto _ : state) {
         state.PauseTiming();
         size_t n = 1 << static_cast<size_t>(state.range(0));
@@ -42,14 +84,33 @@ void ipa_open(State& state) noexcept
         const OpeningPair<Curve> opening_pair = { x, eval };
         const OpeningClaim<Curve> opening_claim{ opening_pair, ck->commit(poly) };
         // initialize empty prover transcript
-        auto prover_transcript = std::make_shared<NativeTranscript>();
+        auto prover_transcript = std::make_shared<RoundTimingTranscript>();
         state.ResumeTiming();
         // Compute proof
-        IPA<Curve>::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+        IPABenchProxy::compute_opening_proof_internal(ck, { poly, opening_pair }, prover_transcript);
+        const auto end_time = RoundTimingTranscript::Clock::now();
+        state.PauseTiming();
+        // Round i runs from the challenge of round i-1 (the generator challenge for round 0) to its own challenge, and
+        // the last fold runs to the end of the proof
+        auto& times = prover_transcript->challenge_times;
+        times.push_back(end_time);
+        for (size_t i = 1; i < times.size(); ++i) {
+            std::string name = "final_fold";
+            if (i < times.size() - 1) {
+                name = (i <= 10 ? "round_0" : "round_") + std::to_string(i - 1);
+            }
+            round_times_us[name] += static_cast<double>(
+                std::chrono::duration_cast<std::chrono::microseconds>(times[i] - times[i - 1]).count());
+        }
+        state.ResumeTiming();
         // Store info for verifier
         prover_transcripts[static_cast<size_t>(state.range(0)) - MIN_POLYNOMIAL_DEGREE_LOG2] = prover_transcript;
         opening_claims[static_cast<size_t>(state.range(0)) - MIN_POLYNOMIAL_DEGREE_LOG2] = opening_claim;
     }
+    // Per-round timings in microseconds, averaged over the iterations
+    for (const auto& [name, time_us] : round_times_us) {
+        state.counters[name + "_us"] = Counter(time_us, Counter::kAvgIterations);
+    }
 }
 void ipa_verify(State& state) noexcept
 {
@@ -0,0 +1,120 @@
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/crypto/merkle_tree/append_only_tree/append_only_tree.hpp"
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/crypto/merkle_tree/hash.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/cached_tree_store.hpp"
+#include "barretenberg/crypto/merkle_tree/node_store/node_cache.hpp"
+#include "barretenberg/crypto/merkle_tree/signal.hpp"
+#include <benchmark/benchmark.h>
+#include <filesystem>
+#include <unordered_map>
+
+using namespace benchmark;
+using namespace bb::crypto::merkle_tree;
+
+using StoreType = CachedTreeStore<LMDBStore, bb::fr>;
+using TreeType = AppendOnlyTree<StoreType, Poseidon2HashPolicy>;
+
+namespace {
+const uint32_t TREE_DEPTH = 32;
+const size_t MAX_BATCH_SIZE = 8192;
+
+const std::vector<bb::fr> VALUES = []() {
+    std::vector<bb::fr> values(MAX_BATCH_SIZE);
+    for (size_t i = 0; i < MAX_BATCH_SIZE; ++i) {
+        values[i] = bb::fr(random_engine.get_random_uint256());
+    }
+    return values;
+}();
+
+// The previous representation of uncommitted nodes, a map per level of serialised node values
+using ByteNodeCache = std::vector<std::unordered_map<index_t, std::vector<uint8_t>>>;
+
+// Writes, then reads back, every node of a subtree of batch_size leaves as an append would
+void write_and_read_byte_cache(ByteNodeCache& cache, size_t batch_size)
+{
+    for (uint32_t level = TREE_DEPTH, count = uint32_t(batch_size); count > 0; --level, count >>= 1) {
+        for (index_t i = 0; i < count; ++i) {
+            std::vector<uint8_t> buf;
+            write(buf, VALUES[i]);
+            cache[level][i] = buf;
+        }
+        for (index_t i = 0; i < count; ++i) {
+            auto it = cache[level].find(i);
+            DoNotOptimize(from_buffer<bb::fr>(it->second, 0));
+        }
+    }
+}
+
+void write_and_read_flat_cache(std::vector<NodeLevelCache>& cache, size_t batch_size)
+{
+    for (uint32_t level = TREE_DEPTH, count = uint32_t(batch_size); count > 0; --level, count >>= 1) {
+        for (index_t i = 0; i < count; ++i) {
+            cache[level].put(i, VALUES[i]);
+        }
+        for (index_t i = 0; i < count; ++i) {
+            bb::fr value;
+            DoNotOptimize(cache[level].get(i, value));
+            DoNotOptimize(value);
+        }
+    }
+}
+} // namespace
+
+void byte_node_cache(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    for (auto _ : state) {
+        // The cache was previously re-created on every commit/rollback
+        ByteNodeCache cache(TREE_DEPTH + 1);
+        write_and_read_byte_cache(cache, batch_size);
+    }
+}
+BENCHMARK(byte_node_cache)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(128, MAX_BATCH_SIZE);
+
+void flat_node_cache(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    std::vector<NodeLevelCache> cache(TREE_DEPTH + 1);
+    for (auto _ : state) {
+        for (auto& level : cache) {
+            level.clear();
+        }
+        write_and_read_flat_cache(cache, batch_size);
+    }
+}
+BENCHMARK(flat_node_cache)->Unit(benchmark::kMicrosecond)->RangeMultiplier(4)->Range(128, MAX_BATCH_SIZE);
+
+// End to end cost of appending a batch of leaves to the uncommitted state, dominated by hashing but including the
+// node cache. Compare across revisions to see the effect of changes to the cache
+void append_uncommitted_leaves(State& state) noexcept
+{
+    const size_t batch_size = size_t(state.range(0));
+    std::string directory = random_temp_directory();
+    std::string name = random_string();
+    std::filesystem::create_directories(directory);
+    LMDBEnvironment environment = LMDBEnvironment(directory, 1024 * 1024, 1, 1);
+    LMDBStore db(environment, name, false, false, integer_key_cmp);
+    StoreType store(name, TREE_DEPTH, db);
+    ThreadPool workers(1);
+    TreeType tree(store, workers);
+    std::vector<bb::fr> values(VALUES.begin(), VALUES.begin() + static_cast<std::ptrdiff_t>(batch_size));
+
+    for (auto _ : state) {
+        Signal signal(1);
+        tree.add_values(values, [&](const auto&) { signal.signal_level(0); });
+        signal.wait_for_level(0);
+
+        state.PauseTiming();
+        Signal rollback_signal(1);
+        tree.rollback([&](const auto&) { rollback_signal.signal_level(0); });
+        rollback_signal.wait_for_level(0);
+        state.ResumeTiming();
+    }
+    std::filesystem::remove_all(directory);
+}
+BENCHMARK(append_uncommitted_leaves)->Unit(benchmark::kMillisecond)->RangeMultiplier(4)->Range(128, MAX_BATCH_SIZE);
+
+BENCHMARK_MAIN();
@@ -1,4 +1,5 @@
 #include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/polynomials/polynomial_arithmetic.hpp"
@@ -6,8 +7,10 @@
 
 #include "barretenberg/stdlib_circuit_builders/ultra_circuit_builder.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
+#include <limits>
 
 // #include <valgrind/callgrind.h>
 //  CALLGRIND_START_INSTRUMENTATION;
@@ -42,6 +45,10 @@ using namespace bb;
 //     return acc;
 // }
 constexpr size_t NUM_POINTS = 1 << 16;
+constexpr size_t MIN_LOG_MSM_POINTS = 12;
+constexpr size_t MAX_LOG_MSM_POINTS = 24;
+constexpr size_t MAX_MSM_POINTS = 1 << MAX_LOG_MSM_POINTS;
+constexpr size_t NUM_MSM_REPETITIONS = 3;
 std::vector<fr> scalars;
 static bb::evaluation_domain small_domain;
 static bb::evaluation_domain large_domain;
@@ -52,8 +59,8 @@ const auto init = []() {
 
     fr element = fr::random_element();
     fr accumulator = element;
-    scalars.reserve(NUM_POINTS * 4);
-    for (size_t i = 0; i < NUM_POINTS * 4; ++i) {
+    scalars.reserve(MAX_MSM_POINTS);
+    for (size_t i = 0; i < MAX_MSM_POINTS; ++i) {
         accumulator *= element;
         scalars.emplace_back(accumulator);
     }
@@ -65,18 +72,40 @@ const auto init = []() {
 // constexpr double add_to_mixed_add_complexity = 1.36;
 
 auto reference_string =
-    std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(NUM_POINTS, "../srs_db/ignition");
+    std::make_shared<bb::srs::factories::FileProverCrs<curve::BN254>>(MAX_MSM_POINTS, "../srs_db/ignition");
 
-int pippenger()
+// Returns the best run time of an MSM of the given size using the given bucket method, in microseconds
+int64_t pippenger(const size_t num_points,
+                  const scalar_multiplication::PippengerAlgorithm algorithm,
+                  scalar_multiplication::pippenger_runtime_state<curve::BN254>& state)
 {
-    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(NUM_POINTS);
-    std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
-    g1::element result = scalar_multiplication::pippenger_unsafe<curve::BN254>(
-        { &scalars[0], /*size*/ NUM_POINTS }, reference_string->get_monomial_points(), state);
-    std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
-    std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
-    std::cout << "run time: " << diff.count() << "us" << std::endl;
-    std::cout << result.x << std::endl;
+    scalar_multiplication::set_pippenger_algorithm(algorithm);
+    int64_t best_time = std::numeric_limits<int64_t>::max();
+    for (size_t i = 0; i < NUM_MSM_REPETITIONS; ++i) {
+        std::chrono::steady_clock::time_point time_start = std::chrono::steady_clock::now();
+        scalar_multiplication::pippenger_unsafe<curve::BN254>(
+            { &scalars[0], /*size*/ num_points }, reference_string->get_monomial_points(), state);
+        std::chrono::steady_clock::time_point time_end = std::chrono::steady_clock::now();
+        std::chrono::microseconds diff = std::chrono::duration_cast<std::chrono::microseconds>(time_end - time_start);
+        best_time = std::min(best_time, static_cast<int64_t>(diff.count()));
+    }
+    return best_time;
+}
+
+// Compares the wnaf and signed digit bucket methods of pippenger over a range of MSM sizes
+int compare_pippenger_algorithms()
+{
+    scalar_multiplication::pippenger_runtime_state<curve::BN254> state(MAX_MSM_POINTS);
+    for (size_t log_num_points = MIN_LOG_MSM_POINTS; log_num_points <= MAX_LOG_MSM_POINTS; ++log_num_points) {
+        const size_t num_points = 1UL << log_num_points;
+        const int64_t wnaf_time = pippenger(num_points, scalar_multiplication::PippengerAlgorithm::WNAF, state);
+        const int64_t signed_digit_time =
+            pippenger(num_points, scalar_multiplication::PippengerAlgorithm::SIGNED_DIGIT, state);
+        const size_t window_bits = scalar_multiplication::get_signed_digit_window_bits(num_points * 2, get_num_cpus());
+        std::cout << "2^" << log_num_points << " points: wnaf " << wnaf_time << "us, signed digit "
+                  << signed_digit_time << "us (" << window_bits << " bit windows)" << std::endl;
+    }
+    scalar_multiplication::set_pippenger_algorithm(scalar_multiplication::PippengerAlgorithm::WNAF);
     return 0;
 }
 
@@ -110,10 +139,6 @@ int main()
     std::cout << "executing sliced fft" << std::endl;
     coset_fft_split();
     std::cout << "executing pippenger algorithm" << std::endl;
-    pippenger();
-    pippenger();
-    pippenger();
-    pippenger();
-    pippenger();
+    compare_pippenger_algorithms();
     return 0;
 }
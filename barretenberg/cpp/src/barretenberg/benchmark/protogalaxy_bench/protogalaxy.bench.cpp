@@ -43,6 +43,25 @@ void compute_row_evaluations(State& state) noexcept
     }
 }
 
+void compute_perturbator(State& state) noexcept
+{
+    using Fun = ProtogalaxyProverInternal<DeciderProvingKeys_<Flavor, 2>>;
+    using DeciderProvingKey = DeciderProvingKey_<Flavor>;
+
+    const auto log_dyadic_size = static_cast<size_t>(state.range(0));
+    auto accumulator = std::make_shared<DeciderProvingKey>();
+    accumulator->proving_key.polynomials = Flavor::ProverPolynomials(1 << log_dyadic_size);
+    accumulator->proving_key.log_circuit_size = log_dyadic_size;
+    accumulator->relation_parameters = RelationParameters<FF>::get_random();
+    accumulator->gate_challenges = std::vector<FF>(CONST_PG_LOG_N, FF::random_element());
+    const std::vector<FF> deltas = compute_round_challenge_pows(CONST_PG_LOG_N, FF::random_element());
+
+    for (auto _ : state) {
+        auto result = Fun::compute_perturbator(accumulator, deltas);
+        DoNotOptimize(result);
+    }
+}
+
 // Fold one proving key into an accumulator.
 void fold_k(State& state) noexcept
 {
@@ -77,6 +96,7 @@ void fold_k(State& state) noexcept
 
 BENCHMARK(vector_of_evaluations)->DenseRange(15, 21)->Unit(kMillisecond)->Iterations(1);
 BENCHMARK(compute_row_evaluations)->DenseRange(15, 21)->Unit(kMillisecond);
+BENCHMARK(compute_perturbator)->DenseRange(15, 21)->Unit(kMillisecond);
 // We stick to just k=1 for compile-time reasons.
 BENCHMARK(fold_k)->/* vary the circuit size */ DenseRange(14, 20)->Unit(kMillisecond);
 
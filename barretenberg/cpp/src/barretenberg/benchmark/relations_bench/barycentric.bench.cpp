@@ -1,5 +1,6 @@
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/polynomials/univariate.hpp"
+#include "barretenberg/stdlib_circuit_builders/ultra_flavor.hpp"
 #include <benchmark/benchmark.h>
 
 using namespace benchmark;
@@ -55,9 +56,52 @@ void self_extend_2_to_11(State& state) noexcept
     }
 }
 
+// Extending the edges of all columns of the Ultra flavor, as in SumcheckProverRound::extend_edges
+constexpr size_t NUM_COLUMNS = UltraFlavor::NUM_ALL_ENTITIES;
+constexpr size_t EXTENDED_LENGTH = UltraFlavor::MAX_PARTIAL_RELATION_LENGTH;
+
+template <size_t LENGTH> std::array<std::array<FF, NUM_COLUMNS>, LENGTH> random_edges()
+{
+    std::array<std::array<FF, NUM_COLUMNS>, LENGTH> values;
+    for (auto& row : values) {
+        std::generate(row.begin(), row.end(), [&]() { return FF::random_element(&engine); });
+    }
+    return values;
+}
+
+template <size_t LENGTH> void extend_columns_one_at_a_time(State& state) noexcept
+{
+    const auto values = random_edges<LENGTH>();
+    std::array<Univariate<FF, EXTENDED_LENGTH>, NUM_COLUMNS> results;
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_COLUMNS; i++) {
+            Univariate<FF, LENGTH> edge;
+            for (size_t j = 0; j < LENGTH; j++) {
+                edge.evaluations[j] = values[j][i];
+            }
+            results[i] = edge.template extend_to<EXTENDED_LENGTH>();
+        }
+        DoNotOptimize(results);
+    }
+}
+
+template <size_t LENGTH> void extend_columns_batched(State& state) noexcept
+{
+    const auto values = random_edges<LENGTH>();
+    std::array<Univariate<FF, EXTENDED_LENGTH>, NUM_COLUMNS> results;
+    for (auto _ : state) {
+        extend_batch<EXTENDED_LENGTH>(values, results);
+        DoNotOptimize(results);
+    }
+}
+
 BENCHMARK(extend_2_to_11);
 BENCHMARK(fake_extend_2_to_11);
 BENCHMARK(self_extend_2_to_11);
+BENCHMARK(extend_columns_one_at_a_time<2>);
+BENCHMARK(extend_columns_batched<2>);
+BENCHMARK(extend_columns_one_at_a_time<5>);
+BENCHMARK(extend_columns_batched<5>);
 
 } // namespace bb::benchmark
 
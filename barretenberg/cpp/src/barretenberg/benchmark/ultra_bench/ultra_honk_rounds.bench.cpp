@@ -6,6 +6,8 @@
 #include "barretenberg/ultra_honk/decider_prover.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
 #include "barretenberg/ultra_honk/ultra_prover.hpp"
+#include <fstream>
+#include <string>
 
 using namespace benchmark;
 using namespace bb;
@@ -19,9 +21,36 @@ enum {
     GRAND_PRODUCT_COMPUTATION,
     GENERATE_ALPHAS,
     RELATION_CHECK,
-    ZEROMORPH
+    ZEROMORPH,
+    // The relation check, with the first sumcheck rounds computed without the book-keeping table
+    RELATION_CHECK_FUSED
 };
 
+constexpr size_t NUM_FUSED_SUMCHECK_ROUNDS = 3;
+
+/**
+ * @brief Reset the peak resident set size of the process to its current value. Linux only, a no-op elsewhere.
+ */
+static void reset_peak_rss()
+{
+    std::ofstream("/proc/self/clear_refs") << "5";
+}
+
+/**
+ * @brief The peak resident set size of the process in MiB since the last reset_peak_rss(), or 0 if unavailable.
+ */
+static double get_peak_rss_mib()
+{
+    std::ifstream status("/proc/self/status");
+    std::string line;
+    while (std::getline(status, line)) {
+        if (line.starts_with("VmHWM:")) {
+            return std::stod(line.substr(6)) / 1024;
+        }
+    }
+    return 0;
+}
+
 /**
  * @details Benchmark Goblin ultrahonk by performing all the rounds, but only measuring one.
  * Note: As a result the very short rounds take a long time for statistical significance, so recommended to set their
@@ -35,12 +64,14 @@ BB_PROFILE static void test_round_inner(State& state, MegaProver& prover, size_t
     auto time_if_index = [&](size_t target_index, auto&& func) -> void {
         BB_REPORT_OP_COUNT_IN_BENCH(state);
         if (index == target_index) {
+            reset_peak_rss();
             state.ResumeTiming();
         }
 
         func();
         if (index == target_index) {
             state.PauseTiming();
+            state.counters["peak_rss_MiB"] = get_peak_rss_mib();
         } else {
             // We don't actually want to write to user-defined counters
             BB_REPORT_OP_COUNT_BENCH_CANCEL();
@@ -57,7 +88,10 @@ BB_PROFILE static void test_round_inner(State& state, MegaProver& prover, size_t
     prover.generate_gate_challenges();
 
     DeciderProver_<MegaFlavor> decider_prover(prover.proving_key, prover.transcript);
-    time_if_index(RELATION_CHECK, [&] { decider_prover.execute_relation_check_rounds(); });
+    const bool fused = index == RELATION_CHECK_FUSED;
+    decider_prover.num_fused_sumcheck_rounds = fused ? NUM_FUSED_SUMCHECK_ROUNDS : 0;
+    time_if_index(fused ? RELATION_CHECK_FUSED : RELATION_CHECK,
+                  [&] { decider_prover.execute_relation_check_rounds(); });
     time_if_index(ZEROMORPH, [&] { decider_prover.execute_pcs_rounds(); });
 }
 BB_PROFILE static void test_round(State& state, size_t index) noexcept
@@ -92,5 +126,6 @@ ROUND_BENCHMARK(GRAND_PRODUCT_COMPUTATION)->Iterations(1);
 ROUND_BENCHMARK(GENERATE_ALPHAS)->Iterations(1);
 ROUND_BENCHMARK(RELATION_CHECK);
 ROUND_BENCHMARK(ZEROMORPH);
+ROUND_BENCHMARK(RELATION_CHECK_FUSED);
 
 BENCHMARK_MAIN();
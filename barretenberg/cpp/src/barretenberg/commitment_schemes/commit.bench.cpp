@@ -139,6 +139,96 @@ template <typename Curve> void bench_commit_random_non_power_of_2(::benchmark::S
         key->commit(polynomial);
     }
 }
+// Generate a polynomial with coefficients like those of a witness: a quarter each of zeros, ones, 14 bit range
+// constraint limbs and random field elements
+template <typename FF> Polynomial<FF> mixed_random_poly(const size_t size)
+{
+    auto& engine = numeric::get_debug_randomness();
+    auto polynomial = Polynomial<FF>(size);
+
+    for (size_t i = 0; i < size; i++) {
+        switch (engine.get_random_uint32() % 4) {
+        case 0:
+            break;
+        case 1:
+            polynomial.at(i) = 1;
+            break;
+        case 2:
+            polynomial.at(i) = engine.get_random_uint32() & ((1U << 14) - 1);
+            break;
+        default:
+            polynomial.at(i) = FF::random_element();
+        }
+    }
+
+    return polynomial;
+}
+
+// Commit to a polynomial with a mix of zero, one, small and full size coefficients
+template <typename Curve> void bench_commit_mixed_random(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = mixed_random_poly<Fr>(num_points);
+    for (auto _ : state) {
+        key->commit(polynomial);
+    }
+}
+
+// Commit to a polynomial with a mix of zero, one, small and full size coefficients using the commit_classified method
+template <typename Curve> void bench_commit_mixed_random_classified(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    auto polynomial = mixed_random_poly<Fr>(num_points);
+    for (auto _ : state) {
+        key->commit_classified(polynomial);
+    }
+}
+
+constexpr size_t BATCH_NUM_POLYNOMIALS = 128;
+constexpr size_t MIN_LOG_BATCH_POLY_SIZE = 8;
+constexpr size_t MAX_LOG_BATCH_POLY_SIZE = 16;
+
+// Commit to a set of small polynomials with dense random entries, one at a time
+template <typename Curve> void bench_commit_random_polys(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_NUM_POLYNOMIALS; ++i) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    for (auto _ : state) {
+        for (auto& polynomial : polynomials) {
+            key->commit(polynomial);
+        }
+    }
+}
+
+// Commit to a set of small polynomials with dense random entries, all at once
+template <typename Curve> void bench_batch_commit_random_polys(::benchmark::State& state)
+{
+    using Fr = typename Curve::ScalarField;
+    auto key = create_commitment_key<Curve>(MAX_NUM_POINTS);
+
+    const size_t num_points = 1 << state.range(0);
+    std::vector<Polynomial<Fr>> polynomials;
+    for (size_t i = 0; i < BATCH_NUM_POLYNOMIALS; ++i) {
+        polynomials.emplace_back(Polynomial<Fr>::random(num_points));
+    }
+    std::vector<PolynomialSpan<const Fr>> spans(polynomials.begin(), polynomials.end());
+    for (auto _ : state) {
+        key->batch_commit(spans);
+    }
+}
+
 BENCHMARK(bench_commit_zero<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
@@ -160,6 +250,19 @@ BENCHMARK(bench_commit_random<curve::BN254>)
 BENCHMARK(bench_commit_random_non_power_of_2<curve::BN254>)
     ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
     ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_mixed_random<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_commit_mixed_random_classified<curve::BN254>)
+    ->DenseRange(MIN_LOG_NUM_POINTS, MAX_LOG_NUM_POINTS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK(bench_commit_random_polys<curve::BN254>)
+    ->DenseRange(MIN_LOG_BATCH_POLY_SIZE, MAX_LOG_BATCH_POLY_SIZE, 2)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(bench_batch_commit_random_polys<curve::BN254>)
+    ->DenseRange(MIN_LOG_BATCH_POLY_SIZE, MAX_LOG_BATCH_POLY_SIZE, 2)
+    ->Unit(benchmark::kMillisecond);
 
 } // namespace bb
 
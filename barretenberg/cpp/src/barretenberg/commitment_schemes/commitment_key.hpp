@@ -8,6 +8,7 @@
  */
 
 #include "barretenberg/common/debug_log.hpp"
+#include "barretenberg/common/log.hpp"
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
@@ -18,9 +19,13 @@
 #include "barretenberg/srs/factories/file_crs_factory.hpp"
 #include "barretenberg/srs/global_crs.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <span>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace bb {
 
@@ -98,7 +103,7 @@ template <class Curve> class CommitmentKey {
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
         // with our polynomial span.
-        std::span<G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
+        std::span<const G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
         DEBUG_LOG_ALL(polynomial.span);
         Commitment point = scalar_multiplication::pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(
             polynomial.span, point_table, pippenger_runtime_state);
@@ -125,7 +130,7 @@ template <class Curve> class CommitmentKey {
         // Extract the precomputed point table (contains raw SRS points at even indices and the corresponding
         // endomorphism point (\beta*x, -y) at odd indices). We offset by polynomial.start_index * 2 to align
         // with our polynomial span.
-        std::span<G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
+        std::span<const G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
 
         // Define structures needed to multithread the extraction of non-zero inputs
         const size_t num_threads = calculate_num_threads(poly_size);
@@ -173,6 +178,208 @@ template <class Curve> class CommitmentKey {
         // Call the version of pippenger which assumes all points are distinct
         return scalar_multiplication::pippenger_unsafe<Curve>(scalars, points, pippenger_runtime_state);
     }
+
+    /**
+     * @brief Commit to a polynomial whose coefficients are mostly zero, one or small (less than 2^64)
+     * @details Generalizes commit_sparse: the coefficients are classified in a single pass and each class committed to
+     * by a suitable method, see scalar_multiplication::pippenger_classified_unsafe. Falls back to the usual MSM when
+     * most of the coefficients are full size, so is never much slower than commit().
+     *
+     * @param polynomial
+     * @return Commitment
+     */
+    Commitment commit_classified(PolynomialSpan<const Fr> polynomial)
+    {
+        BB_OP_COUNT_TIME();
+        // We must have a power-of-2 SRS points *after* subtracting by start_index, for the fallback to the usual MSM
+        const size_t consumed_srs = numeric::round_up_power_2(polynomial.size()) + polynomial.start_index;
+        auto srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
+        if (consumed_srs > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  consumed_srs,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+
+        std::span<const G1> point_table = srs->get_monomial_points().subspan(polynomial.start_index * 2);
+        return scalar_multiplication::pippenger_classified_unsafe<Curve>(
+            polynomial.span, point_table, pippenger_runtime_state);
+    }
+
+    /**
+     * @brief Commit to a polynomial from a structured trace, whose coefficients are zero outside of a set of row ranges
+     * @details In a structured trace each block is padded to a fixed size, so e.g. a wire polynomial is zero over the
+     * unused rows of every block. Each active range of the polynomial is a contiguous span of scalars, whose points are
+     * a contiguous span of the point table, so the MSM over the active ranges needs no copies: the ranges are
+     * evaluated as a batch of MSMs with scalar_multiplication::pippenger_batch_unsafe and the results summed.
+     * @warning Coefficients outside of the active ranges are assumed to be zero and are ignored.
+     *
+     * @param polynomial
+     * @param active_ranges The [start, end) rows of the trace that may be nonzero, e.g. the populated rows of each
+     * block. Need not be sorted or lie within the polynomial.
+     * @return Commitment
+     */
+    Commitment commit_structured(PolynomialSpan<const Fr> polynomial,
+                                 const std::vector<std::pair<size_t, size_t>>& active_ranges)
+    {
+        BB_OP_COUNT_TIME();
+        ASSERT(polynomial.end_index() <= srs->get_monomial_size());
+
+        // Clip the ranges to the polynomial, then merge those that touch (e.g. full blocks) into a single MSM
+        std::vector<std::pair<size_t, size_t>> ranges;
+        ranges.reserve(active_ranges.size());
+        for (const auto& [start, end] : active_ranges) {
+            const size_t clipped_start = std::max(start, polynomial.start_index);
+            const size_t clipped_end = std::min(end, polynomial.end_index());
+            if (clipped_start < clipped_end) {
+                ranges.emplace_back(clipped_start, clipped_end);
+            }
+        }
+        std::sort(ranges.begin(), ranges.end());
+        std::vector<std::pair<size_t, size_t>> merged_ranges;
+        for (const auto& range : ranges) {
+            if (!merged_ranges.empty() && range.first <= merged_ranges.back().second) {
+                merged_ranges.back().second = std::max(merged_ranges.back().second, range.second);
+            } else {
+                merged_ranges.emplace_back(range);
+            }
+        }
+
+        std::span<const G1> monomial_points = srs->get_monomial_points();
+        std::vector<std::span<const Fr>> scalars;
+        std::vector<std::span<const G1>> point_tables;
+        scalars.reserve(merged_ranges.size());
+        point_tables.reserve(merged_ranges.size());
+        size_t num_active_rows = 0;
+        for (const auto& [start, end] : merged_ranges) {
+            scalars.emplace_back(polynomial.span.subspan(start - polynomial.start_index, end - start));
+            point_tables.emplace_back(monomial_points.subspan(start * 2));
+            num_active_rows += end - start;
+        }
+        vinfo("commit_structured: skipped ",
+              polynomial.size() - num_active_rows,
+              " of ",
+              polynomial.size(),
+              " rows in ",
+              merged_ranges.size(),
+              " active ranges");
+
+        typename Curve::Element result;
+        result.self_set_infinity();
+        for (const Commitment& range_commitment :
+             scalar_multiplication::pippenger_batch_unsafe<Curve>(scalars, point_tables, pippenger_runtime_state)) {
+            result += range_commitment;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Commit to a set of polynomials, giving the same result as calling commit() on each of them
+     * @details Small polynomials are committed to concurrently rather than one after another, see
+     * scalar_multiplication::pippenger_batch_unsafe. This is faster than repeated calls to commit() whenever the set
+     * contains polynomials too small to occupy every thread on their own.
+     *
+     * @param polynomials
+     * @return The commitment to each polynomial, in order
+     */
+    std::vector<Commitment> batch_commit(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        // We must have a power-of-2 SRS points *after* subtracting by start_index, for every polynomial
+        size_t consumed_srs = 0;
+        for (const auto& polynomial : polynomials) {
+            consumed_srs =
+                std::max(consumed_srs, numeric::round_up_power_2(polynomial.size()) + polynomial.start_index);
+        }
+        auto srs = srs::get_crs_factory<Curve>()->get_prover_crs(consumed_srs);
+        if (consumed_srs > srs->get_monomial_size()) {
+            throw_or_abort(format("Attempting to commit to a polynomial that needs ",
+                                  consumed_srs,
+                                  " points with an SRS of size ",
+                                  srs->get_monomial_size()));
+        }
+
+        std::vector<std::span<const Fr>> scalars;
+        std::vector<std::span<const G1>> point_tables;
+        scalars.reserve(polynomials.size());
+        point_tables.reserve(polynomials.size());
+        for (const auto& polynomial : polynomials) {
+            scalars.emplace_back(polynomial.span);
+            point_tables.emplace_back(srs->get_monomial_points().subspan(polynomial.start_index * 2));
+        }
+        return scalar_multiplication::pippenger_batch_unsafe<Curve>(scalars, point_tables, pippenger_runtime_state);
+    }
+
+    /**
+     * @brief Commit to a set of sparse polynomials, giving the same result as calling commit_sparse() on each of them
+     * @details The {point, scalar} pairs with nonzero scalars are extracted from several polynomials at once (one
+     * polynomial per thread) and the reduced MSMs evaluated together with pippenger_batch_unsafe. Polynomials are
+     * processed in groups so that the copied inputs stay bounded in size.
+     *
+     * @param polynomials
+     * @return The commitment to each polynomial, in order
+     */
+    std::vector<Commitment> batch_commit_sparse(std::span<const PolynomialSpan<const Fr>> polynomials)
+    {
+        BB_OP_COUNT_TIME();
+        // Bounds the number of nonzero scalars (and their points) copied at any one time
+        constexpr size_t MAX_NONZERO_SCALARS_PER_GROUP = 1UL << 20;
+
+        const size_t num_polynomials = polynomials.size();
+        std::span<const G1> monomial_points = srs->get_monomial_points();
+        std::vector<size_t> num_nonzero_scalars(num_polynomials, 0);
+        parallel_for(num_polynomials, [&](size_t i) {
+            ASSERT(polynomials[i].end_index() <= srs->get_monomial_size());
+            for (const Fr& scalar : polynomials[i].span) {
+                if (!scalar.is_zero()) {
+                    num_nonzero_scalars[i]++;
+                }
+            }
+        });
+
+        std::vector<Commitment> commitments(num_polynomials);
+        size_t group_start = 0;
+        while (group_start < num_polynomials) {
+            // Take at least one polynomial, however many nonzero scalars it has
+            size_t group_end = group_start + 1;
+            size_t group_nonzero_scalars = num_nonzero_scalars[group_start];
+            while (group_end < num_polynomials &&
+                   group_nonzero_scalars + num_nonzero_scalars[group_end] <= MAX_NONZERO_SCALARS_PER_GROUP) {
+                group_nonzero_scalars += num_nonzero_scalars[group_end++];
+            }
+
+            const size_t group_size = group_end - group_start;
+            std::vector<std::vector<Fr>> group_scalars(group_size);
+            std::vector<std::vector<G1>> group_points(group_size);
+            parallel_for(group_size, [&](size_t i) {
+                const PolynomialSpan<const Fr>& polynomial = polynomials[group_start + i];
+                auto& scalars = group_scalars[i];
+                auto& points = group_points[i];
+                scalars.reserve(num_nonzero_scalars[group_start + i]);
+                points.reserve(num_nonzero_scalars[group_start + i] * 2);
+                for (size_t idx = 0; idx < polynomial.size(); ++idx) {
+                    const Fr& scalar = polynomial.span[idx];
+                    if (!scalar.is_zero()) {
+                        // Keep both the raw srs point and the precomputed endomorphism point from the point table
+                        const size_t point_idx = (polynomial.start_index + idx) * 2;
+                        scalars.emplace_back(scalar);
+                        points.emplace_back(monomial_points[point_idx]);
+                        points.emplace_back(monomial_points[point_idx + 1]);
+                    }
+                }
+            });
+
+            std::vector<std::span<const Fr>> scalar_spans(group_scalars.begin(), group_scalars.end());
+            std::vector<std::span<const G1>> point_spans(group_points.begin(), group_points.end());
+            std::vector<Commitment> group_commitments = scalar_multiplication::pippenger_batch_unsafe<Curve>(
+                scalar_spans, point_spans, pippenger_runtime_state);
+            std::copy(group_commitments.begin(),
+                      group_commitments.end(),
+                      commitments.begin() + static_cast<std::ptrdiff_t>(group_start));
+            group_start = group_end;
+        }
+        return commitments;
+    }
 };
 
 } // namespace bb
@@ -6,6 +6,7 @@
 #include "barretenberg/common/container.hpp"
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "barretenberg/transcript/transcript.hpp"
 #include <cstddef>
@@ -87,6 +88,9 @@ template <typename Curve_> class IPA {
    using Polynomial = bb::Polynomial<Fr>;
    using VerifierAccumulator = bool;
 
+   // Rounds folding at most this many points use the fused single-pass fold (see compute_opening_proof_internal)
+   static constexpr size_t IPA_TAIL_ROUND_SIZE = 1UL << 9;
+
 // These allow access to internal functions so that we can never use a mock transcript unless it's fuzzing or testing of IPA specifically
 #ifdef IPA_TEST
    FRIEND_TEST(IPATest, ChallengesAreZero);
@@ -94,6 +98,9 @@ template <typename Curve_> class IPA {
 #endif
 #ifdef IPA_FUZZ_TEST
    friend class ProxyCaller;
+#endif
+#ifdef IPA_BENCH
+   friend class IPABenchProxy;
 #endif
    /**
     * @brief Compute an inner product argument proof for opening a single polynomial at a single evaluation point.
@@ -165,7 +172,7 @@ template <typename Curve_> class IPA {
         // Set initial vector a to the polynomial monomial coefficients and load vector G
         // Ensure the polynomial copy is fully-formed
         auto a_vec = polynomial.full();
-        std::span<Commitment> srs_elements = ck->srs->get_monomial_points();
+        std::span<const Commitment> srs_elements = ck->srs->get_monomial_points();
         std::vector<Commitment> G_vec_local(poly_length);
 
         if (poly_length * 2 > srs_elements.size()) {
@@ -203,6 +210,13 @@ template <typename Curve_> class IPA {
         GroupElement R_i;
         std::size_t round_size = poly_length;
 
+        // The buffers below are allocated once and reused by every round: the vectors a, b and G are folded in place
+        // into their lower halves, point_table holds the pippenger point table of the current G for the L and R MSMs
+        // (the first round uses the SRS, which already is one), and the tail rounds accumulate into tail_points
+        std::vector<Commitment> point_table(poly_length);
+        std::vector<GroupElement> tail_points(std::min(poly_length / 2, IPA_TAIL_ROUND_SIZE));
+        group_elements::BatchAffine<Commitment> batch_affine(poly_length / 2);
+
         // Step 6.
         // Perform IPA reduction rounds
         for (size_t i = 0; i < log_poly_degree; i++) {
@@ -219,17 +233,26 @@ template <typename Curve_> class IPA {
                 }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
             // Sum inner product contributions computed in parallel and unpack the std::pair
             auto [inner_prod_L, inner_prod_R] = sum_pairs(inner_prods);
-            // Step 6.a (using letters, because doxygen automatically converts the sublist counters to letters :( )
-            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
-            L_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {&a_vec.at(0), /*size*/ round_size}, {&G_vec_local[round_size], /*size*/ round_size}, ck->pippenger_runtime_state);
-            L_i += aux_generator * inner_prod_L;
 
-            // Step 6.b
+            // Steps 6.a and 6.b (using letters, because doxygen automatically converts the sublist counters to letters :( )
+            // L_i = < a_vec_lo, G_vec_hi > + inner_prod_L * aux_generator
             // R_i = < a_vec_hi, G_vec_lo > + inner_prod_R * aux_generator
-            R_i = bb::scalar_multiplication::pippenger_without_endomorphism_basis_points<Curve>(
-                {&a_vec.at(round_size), /*size*/ round_size}, {&G_vec_local[0], /*size*/ round_size}, ck->pippenger_runtime_state);
-            R_i += aux_generator * inner_prod_R;
+            // Both MSMs are evaluated in a single batched pass, which spreads the two of them over all threads
+            std::span<const Commitment> G_table{ srs_elements.data(), 4 * round_size };
+            if (i > 0) {
+                bb::scalar_multiplication::generate_pippenger_point_table<Curve>(
+                    G_vec_local.data(), point_table.data(), 2 * round_size);
+                G_table = { point_table.data(), 4 * round_size };
+            }
+            const std::array<std::span<const Fr>, 2> msm_scalars{
+                std::span<const Fr>{ &a_vec.at(0), round_size }, std::span<const Fr>{ &a_vec.at(round_size), round_size }
+            };
+            const std::array<std::span<const Commitment>, 2> msm_points{ G_table.subspan(2 * round_size),
+                                                                         G_table.subspan(0, 2 * round_size) };
+            auto msm_results = bb::scalar_multiplication::pippenger_batch_unsafe<Curve>(
+                msm_scalars, msm_points, ck->pippenger_runtime_state);
+            L_i = GroupElement(msm_results[0]) + aux_generator * inner_prod_L;
+            R_i = GroupElement(msm_results[1]) + aux_generator * inner_prod_R;
 
             // Step 6.c
             // Send commitments to the verifier
@@ -246,27 +269,42 @@ template <typename Curve_> class IPA {
             }
             const Fr round_challenge_inv = round_challenge.invert();
 
-            // Step 6.e
+            // Steps 6.e, 6.f and 6.g
             // G_vec_new = G_vec_lo + G_vec_hi * round_challenge_inv
-            auto G_hi_by_inverse_challenge = GroupElement::batch_mul_with_endomorphism(
-                std::span{ G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size),
-                           G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size * 2) },
-                round_challenge_inv);
-            GroupElement::batch_affine_add(
-                std::span{ G_vec_local.begin(), G_vec_local.begin() + static_cast<std::ptrdiff_t>(round_size) },
-                G_hi_by_inverse_challenge,
-                G_vec_local);
-
-            // Steps 6.e and 6.f
-            // Update the vectors a_vec, b_vec.
             // a_vec_new = a_vec_lo + a_vec_hi * round_challenge
             // b_vec_new = b_vec_lo + b_vec_hi * round_challenge_inv
-            parallel_for_heuristic(
-                round_size,
-                [&](size_t j) {
-                    a_vec.at(j) += round_challenge * a_vec[round_size + j];
-                    b_vec[j] += round_challenge_inv * b_vec[round_size + j];
-                }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+            const std::span<Commitment> G_vec_lo{ G_vec_local.data(), round_size };
+            const std::span<Commitment> G_vec_hi{ G_vec_local.data() + round_size, round_size };
+            if (round_size > IPA_TAIL_ROUND_SIZE) {
+                // Batched affine arithmetic, in place: G_vec_hi *= round_challenge_inv, then G_vec_lo += G_vec_hi
+                GroupElement::batch_mul_with_endomorphism(G_vec_hi, round_challenge_inv, G_vec_hi);
+                batch_affine.add(G_vec_hi, G_vec_lo);
+                parallel_for_heuristic(
+                    round_size,
+                    [&](size_t j) {
+                        a_vec.at(j) += round_challenge * a_vec[round_size + j];
+                        b_vec[j] += round_challenge_inv * b_vec[round_size + j];
+                    }, thread_heuristics::FF_ADDITION_COST * 2 + thread_heuristics::FF_MULTIPLICATION_COST * 2);
+            } else {
+                // In the tail rounds, the ~200 passes of batch_mul_with_endomorphism cost more in thread fan-out than
+                // they save. Instead, each thread folds its share of all three vectors in one pass, with a Jacobian
+                // scalar multiplication per point, and normalizes its points with a single inversion
+                parallel_for_heuristic(
+                    round_size,
+                    [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                        for (size_t j = start; j < end; j++) {
+                            a_vec.at(j) += round_challenge * a_vec[round_size + j];
+                            b_vec[j] += round_challenge_inv * b_vec[round_size + j];
+                            tail_points[j] = GroupElement(G_vec_hi[j]) * round_challenge_inv + G_vec_lo[j];
+                        }
+                        GroupElement::batch_normalize(&tail_points[start], end - start);
+                        for (size_t j = start; j < end; j++) {
+                            G_vec_lo[j] = tail_points[j].is_point_at_infinity()
+                                              ? Commitment::infinity()
+                                              : Commitment(tail_points[j].x, tail_points[j].y);
+                        }
+                    }, thread_heuristics::SM_COST);
+            }
         }
 
         // Step 7
@@ -230,6 +230,35 @@ TEST_F(IPATest, Open)
     EXPECT_EQ(prover_transcript->get_manifest(), verifier_transcript->get_manifest());
 }
 
+// The fixture's commitment key is too small for the prover's large round paths, so this test uses its own. The first
+// rounds fold more than IPA_TAIL_ROUND_SIZE points, using batched affine additions, and their MSMs are large enough for
+// pippenger_batch_unsafe to compute each of them with a full pippenger
+TEST_F(IPATest, OpenLargePolynomial)
+{
+    using IPA = IPA<Curve>;
+    constexpr size_t n = 4 * scalar_multiplication::BATCH_MSM_PARALLEL_THRESHOLD;
+    static_assert(n / 2 > IPA::IPA_TAIL_ROUND_SIZE);
+    auto ck = std::make_shared<CK>(n);
+    auto vk = std::make_shared<VK>(n, srs::get_grumpkin_crs_factory());
+
+    auto poly = Polynomial::random(n);
+    auto [x, eval] = this->random_eval(poly);
+    Commitment commitment = ck->commit(poly);
+    const OpeningPair<Curve> opening_pair = { x, eval };
+    const OpeningClaim<Curve> opening_claim{ opening_pair, commitment };
+
+    auto prover_transcript = std::make_shared<NativeTranscript>();
+    IPA::compute_opening_proof(ck, { poly, opening_pair }, prover_transcript);
+
+    auto verifier_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+    EXPECT_TRUE(IPA::reduce_verify(vk, opening_claim, verifier_transcript));
+
+    // A proof of a different evaluation must not verify
+    const OpeningClaim<Curve> wrong_claim{ { x, eval + Fr::one() }, commitment };
+    auto wrong_transcript = std::make_shared<NativeTranscript>(prover_transcript->proof_data);
+    EXPECT_FALSE(IPA::reduce_verify(vk, wrong_claim, wrong_transcript));
+}
+
 TEST_F(IPATest, GeminiShplonkIPAWithShift)
 {
     using IPA = IPA<Curve>;
@@ -156,4 +156,185 @@ TYPED_TEST(CommitmentKeyTest, CommitSparseMediumNonZeroStartIndex)
     EXPECT_EQ(sparse_commit_result, commit_result);
 }
 
+/**
+ * @brief Check that batch_commit and batch_commit_sparse agree with committing to each polynomial in turn
+ * @details The set mixes polynomials small enough to be committed to concurrently with one large enough to use the
+ * multi-threaded pippenger, along with empty, sparse and offset polynomials.
+ */
+TYPED_TEST(CommitmentKeyTest, BatchCommit)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 15;
+    const size_t large_size = scalar_multiplication::BATCH_MSM_PARALLEL_THRESHOLD + 1;
+
+    std::vector<Polynomial> polys;
+    polys.emplace_back(Polynomial::random(large_size));
+    polys.emplace_back(Polynomial(0, num_points));
+    polys.emplace_back(Polynomial::random(1));
+    polys.emplace_back(Polynomial::random(257, num_points, 1 << 10));
+    for (size_t size : { 3UL, 100UL, 1000UL, 1UL << 12 }) {
+        polys.emplace_back(Polynomial::random(size));
+    }
+    // A sparse polynomial, with a nonzero start index
+    Polynomial sparse_poly(1 << 13, num_points, 1 << 13);
+    for (size_t i = 0; i < 11; ++i) {
+        sparse_poly.at((1 << 13) + i * i * 31) = Fr::random_element();
+    }
+    polys.emplace_back(std::move(sparse_poly));
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<PolynomialSpan<const Fr>> spans(polys.begin(), polys.end());
+    std::vector<G1> batch_commit_result = key->batch_commit(spans);
+    std::vector<G1> batch_commit_sparse_result = key->batch_commit_sparse(spans);
+
+    ASSERT_EQ(batch_commit_result.size(), polys.size());
+    ASSERT_EQ(batch_commit_sparse_result.size(), polys.size());
+    for (size_t i = 0; i < polys.size(); ++i) {
+        G1 commit_result = key->commit(polys[i]);
+        EXPECT_EQ(batch_commit_result[i], commit_result);
+        EXPECT_EQ(batch_commit_sparse_result[i], commit_result);
+    }
+}
+
+/**
+ * @brief Check that commit_classified agrees with commit for polynomials with various mixes of zero, one, small and
+ * full size coefficients, including one with mostly full size coefficients (where it uses the usual MSM instead)
+ */
+TYPED_TEST(CommitmentKeyTest, CommitClassified)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+    const size_t offset = 1 << 10;
+    auto& engine = numeric::get_debug_randomness();
+
+    // Coefficient i is zero, one, small (of a size depending on i) or full size, in proportions given by the weights
+    const auto random_poly = [&](const size_t size, const size_t start_index, const std::array<size_t, 4>& weights) {
+        Polynomial poly(size, num_points, start_index);
+        const size_t total_weight = weights[0] + weights[1] + weights[2] + weights[3];
+        for (size_t i = start_index; i < start_index + size; ++i) {
+            size_t choice = engine.get_random_uint32() % total_weight;
+            if (choice < weights[0]) {
+                continue;
+            }
+            choice -= weights[0];
+            if (choice < weights[1]) {
+                poly.at(i) = Fr::one();
+                continue;
+            }
+            choice -= weights[1];
+            if (choice < weights[2]) {
+                const size_t bits = 2 + (i % 63);
+                poly.at(i) = Fr(engine.get_random_uint64() >> (64 - bits)) + 2;
+                continue;
+            }
+            poly.at(i) = Fr::random_element();
+        }
+        return poly;
+    };
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    std::vector<Polynomial> polys;
+    polys.emplace_back(random_poly(num_points, 0, { 1, 1, 1, 1 }));
+    polys.emplace_back(random_poly(num_points / 2, offset, { 4, 2, 1, 0 }));
+    polys.emplace_back(random_poly(num_points / 2 - 3, offset, { 1, 0, 8, 1 }));
+    polys.emplace_back(random_poly(num_points, 0, { 1, 1, 1, 8 }));
+    polys.emplace_back(random_poly(num_points, 0, { 0, 1, 0, 0 }));
+    polys.emplace_back(random_poly(100, 0, { 1, 1, 1, 1 }));
+    polys.emplace_back(Polynomial(num_points));
+    // Small coefficients of every size up to 64 bits
+    Polynomial small_poly(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        small_poly.at(i) = Fr(engine.get_random_uint64() >> (i % 63)) + 2;
+    }
+    small_poly.at(0) = Fr(std::numeric_limits<uint64_t>::max());
+    polys.emplace_back(std::move(small_poly));
+
+    for (auto& poly : polys) {
+        G1 commit_result = key->commit(poly);
+        G1 classified_commit_result = key->commit_classified(poly);
+        EXPECT_EQ(classified_commit_result, commit_result);
+    }
+}
+
+/**
+ * @brief Check commit_classified for polynomials whose coefficients are all 2^k - 1, which have the largest signed
+ * digit carry out of the top window for each small scalar size k
+ */
+TYPED_TEST(CommitmentKeyTest, CommitClassifiedAllOnes)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 12;
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    for (size_t k = 2; k <= 64; ++k) {
+        const Fr scalar(std::numeric_limits<uint64_t>::max() >> (64 - k));
+        Polynomial poly(num_points);
+        for (size_t i = 0; i < num_points; ++i) {
+            poly.at(i) = scalar;
+        }
+        G1 commit_result = key->commit(poly);
+        G1 classified_commit_result = key->commit_classified(poly);
+        EXPECT_EQ(classified_commit_result, commit_result) << "k = " << k;
+    }
+}
+
+/**
+ * @brief Check that commit_structured agrees with commit for a polynomial laid out like a structured trace wire, i.e.
+ * zero outside of the populated rows of a set of fixed size blocks
+ */
+TYPED_TEST(CommitmentKeyTest, CommitStructured)
+{
+    using Curve = TypeParam;
+    using CK = CommitmentKey<Curve>;
+    using G1 = Curve::AffineElement;
+    using Fr = Curve::ScalarField;
+    using Polynomial = bb::Polynomial<Fr>;
+
+    const size_t num_points = 1 << 15;
+    // The fixed size and number of populated rows of each block: partially filled, empty, full, tiny and large
+    const std::vector<std::pair<size_t, size_t>> blocks = {
+        { 1 << 10, 100 }, { 1 << 10, 0 }, { 1 << 11, 1 << 11 }, { 1 << 9, 1 }, { 1 << 13, 5000 }, { 1 << 12, 3 }
+    };
+
+    // As for a shiftable wire, the polynomial starts at row 1
+    Polynomial poly(num_points - 1, num_points, 1);
+    std::vector<std::pair<size_t, size_t>> active_ranges;
+    size_t offset = 1;
+    for (const auto& [fixed_size, num_rows] : blocks) {
+        for (size_t i = offset; i < offset + num_rows; ++i) {
+            poly.at(i) = Fr::random_element();
+        }
+        active_ranges.emplace_back(offset, offset + num_rows);
+        offset += fixed_size;
+    }
+
+    auto key = TestFixture::template create_commitment_key<CK>(num_points);
+    G1 commit_result = key->commit(poly);
+    EXPECT_EQ(key->commit_structured(poly, active_ranges), commit_result);
+
+    // The order of the ranges does not matter, nor do ranges that overlap or extend beyond the polynomial
+    std::reverse(active_ranges.begin(), active_ranges.end());
+    active_ranges.emplace_back(0, 50);
+    active_ranges.emplace_back(1 << 14, num_points + 10);
+    EXPECT_EQ(key->commit_structured(poly, active_ranges), commit_result);
+
+    // With no active ranges, the polynomial is taken to be zero
+    EXPECT_TRUE(key->commit_structured(poly, {}).is_point_at_infinity());
+}
+
 } // namespace bb
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/numeric/uint256/uint256.hpp"
+#include <array>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
+#include <span>
+#include <unordered_map>
+#include <vector>
+
+namespace bb::crypto {
+
+/**
+ * @brief Precomputed multiples of a fixed generator, for scalar multiplications without doublings
+ *
+ * @details The scalar k is split with the curve endomorphism into two ~128-bit scalars, k = k1 - k2.λ, where
+ *          λ.[P] = (β.x, y) costs one field multiplication. Each half-scalar is recoded into NUM_WINDOWS signed digits
+ *          d_j in [-2^(w-1), 2^(w-1)], and the table stores d.2^(w.j).[G] for every window j and d in [1, 2^(w-1)].
+ *          Then
+ *
+ *              k.[G] = \sum_j (table[j][d1_j] - λ.table[j][d2_j])
+ *
+ *          costs 2 * NUM_WINDOWS mixed additions and no doublings, against ~128 doublings and ~64 additions for a
+ *          variable-base multiplication with the endomorphism.
+ *
+ *          A table is ~76KB, so tables are built lazily for the generators that are actually used, and cached for the
+ *          lifetime of the process (see `get_cached_tables`). Unlike `generator_data`, the cache is thread-safe.
+ *
+ * @tparam Curve A curve with an endomorphism, whose scalar field modulus is below 2^254
+ */
+template <typename Curve> class FixedBaseTable {
+  public:
+    using AffineElement = typename Curve::AffineElement;
+    using Element = typename Curve::Element;
+    using Fq = typename Curve::BaseField;
+    using Fr = typename Curve::ScalarField;
+
+    static_assert(Fr::modulus.data[3] < 0x4000000000000000ULL, "the endomorphism split needs a <=254-bit modulus");
+
+    static constexpr size_t WINDOW_BITS = 7;
+    static constexpr size_t NUM_ENTRIES_PER_WINDOW = 1UL << (WINDOW_BITS - 1);
+    // the endomorphism scalars are 128 bits, and signed digit recoding can carry into one more bit
+    static constexpr size_t NUM_WINDOWS = (128 + 1 + WINDOW_BITS - 1) / WINDOW_BITS;
+    static constexpr size_t NUM_ENTRIES = NUM_WINDOWS * NUM_ENTRIES_PER_WINDOW;
+
+    // Bound on the memory used by the process-wide cache (~20MB). Generators beyond it fall back to variable-base
+    // multiplication
+    static constexpr size_t MAX_CACHED_TABLES = 256;
+
+    explicit FixedBaseTable(const AffineElement& generator)
+        : table(NUM_ENTRIES)
+    {
+        std::vector<Element> entries(NUM_ENTRIES);
+        Element window_base(generator);
+        for (size_t j = 0; j < NUM_WINDOWS; ++j) {
+            Element* window = &entries[j * NUM_ENTRIES_PER_WINDOW];
+            window[0] = window_base;
+            for (size_t d = 1; d < NUM_ENTRIES_PER_WINDOW; ++d) {
+                window[d] = window[d - 1] + window_base;
+            }
+            // 2^(w-1).B + 2^(w-1).B = 2^w.B, the base of the next window
+            window_base = window[NUM_ENTRIES_PER_WINDOW - 1].dbl();
+        }
+        Element::batch_normalize(entries.data(), NUM_ENTRIES);
+        for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+            table[i] = AffineElement(entries[i].x, entries[i].y);
+        }
+    }
+
+    /**
+     * @brief Add scalar.[G] into accumulator
+     */
+    void accumulate(Element& accumulator, const Fr& scalar) const
+    {
+        const auto [k1, k2] = Fr::split_into_endomorphism_scalars(scalar.from_montgomery_form());
+        const auto k1_digits = compute_signed_digits(k1);
+        const auto k2_digits = compute_signed_digits(k2);
+        const Fq beta = Fq::cube_root_of_unity();
+
+        for (size_t j = 0; j < NUM_WINDOWS; ++j) {
+            if (k1_digits[j] != 0) {
+                AffineElement point = get_entry(j, k1_digits[j]);
+                point.y.self_conditional_negate(k1_digits[j] < 0);
+                accumulator += point;
+            }
+            if (k2_digits[j] != 0) {
+                // -λ.[P] = (β.x, -y)
+                AffineElement point = get_entry(j, k2_digits[j]);
+                point.x *= beta;
+                point.y.self_conditional_negate(k2_digits[j] > 0);
+                accumulator += point;
+            }
+        }
+    }
+
+    /**
+     * @brief Get the tables for a set of generators, building the ones that are not cached yet
+     *
+     * @details Cached tables are looked up under a shared lock, so concurrent callers only contend when a table has to
+     *          be added. Missing tables are built without holding the lock. If another thread adds the same table in
+     *          the meantime, its table is used and ours is discarded.
+     *
+     * @return One pointer per generator. A pointer is null if the cache is full and the generator is not in it
+     */
+    static std::vector<const FixedBaseTable*> get_cached_tables(std::span<const AffineElement> generators)
+    {
+        static std::shared_mutex cache_mutex;
+        static std::unordered_map<AffineElement, std::unique_ptr<const FixedBaseTable>, GeneratorHash> cache;
+
+        std::vector<const FixedBaseTable*> tables(generators.size(), nullptr);
+        std::vector<size_t> missing;
+        size_t cache_size = 0;
+        {
+            std::shared_lock<std::shared_mutex> lock(cache_mutex);
+            for (size_t i = 0; i < generators.size(); ++i) {
+                if (generators[i].is_point_at_infinity()) {
+                    continue;
+                }
+                auto it = cache.find(generators[i]);
+                if (it == cache.end()) {
+                    missing.push_back(i);
+                } else {
+                    tables[i] = it->second.get();
+                }
+            }
+            cache_size = cache.size();
+        }
+
+        // Build each distinct missing table once, as many as could fit in the cache
+        std::unordered_map<AffineElement, std::unique_ptr<const FixedBaseTable>, GeneratorHash> built;
+        for (size_t i : missing) {
+            if (cache_size + built.size() >= MAX_CACHED_TABLES) {
+                break;
+            }
+            if (!built.contains(generators[i])) {
+                built.emplace(generators[i], std::make_unique<const FixedBaseTable>(generators[i]));
+            }
+        }
+        if (built.empty()) {
+            return tables;
+        }
+
+        std::unique_lock<std::shared_mutex> lock(cache_mutex);
+        for (size_t i : missing) {
+            auto it = cache.find(generators[i]);
+            if (it == cache.end()) {
+                auto table = built.find(generators[i]);
+                if (table == built.end() || cache.size() >= MAX_CACHED_TABLES) {
+                    continue;
+                }
+                it = cache.emplace(generators[i], std::move(table->second)).first;
+            }
+            tables[i] = it->second.get();
+        }
+        return tables;
+    }
+
+  private:
+    // Hashes the coordinates reduced once, as AffineElement's equality compares them
+    struct GeneratorHash {
+        size_t operator()(const AffineElement& generator) const
+        {
+            const Fq x = generator.x.reduce_once();
+            const Fq y = generator.y.reduce_once();
+            return static_cast<size_t>(x.data[0] ^ (y.data[0] << 1));
+        }
+    };
+
+    std::vector<AffineElement> table;
+
+    const AffineElement& get_entry(const size_t window, const int32_t digit) const
+    {
+        const auto magnitude = static_cast<size_t>(digit < 0 ? -digit : digit);
+        return table[window * NUM_ENTRIES_PER_WINDOW + magnitude - 1];
+    }
+
+    static std::array<int32_t, NUM_WINDOWS> compute_signed_digits(const std::array<uint64_t, 2>& limbs)
+    {
+        const uint256_t scalar(limbs[0], limbs[1], 0, 0);
+        std::array<int32_t, NUM_WINDOWS> digits;
+        uint64_t carry = 0;
+        for (size_t j = 0; j < NUM_WINDOWS; ++j) {
+            const uint64_t digit = scalar.slice(j * WINDOW_BITS, (j + 1) * WINDOW_BITS).data[0] + carry;
+            // map digits above 2^(w-1) to digit - 2^w, and carry 2^w into the next window
+            carry = static_cast<uint64_t>(digit > NUM_ENTRIES_PER_WINDOW);
+            digits[j] = static_cast<int32_t>(digit) - static_cast<int32_t>(carry << WINDOW_BITS);
+        }
+        ASSERT(carry == 0);
+        return digits;
+    }
+};
+
+/**
+ * @brief Compute \sum_i scalars[i].[generators[i]] for fixed generators, using cached `FixedBaseTable`s
+ *
+ * @details Large batches are split between threads, each with its own accumulator.
+ */
+template <typename Curve>
+typename Curve::Element fixed_base_msm(std::span<const typename Curve::ScalarField> scalars,
+                                       std::span<const typename Curve::AffineElement> generators)
+{
+    using Element = typename Curve::Element;
+    ASSERT(scalars.size() == generators.size());
+
+    const auto tables = FixedBaseTable<Curve>::get_cached_tables(generators);
+
+    const auto accumulators = parallel_for_heuristic(
+        scalars.size(),
+        Element::infinity(),
+        [&](size_t i, Element& accumulator) {
+            if (tables[i] != nullptr) {
+                tables[i]->accumulate(accumulator, scalars[i]);
+            } else {
+                accumulator += Element(generators[i]) * scalars[i];
+            }
+        },
+        FixedBaseTable<Curve>::NUM_WINDOWS * 2 * thread_heuristics::GE_ADDITION_COST);
+
+    Element result = Element::infinity();
+    for (const auto& accumulator : accumulators) {
+        result += accumulator;
+    }
+    return result;
+}
+
+} // namespace bb::crypto
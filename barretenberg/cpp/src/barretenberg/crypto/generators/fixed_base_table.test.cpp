@@ -0,0 +1,105 @@
+#include "fixed_base_table.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+#include <thread>
+#include <vector>
+
+namespace bb::crypto {
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+}
+
+template <typename Curve> class FixedBaseTableTest : public ::testing::Test {};
+
+using Curves = ::testing::Types<curve::BN254, curve::Grumpkin>;
+TYPED_TEST_SUITE(FixedBaseTableTest, Curves);
+
+TYPED_TEST(FixedBaseTableTest, MulMatchesVariableBaseMul)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Element = typename TypeParam::Element;
+    using AffineElement = typename TypeParam::AffineElement;
+
+    const AffineElement generator = AffineElement::random_element(&engine);
+    const FixedBaseTable<TypeParam> table(generator);
+
+    // include the edge cases of the signed digit recoding
+    std::vector<Fr> scalars{ 0, 1, -Fr(1), Fr(64), Fr(65), Fr(127), Fr(128), Fr::cube_root_of_unity() };
+    for (size_t i = 0; i < 32; ++i) {
+        scalars.emplace_back(Fr::random_element(&engine));
+    }
+    for (const auto& scalar : scalars) {
+        Element result = Element::infinity();
+        table.accumulate(result, scalar);
+        EXPECT_EQ(AffineElement(result), AffineElement(Element(generator) * scalar));
+    }
+}
+
+TYPED_TEST(FixedBaseTableTest, MsmMatchesNaiveMsm)
+{
+    using Fr = typename TypeParam::ScalarField;
+    using Element = typename TypeParam::Element;
+    using AffineElement = typename TypeParam::AffineElement;
+
+    // enough terms to be split between threads, with repeated generators and a generator at infinity
+    const size_t num_generators = 8;
+    const size_t num_terms = 200;
+    std::vector<AffineElement> distinct_generators(num_generators);
+    for (auto& generator : distinct_generators) {
+        generator = AffineElement::random_element(&engine);
+    }
+    distinct_generators[0].self_set_infinity();
+
+    std::vector<Fr> scalars(num_terms);
+    std::vector<AffineElement> generators(num_terms);
+    Element expected = Element::infinity();
+    for (size_t i = 0; i < num_terms; ++i) {
+        scalars[i] = Fr::random_element(&engine);
+        generators[i] = distinct_generators[i % num_generators];
+        expected += Element(generators[i]) * scalars[i];
+    }
+
+    Element result = fixed_base_msm<TypeParam>(scalars, generators);
+    EXPECT_EQ(AffineElement(result), AffineElement(expected));
+}
+
+TYPED_TEST(FixedBaseTableTest, CachedTablesAreSharedBetweenThreads)
+{
+    using Fq = typename TypeParam::BaseField;
+    using AffineElement = typename TypeParam::AffineElement;
+
+    std::vector<AffineElement> generators(4);
+    for (auto& generator : generators) {
+        generator = AffineElement::random_element(&engine);
+    }
+    // the same point with an unreduced x coordinate must find the same table
+    AffineElement unreduced = generators[0];
+    const uint256_t x = uint256_t(unreduced.x.data[0], unreduced.x.data[1], unreduced.x.data[2], unreduced.x.data[3]) +
+                        Fq::modulus;
+    unreduced.x.data[0] = x.data[0];
+    unreduced.x.data[1] = x.data[1];
+    unreduced.x.data[2] = x.data[2];
+    unreduced.x.data[3] = x.data[3];
+    generators.push_back(unreduced);
+
+    std::vector<std::vector<const FixedBaseTable<TypeParam>*>> results(4);
+    std::vector<std::thread> threads;
+    for (auto& result : results) {
+        threads.emplace_back([&]() { result = FixedBaseTable<TypeParam>::get_cached_tables(generators); });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    const auto tables = FixedBaseTable<TypeParam>::get_cached_tables(generators);
+    EXPECT_NE(tables[0], nullptr);
+    EXPECT_EQ(tables[0], tables[4]);
+    for (const auto& result : results) {
+        EXPECT_EQ(result, tables);
+    }
+}
+
+} // namespace bb::crypto
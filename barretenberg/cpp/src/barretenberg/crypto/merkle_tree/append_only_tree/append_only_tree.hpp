@@ -6,12 +6,17 @@
 #include "barretenberg/common/thread_pool.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/numeric/bitop/pow.hpp"
+#include <algorithm>
+#include <atomic>
 #include <exception>
 #include <functional>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 
@@ -33,7 +38,9 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
     using AppendCompletionCallback = std::function<void(const TypedResponse<AddDataResponse>&)>;
     using MetaDataCallback = std::function<void(const TypedResponse<TreeMetaResponse>&)>;
     using HashPathCallback = std::function<void(const TypedResponse<GetSiblingPathResponse>&)>;
+    using HashPathsCallback = std::function<void(const TypedResponse<GetSiblingPathsResponse>&)>;
     using FindLeafCallback = std::function<void(const TypedResponse<FindLeafIndexResponse>&)>;
+    using FindLeafIndicesCallback = std::function<void(const TypedResponse<FindLeafIndicesResponse>&)>;
     using GetLeafCallback = std::function<void(const TypedResponse<GetLeafResponse>&)>;
     using CommitCallback = std::function<void(const Response&)>;
     using RollbackCallback = std::function<void(const Response&)>;
@@ -68,6 +75,17 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
      */
     void get_sibling_path(const index_t& index, const HashPathCallback& on_completion, bool includeUncommitted) const;
 
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root. Each node shared by multiple
+     * paths is only read once. The work is split across the thread pool, with each job using a single read transaction
+     * @param indices The indices at which to read the sibling paths
+     * @param includeUncommitted Whether to include uncommitted changes
+     * @param on_completion Callback to be called on completion
+     */
+    void get_sibling_paths(const std::vector<index_t>& indices,
+                           bool includeUncommitted,
+                           const HashPathsCallback& on_completion) const;
+
     /**
      * @brief Get the subtree sibling path object
      *
@@ -120,6 +138,60 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
                               bool includeUncommitted,
                               const FindLeafCallback& on_completion) const;
 
+    /**
+     * @brief Returns the index of each of the provided leaves in the tree, the work is split across the thread pool
+     */
+    void find_leaf_indices(const std::vector<fr>& leaves,
+                           bool includeUncommitted,
+                           const FindLeafIndicesCallback& on_completion) const;
+
+    /**
+     * @brief Returns the tree meta data as of the given historic block
+     * @param blockNumber The block at which to read the meta data
+     * @param on_completion Callback to be called on completion
+     */
+    void get_meta_data_at_block(const index_t& blockNumber, const MetaDataCallback& on_completion) const;
+
+    /**
+     * @brief Returns the sibling path from the leaf at the given index to the root as of the given historic block
+     * @param index The index at which to read the sibling path
+     * @param blockNumber The block at which to read the sibling path
+     * @param on_completion Callback to be called on completion
+     */
+    void get_sibling_path_at_block(const index_t& index,
+                                   const index_t& blockNumber,
+                                   const HashPathCallback& on_completion) const;
+
+    /**
+     * @brief Returns the sibling paths from the leaves at the given indices to the root as of the given historic block
+     */
+    void get_sibling_paths_at_block(const std::vector<index_t>& indices,
+                                    const index_t& blockNumber,
+                                    const HashPathsCallback& on_completion) const;
+
+    /**
+     * @brief Returns the leaf value at the provided index as of the given historic block
+     */
+    void get_leaf_at_block(const index_t& index,
+                           const index_t& blockNumber,
+                           const GetLeafCallback& on_completion) const;
+
+    /**
+     * @brief Returns the index of the provided leaf as of the given historic block, only considering indices from
+     * start_index
+     */
+    void find_leaf_index_from_at_block(const fr& leaf,
+                                       index_t start_index,
+                                       const index_t& blockNumber,
+                                       const FindLeafCallback& on_completion) const;
+
+    /**
+     * @brief Returns the index of each of the provided leaves as of the given historic block
+     */
+    void find_leaf_indices_at_block(const std::vector<fr>& leaves,
+                                    const index_t& blockNumber,
+                                    const FindLeafIndicesCallback& on_completion) const;
+
     /**
      * @brief Commit the tree to the backing store
      */
@@ -138,6 +210,40 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
   protected:
     using ReadTransaction = typename Store::ReadTransaction;
     using ReadTransactionPtr = typename Store::ReadTransactionPtr;
+
+    // The minimum number of items handled by each job of a batched request
+    static constexpr size_t MIN_BATCH_CHUNK_SIZE = 32;
+
+    /**
+     * @brief Splits a batch of items into contiguous chunks, each processed by a job on the thread pool. The response
+     * is reported once every chunk has been processed. It fails if any chunk fails
+     * @details A single read transaction is created by the caller and shared by the chunks, so that the whole response
+     * reflects one committed state, even if a commit completes while the chunks are being processed
+     * @param response The response, sized to hold the results of all items. Each chunk writes only to its own items
+     * @param num_items The number of items in the batch
+     * @param process Processes the items in the range [start, end) using the shared read transaction
+     * @param on_completion Callback to be called on completion
+     */
+    template <typename ResponseType>
+    void execute_batched(
+        ResponseType response,
+        size_t num_items,
+        const std::function<void(size_t start, size_t end, ReadTransaction& tx, ResponseType& response)>& process,
+        const std::function<void(const TypedResponse<ResponseType>&)>& on_completion) const;
+
+    /**
+     * @brief Builds the sibling paths for the leaves order[start]...order[end - 1], where order sorts the indices. As
+     * the leaves are sorted, any node shared between paths is needed by adjacent leaves and is only read once
+     */
+    template <typename ReadNodeFunc>
+    void get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                    const std::vector<size_t>& order,
+                                    size_t start,
+                                    size_t end,
+                                    std::vector<fr_sibling_path>& paths,
+                                    const ReadNodeFunc& get_element) const;
+
+    static std::vector<size_t> get_sorted_order(const std::vector<index_t>& indices);
     fr get_element_or_zero(uint32_t level, const index_t& index, ReadTransaction& tx, bool includeUncommitted) const;
 
     void write_node(uint32_t level, const index_t& index, const fr& value);
@@ -146,6 +252,15 @@ template <typename Store, typename HashingPolicy> class AppendOnlyTree {
                                   ReadTransaction& tx,
                                   bool includeUncommitted) const;
 
+    fr get_element_or_zero_at_block(uint32_t level,
+                                    const index_t& index,
+                                    const index_t& blockNumber,
+                                    ReadTransaction& tx) const;
+    std::pair<bool, fr> read_node_at_block(uint32_t level,
+                                           const index_t& index,
+                                           const index_t& blockNumber,
+                                           ReadTransaction& tx) const;
+
     void add_values_internal(std::shared_ptr<std::vector<fr>> values,
                              fr& new_root,
                              index_t& new_size,
@@ -190,10 +305,11 @@ AppendOnlyTree<Store, HashingPolicy>::AppendOnlyTree(Store& store, ThreadPool& w
     }
     zero_hashes_[0] = current;
 
-    if (stored_size == 0) {
-        // if the tree is empty then we want to write the initial root
+    // if the tree is empty then we want to write the initial root, unless it is a fork, which must not write to the
+    // committed state it reads through its snapshot
+    if (stored_size == 0 && !store_.has_snapshot()) {
         store_.put_meta(0, current);
-        store_.commit();
+        store_.commit_genesis_state(workers_);
     }
     max_size_ = numeric::pow64(2, depth_);
 }
@@ -208,6 +324,9 @@ void AppendOnlyTree<Store, HashingPolicy>::get_meta_data(bool includeUncommitted
                 ReadTransactionPtr tx = store_.create_read_transaction();
                 store_.get_meta(response.inner.size, response.inner.root, *tx, includeUncommitted);
                 response.inner.depth = depth_;
+                auto cacheStats = store_.get_node_cache_stats();
+                response.inner.nodeCacheHits = cacheStats.hits;
+                response.inner.nodeCacheMisses = cacheStats.misses;
             },
             on_completion);
     };
@@ -237,6 +356,126 @@ void AppendOnlyTree<Store, HashingPolicy>::get_sibling_path(const index_t& index
     workers_.enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::get_sibling_paths(const std::vector<index_t>& indices,
+                                                             bool includeUncommitted,
+                                                             const HashPathsCallback& on_completion) const
+{
+    auto leaf_indices = std::make_shared<std::vector<index_t>>(indices);
+    auto order = std::make_shared<std::vector<size_t>>(get_sorted_order(indices));
+    GetSiblingPathsResponse initial;
+    initial.paths.resize(indices.size());
+    execute_batched<GetSiblingPathsResponse>(
+        std::move(initial),
+        indices.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, GetSiblingPathsResponse& response) {
+            get_sibling_paths_internal(
+                *leaf_indices, *order, start, end, response.paths, [&](uint32_t level, const index_t& index) {
+                    return get_element_or_zero(level, index, tx, includeUncommitted);
+                });
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+template <typename ReadNodeFunc>
+void AppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_internal(const std::vector<index_t>& indices,
+                                                                      const std::vector<size_t>& order,
+                                                                      size_t start,
+                                                                      size_t end,
+                                                                      std::vector<fr_sibling_path>& paths,
+                                                                      const ReadNodeFunc& get_element) const
+{
+    std::vector<index_t> current_indices(end - start);
+    for (size_t i = start; i < end; ++i) {
+        current_indices[i - start] = indices[order[i]];
+        paths[order[i]].reserve(depth_);
+    }
+    for (uint32_t level = depth_; level > 0; --level) {
+        std::optional<index_t> previous_sibling;
+        fr sibling;
+        for (size_t i = start; i < end; ++i) {
+            index_t& current_index = current_indices[i - start];
+            index_t sibling_index = current_index ^ 1;
+            if (previous_sibling != sibling_index) {
+                sibling = get_element(level, sibling_index);
+                previous_sibling = sibling_index;
+            }
+            paths[order[i]].emplace_back(sibling);
+            current_index >>= 1;
+        }
+    }
+}
+
+template <typename Store, typename HashingPolicy>
+std::vector<size_t> AppendOnlyTree<Store, HashingPolicy>::get_sorted_order(const std::vector<index_t>& indices)
+{
+    std::vector<size_t> order(indices.size());
+    for (size_t i = 0; i < order.size(); ++i) {
+        order[i] = i;
+    }
+    std::sort(order.begin(), order.end(), [&](size_t a, size_t b) { return indices[a] < indices[b]; });
+    return order;
+}
+
+template <typename Store, typename HashingPolicy>
+template <typename ResponseType>
+void AppendOnlyTree<Store, HashingPolicy>::execute_batched(
+    ResponseType response,
+    size_t num_items,
+    const std::function<void(size_t start, size_t end, ReadTransaction& tx, ResponseType& response)>& process,
+    const std::function<void(const TypedResponse<ResponseType>&)>& on_completion) const
+{
+    struct BatchState {
+        TypedResponse<ResponseType> response;
+        std::shared_ptr<ReadTransaction> tx;
+        std::atomic<size_t> remaining;
+        std::mutex error_mutex;
+    };
+    size_t num_threads = std::max<size_t>(workers_.num_threads(), 1);
+    size_t chunk_size = std::max(MIN_BATCH_CHUNK_SIZE, (num_items + num_threads - 1) / num_threads);
+    size_t num_chunks = std::max<size_t>((num_items + chunk_size - 1) / chunk_size, 1);
+
+    auto state = std::make_shared<BatchState>();
+    state->response.inner = std::move(response);
+    try {
+        state->tx = store_.create_read_transaction();
+    } catch (std::exception& e) {
+        state->response.success = false;
+        state->response.message = e.what();
+        workers_.enqueue([=]() {
+            try {
+                on_completion(state->response);
+            } catch (std::exception&) {
+            }
+        });
+        return;
+    }
+    state->remaining = num_chunks;
+    for (size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        size_t start = chunk * chunk_size;
+        size_t end = std::min(start + chunk_size, num_items);
+        auto job = [=]() {
+            try {
+                process(start, end, *state->tx, state->response.inner);
+            } catch (std::exception& e) {
+                std::lock_guard<std::mutex> lock(state->error_mutex);
+                state->response.success = false;
+                state->response.message = e.what();
+            }
+            // The last chunk to complete ends the read transaction and reports the response
+            if (state->remaining.fetch_sub(1) == 1) {
+                state->tx.reset();
+                try {
+                    on_completion(state->response);
+                } catch (std::exception&) {
+                }
+            }
+        };
+        workers_.enqueue(job);
+    }
+}
+
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::get_subtree_sibling_path(const uint32_t subtree_depth,
                                                                     const HashPathCallback& on_completion,
@@ -347,6 +586,160 @@ void AppendOnlyTree<Store, HashingPolicy>::find_leaf_index_from(const fr& leaf,
     workers_.enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::find_leaf_indices(const std::vector<fr>& leaves,
+                                                             bool includeUncommitted,
+                                                             const FindLeafIndicesCallback& on_completion) const
+{
+    auto values = std::make_shared<std::vector<fr>>(leaves);
+    FindLeafIndicesResponse initial;
+    initial.leaf_indices.resize(leaves.size());
+    execute_batched<FindLeafIndicesResponse>(
+        std::move(initial),
+        leaves.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, FindLeafIndicesResponse& response) {
+            for (size_t i = start; i < end; ++i) {
+                response.leaf_indices[i] = store_.find_leaf_index_from((*values)[i], 0, tx, includeUncommitted);
+            }
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::get_meta_data_at_block(const index_t& blockNumber,
+                                                                  const MetaDataCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<TreeMetaResponse>(
+            [=, this](TypedResponse<TreeMetaResponse>& response) {
+                ReadTransactionPtr tx = store_.create_read_transaction();
+                store_.get_block_meta(blockNumber, response.inner.size, response.inner.root, *tx);
+                response.inner.depth = depth_;
+                auto cacheStats = store_.get_node_cache_stats();
+                response.inner.nodeCacheHits = cacheStats.hits;
+                response.inner.nodeCacheMisses = cacheStats.misses;
+            },
+            on_completion);
+    };
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::get_sibling_path_at_block(const index_t& index,
+                                                                     const index_t& blockNumber,
+                                                                     const HashPathCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetSiblingPathResponse>(
+            [=, this](TypedResponse<GetSiblingPathResponse>& response) {
+                ReadTransactionPtr tx = store_.create_read_transaction();
+                // Validates that the block is retained
+                index_t size = 0;
+                bb::fr root;
+                store_.get_block_meta(blockNumber, size, root, *tx);
+                index_t current_index = index;
+                for (uint32_t level = depth_; level > 0; --level) {
+                    bool is_right = static_cast<bool>(current_index & 0x01);
+                    fr sibling = is_right ? get_element_or_zero_at_block(level, current_index - 1, blockNumber, *tx)
+                                          : get_element_or_zero_at_block(level, current_index + 1, blockNumber, *tx);
+                    response.inner.path.emplace_back(sibling);
+                    current_index >>= 1;
+                }
+            },
+            on_completion);
+    };
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_at_block(const std::vector<index_t>& indices,
+                                                                      const index_t& blockNumber,
+                                                                      const HashPathsCallback& on_completion) const
+{
+    auto leaf_indices = std::make_shared<std::vector<index_t>>(indices);
+    auto order = std::make_shared<std::vector<size_t>>(get_sorted_order(indices));
+    GetSiblingPathsResponse initial;
+    initial.paths.resize(indices.size());
+    execute_batched<GetSiblingPathsResponse>(
+        std::move(initial),
+        indices.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, GetSiblingPathsResponse& response) {
+            // Validates that the block is retained
+            index_t size = 0;
+            bb::fr root;
+            store_.get_block_meta(blockNumber, size, root, tx);
+            get_sibling_paths_internal(
+                *leaf_indices, *order, start, end, response.paths, [&](uint32_t level, const index_t& index) {
+                    return get_element_or_zero_at_block(level, index, blockNumber, tx);
+                });
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::get_leaf_at_block(const index_t& index,
+                                                             const index_t& blockNumber,
+                                                             const GetLeafCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetLeafResponse>(
+            [=, this](TypedResponse<GetLeafResponse>& response) {
+                ReadTransactionPtr tx = store_.create_read_transaction();
+                index_t size = 0;
+                bb::fr root;
+                store_.get_block_meta(blockNumber, size, root, *tx);
+                auto leaf = index < size ? read_node_at_block(depth_, index, blockNumber, *tx)
+                                         : std::make_pair(false, fr::zero());
+                response.success = leaf.first;
+                if (leaf.first) {
+                    response.inner.leaf = leaf.second;
+                }
+            },
+            on_completion);
+    };
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::find_leaf_index_from_at_block(const fr& leaf,
+                                                                         index_t start_index,
+                                                                         const index_t& blockNumber,
+                                                                         const FindLeafCallback& on_completion) const
+{
+    auto job = [=, this]() -> void {
+        execute_and_report<FindLeafIndexResponse>(
+            [=, this](TypedResponse<FindLeafIndexResponse>& response) {
+                ReadTransactionPtr tx = store_.create_read_transaction();
+                std::optional<index_t> leaf_index =
+                    store_.find_leaf_index_from_at_block(leaf, start_index, blockNumber, *tx);
+                response.success = leaf_index.has_value();
+                if (response.success) {
+                    response.inner.leaf_index = leaf_index.value();
+                }
+            },
+            on_completion);
+    };
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void AppendOnlyTree<Store, HashingPolicy>::find_leaf_indices_at_block(
+    const std::vector<fr>& leaves, const index_t& blockNumber, const FindLeafIndicesCallback& on_completion) const
+{
+    auto values = std::make_shared<std::vector<fr>>(leaves);
+    FindLeafIndicesResponse initial;
+    initial.leaf_indices.resize(leaves.size());
+    execute_batched<FindLeafIndicesResponse>(
+        std::move(initial),
+        leaves.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, FindLeafIndicesResponse& response) {
+            for (size_t i = start; i < end; ++i) {
+                response.leaf_indices[i] = store_.find_leaf_index_from_at_block((*values)[i], 0, blockNumber, tx);
+            }
+        },
+        on_completion);
+}
+
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::add_value(const fr& value, const AppendCompletionCallback& on_completion)
 {
@@ -379,7 +772,7 @@ void AppendOnlyTree<Store, HashingPolicy>::add_values_internal(const std::vector
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::commit(const CommitCallback& on_completion)
 {
-    auto job = [=, this]() { execute_and_report([=, this]() { store_.commit(); }, on_completion); };
+    auto job = [=, this]() { execute_and_report([=, this]() { store_.commit(workers_); }, on_completion); };
     workers_.enqueue(job);
 }
 
@@ -472,12 +865,23 @@ fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero(uint32_t level,
     return zero_hashes_[level];
 }
 
+template <typename Store, typename HashingPolicy>
+fr AppendOnlyTree<Store, HashingPolicy>::get_element_or_zero_at_block(uint32_t level,
+                                                                      const index_t& index,
+                                                                      const index_t& blockNumber,
+                                                                      ReadTransaction& tx) const
+{
+    const std::pair<bool, fr> read_data = read_node_at_block(level, index, blockNumber, tx);
+    if (read_data.first) {
+        return read_data.second;
+    }
+    return zero_hashes_[level];
+}
+
 template <typename Store, typename HashingPolicy>
 void AppendOnlyTree<Store, HashingPolicy>::write_node(uint32_t level, const index_t& index, const fr& value)
 {
-    std::vector<uint8_t> buf;
-    write(buf, value);
-    store_.put_node(level, index, buf);
+    store_.put_node(level, index, value);
 }
 
 template <typename Store, typename HashingPolicy>
@@ -486,12 +890,25 @@ std::pair<bool, fr> AppendOnlyTree<Store, HashingPolicy>::read_node(uint32_t lev
                                                                     ReadTransaction& tx,
                                                                     bool includeUncommitted) const
 {
-    std::vector<uint8_t> buf;
-    bool available = store_.get_node(level, index, buf, tx, includeUncommitted);
+    fr value;
+    bool available = store_.get_node(level, index, value, tx, includeUncommitted);
+    if (!available) {
+        return std::make_pair(false, fr::zero());
+    }
+    return std::make_pair(true, value);
+}
+
+template <typename Store, typename HashingPolicy>
+std::pair<bool, fr> AppendOnlyTree<Store, HashingPolicy>::read_node_at_block(uint32_t level,
+                                                                             const index_t& index,
+                                                                             const index_t& blockNumber,
+                                                                             ReadTransaction& tx) const
+{
+    fr value;
+    bool available = store_.get_node_at_block(level, index, blockNumber, value, tx);
     if (!available) {
         return std::make_pair(false, fr::zero());
     }
-    fr value = from_buffer<fr>(buf, 0);
     return std::make_pair(true, value);
 }
 
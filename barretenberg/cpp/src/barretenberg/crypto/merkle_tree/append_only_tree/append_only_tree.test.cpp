@@ -424,6 +424,73 @@ TEST_F(PersistedAppendOnlyTreeTest, can_commit_and_restore)
     }
 }
 
+TEST_F(PersistedAppendOnlyTreeTest, abandoned_commit_leaves_uncommitted_state)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    ThreadPool pool(1);
+    TreeType tree(store, pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    add_value(tree, 30);
+    memdb.update_element(0, 30);
+    commit_tree(tree);
+
+    add_value(tree, 30);
+    add_value(tree, 10);
+    memdb.update_element(1, 30);
+    memdb.update_element(2, 10);
+
+    // Prepare a commit and abandon it, as happens when committing several trees together and one of them fails
+    store.prepare_commit(pool);
+
+    check_size(tree, 3);
+    check_root(tree, memdb.root());
+    check_size(tree, 1, false);
+    check_find_leaf_index_from(tree, 30, 1, 1, true);
+
+    // The uncommitted state can still be committed as the next block
+    commit_tree(tree);
+    check_size(tree, 3, false);
+    check_root(tree, memdb.root(), false);
+    check_find_leaf_index_from(tree, 30, 0, 0, true, false);
+    check_find_leaf_index_from(tree, 30, 1, 1, true, false);
+    check_find_leaf_index_from(tree, 10, 0, 2, true, false);
+}
+
+TEST_F(PersistedAppendOnlyTreeTest, fork_of_an_empty_tree_does_not_write_the_initial_state)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    ThreadPool pool(1);
+    TreeType tree(store, pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+    bb::fr initial_root = memdb.root();
+
+    // Take a snapshot of the empty tree, then commit to it
+    LMDBReadTransaction::Ptr snapshot = db.create_read_transaction();
+    add_value(tree, 30);
+    memdb.update_element(0, 30);
+    commit_tree(tree);
+
+    // A tree reading the snapshot sees the empty tree, and leaves the committed state alone
+    Store fork_store(name, depth, db, 0, snapshot.get());
+    TreeType fork(fork_store, pool);
+    check_size(fork, 0, false);
+    check_root(fork, initial_root, false);
+
+    check_size(tree, 1, false);
+    check_root(tree, memdb.root(), false);
+    Store restored_store(name, depth, db);
+    TreeType restored(restored_store, pool);
+    check_size(restored, 1, false);
+    check_root(restored, memdb.root(), false);
+}
+
 TEST_F(PersistedAppendOnlyTreeTest, test_size)
 {
     constexpr size_t depth = 10;
@@ -694,3 +761,104 @@ TEST_F(PersistedAppendOnlyTreeTest, returns_sibling_path)
         },
         true);
 }
+
+TEST_F(PersistedAppendOnlyTreeTest, can_get_multiple_sibling_paths)
+{
+    constexpr size_t depth = 8;
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    ThreadPool pool(4);
+    TreeType tree(store, pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    // Values are appended as subtrees, so add them in aligned power of 2 batches
+    size_t size = 0;
+    for (size_t batch_size : std::vector<size_t>{ 128, 64 }) {
+        std::vector<fr> values;
+        for (size_t i = 0; i < batch_size; ++i, ++size) {
+            values.emplace_back(VALUES[size]);
+            memdb.update_element(size, VALUES[size]);
+        }
+        add_values(tree, values);
+    }
+
+    // unordered, with duplicates and indices beyond the size of the tree
+    std::vector<index_t> indices;
+    for (size_t i = 0; i < 150; ++i) {
+        indices.push_back((i * 37) % 256);
+    }
+    indices.push_back(5);
+    indices.push_back(5);
+
+    Signal signal;
+    tree.get_sibling_paths(indices, true, [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+        EXPECT_EQ(response.success, true);
+        EXPECT_EQ(response.inner.paths.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            EXPECT_EQ(response.inner.paths[i], memdb.get_sibling_path(indices[i]));
+        }
+        signal.signal_level();
+    });
+    signal.wait_for_level();
+
+    Signal find_signal;
+    std::vector<fr> leaves = { VALUES[10], VALUES[191], fr(-1), VALUES[0] };
+    tree.find_leaf_indices(leaves, true, [&](const TypedResponse<FindLeafIndicesResponse>& response) {
+        EXPECT_EQ(response.success, true);
+        std::vector<std::optional<index_t>> expected = { 10, 191, std::nullopt, 0 };
+        EXPECT_EQ(response.inner.leaf_indices, expected);
+        find_signal.signal_level();
+    });
+    find_signal.wait_for_level();
+}
+
+TEST_F(PersistedAppendOnlyTreeTest, batched_reads_see_a_single_committed_state)
+{
+    constexpr size_t depth = 8;
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    ThreadPool pool(2);
+    TreeType tree(store, pool);
+    MemoryTree<Poseidon2HashPolicy> memdb(depth);
+
+    std::vector<fr> values(VALUES.begin(), VALUES.begin() + 64);
+    for (size_t i = 0; i < values.size(); ++i) {
+        memdb.update_element(i, values[i]);
+    }
+    add_values(tree, values);
+    commit_tree(tree);
+
+    // Enough indices for a chunk per thread
+    std::vector<index_t> indices;
+    std::vector<fr_sibling_path> expected_paths;
+    for (index_t i = 0; i < 128; ++i) {
+        indices.push_back(i);
+        expected_paths.push_back(memdb.get_sibling_path(i));
+    }
+
+    // Hold up the thread pool so that none of the chunks runs until after another store has committed
+    Signal blocker;
+    for (size_t i = 0; i < 2; ++i) {
+        pool.enqueue([&]() { blocker.wait_for_level(); });
+    }
+    Signal signal;
+    tree.get_sibling_paths(indices, false, [&](const TypedResponse<GetSiblingPathsResponse>& response) {
+        EXPECT_EQ(response.success, true);
+        EXPECT_EQ(response.inner.paths, expected_paths);
+        signal.signal_level();
+    });
+
+    {
+        Store other_store(name, depth, db);
+        ThreadPool other_pool(1);
+        TreeType other_tree(other_store, other_pool);
+        add_values(other_tree, std::vector<fr>(VALUES.begin() + 64, VALUES.begin() + 128));
+        commit_tree(other_tree);
+        check_size(other_tree, 128, false);
+    }
+
+    blocker.signal_level();
+    signal.wait_for_level();
+}
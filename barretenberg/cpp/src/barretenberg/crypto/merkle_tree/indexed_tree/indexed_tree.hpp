@@ -15,9 +15,11 @@
 #include <exception>
 #include <functional>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <stdexcept>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -39,6 +41,7 @@ template <typename Store, typename HashingPolicy> class IndexedTree : public App
     using AddCompletionCallback = std::function<void(const TypedResponse<AddIndexedDataResponse<LeafValueType>>&)>;
     using LeafCallback = std::function<void(const TypedResponse<GetIndexedLeafResponse<LeafValueType>>&)>;
     using FindLowLeafCallback = std::function<void(const TypedResponse<std::pair<bool, index_t>>&)>;
+    using FindLowLeavesCallback = std::function<void(const TypedResponse<FindLowLeavesResponse>&)>;
 
     IndexedTree(Store& store, ThreadPool& workers, index_t initial_size);
     IndexedTree(IndexedTree const& other) = delete;
@@ -91,7 +94,62 @@ template <typename Store, typename HashingPolicy> class IndexedTree : public App
      */
     void find_low_leaf(const fr& leaf_key, bool includeUncommitted, const FindLowLeafCallback& on_completion) const;
 
+    /**
+     * @brief Find the index of each of the provided leaf values, the work is split across the thread pool
+     */
+    void find_leaf_indices(
+        const std::vector<LeafValueType>& leaves,
+        bool includeUncommitted,
+        const AppendOnlyTree<Store, HashingPolicy>::FindLeafIndicesCallback& on_completion) const;
+
+    /**
+     * @brief Find the low leaf of each of the provided keys, the work is split across the thread pool
+     */
+    void find_low_leaves(const std::vector<fr>& leaf_keys,
+                         bool includeUncommitted,
+                         const FindLowLeavesCallback& on_completion) const;
+
+    /**
+     * @brief Returns the leaf at the given index as of the given historic block
+     */
+    void get_leaf_at_block(const index_t& index, const index_t& blockNumber, const LeafCallback& completion) const;
+
+    /**
+     * @brief Find the index of the provided leaf value as of the given historic block, only considers indices beyond
+     * the value provided
+     */
+    void find_leaf_index_from_at_block(
+        const LeafValueType& leaf,
+        index_t start_index,
+        const index_t& blockNumber,
+        const AppendOnlyTree<Store, HashingPolicy>::FindLeafCallback& on_completion) const;
+
+    /**
+     * @brief Find the leaf with the value immediately lower then the value provided as of the given historic block
+     */
+    void find_low_leaf_at_block(const fr& leaf_key,
+                                const index_t& blockNumber,
+                                const FindLowLeafCallback& on_completion) const;
+
+    /**
+     * @brief Find the index of each of the provided leaf values as of the given historic block
+     */
+    void find_leaf_indices_at_block(
+        const std::vector<LeafValueType>& leaves,
+        const index_t& blockNumber,
+        const AppendOnlyTree<Store, HashingPolicy>::FindLeafIndicesCallback& on_completion) const;
+
+    /**
+     * @brief Find the low leaf of each of the provided keys as of the given historic block
+     */
+    void find_low_leaves_at_block(const std::vector<fr>& leaf_keys,
+                                  const index_t& blockNumber,
+                                  const FindLowLeavesCallback& on_completion) const;
+
     using AppendOnlyTree<Store, HashingPolicy>::get_sibling_path;
+    using AppendOnlyTree<Store, HashingPolicy>::get_sibling_path_at_block;
+    using AppendOnlyTree<Store, HashingPolicy>::get_sibling_paths;
+    using AppendOnlyTree<Store, HashingPolicy>::get_sibling_paths_at_block;
 
   private:
     using typename AppendOnlyTree<Store, HashingPolicy>::AppendCompletionCallback;
@@ -115,13 +173,6 @@ template <typename Store, typename HashingPolicy> class IndexedTree : public App
         IndexedLeafValueType low_leaf, original_low_leaf;
     };
 
-    void update_leaf_and_hash_to_root(const index_t& index,
-                                      const IndexedLeafValueType& leaf,
-                                      Signal& leader,
-                                      Signal& follower,
-                                      fr_sibling_path& previous_sibling_path,
-                                      ReadTransaction& tx);
-
     struct InsertionGenerationResponse {
         std::shared_ptr<std::vector<LeafInsertion>> insertions;
         std::shared_ptr<std::vector<IndexedLeafValueType>> indexed_leaves;
@@ -140,6 +191,34 @@ template <typename Store, typename HashingPolicy> class IndexedTree : public App
                             std::shared_ptr<std::vector<LeafInsertion>> insertions,
                             const InsertionCompletionCallback& completion);
 
+    /**
+     * @brief The state of a batch of low leaf updates. The updates are hashed up the tree one level at a time, the
+     * nodes of every insertion at a level being hashed in parallel
+     */
+    struct InsertionWavefront {
+        static constexpr size_t NO_WRITER = std::numeric_limits<size_t>::max();
+
+        std::shared_ptr<std::vector<LeafInsertion>> insertions;
+        std::shared_ptr<std::vector<LowLeafWitnessData<LeafValueType>>> low_leaf_witness_data;
+        InsertionCompletionCallback completion;
+        // The level being hashed and, for each insertion, the index and new value of its node at that level
+        uint32_t level;
+        std::vector<index_t> indices;
+        std::vector<fr> hashes;
+        std::vector<fr> next_hashes;
+        // For each insertion, the latest insertion before it to write its sibling at this level, or NO_WRITER
+        std::vector<size_t> sibling_writers;
+        std::atomic<size_t> remaining_tasks;
+        Status status;
+    };
+
+    using InsertionWavefrontPtr = std::shared_ptr<InsertionWavefront>;
+    void hash_insertion_level(const InsertionWavefrontPtr& wavefront);
+    void for_each_insertion(const InsertionWavefrontPtr& wavefront,
+                            const std::function<void(size_t, size_t)>& op,
+                            const std::function<void()>& on_completion);
+    void complete_insertions(const InsertionWavefrontPtr& wavefront);
+
     struct HashGenerationResponse {
         std::shared_ptr<std::vector<fr>> hashes;
     };
@@ -191,7 +270,8 @@ IndexedTree<Store, HashingPolicy>::IndexedTree(Store& store, ThreadPool& workers
         store_.get_full_meta(stored_size, stored_root, name, depth, *tx, false);
     }
 
-    if (stored_size > 0) {
+    // A fork reads the committed state through its snapshot and must not write the initial leaves
+    if (stored_size > 0 || store_.has_snapshot()) {
         return;
     }
 
@@ -219,7 +299,7 @@ IndexedTree<Store, HashingPolicy>::IndexedTree(Store& store, ThreadPool& workers
     if (!result.success) {
         throw std::runtime_error("Failed to initialise tree: " + result.message);
     }
-    store_.commit();
+    store_.commit_genesis_state(workers_);
 }
 
 template <typename Store, typename HashingPolicy>
@@ -287,6 +367,140 @@ void IndexedTree<Store, HashingPolicy>::find_low_leaf(const fr& leaf_key,
     workers_.enqueue(job);
 }
 
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::find_leaf_indices(
+    const std::vector<LeafValueType>& leaves,
+    bool includeUncommitted,
+    const AppendOnlyTree<Store, HashingPolicy>::FindLeafIndicesCallback& on_completion) const
+{
+    auto values = std::make_shared<std::vector<LeafValueType>>(leaves);
+    FindLeafIndicesResponse initial;
+    initial.leaf_indices.resize(leaves.size());
+    this->template execute_batched<FindLeafIndicesResponse>(
+        std::move(initial),
+        leaves.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, FindLeafIndicesResponse& response) {
+            for (size_t i = start; i < end; ++i) {
+                response.leaf_indices[i] = store_.find_leaf_index_from((*values)[i], 0, tx, includeUncommitted);
+            }
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::find_low_leaves(const std::vector<fr>& leaf_keys,
+                                                        bool includeUncommitted,
+                                                        const FindLowLeavesCallback& on_completion) const
+{
+    auto keys = std::make_shared<std::vector<fr>>(leaf_keys);
+    FindLowLeavesResponse initial;
+    initial.low_leaves.resize(leaf_keys.size());
+    this->template execute_batched<FindLowLeavesResponse>(
+        std::move(initial),
+        leaf_keys.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, FindLowLeavesResponse& response) {
+            for (size_t i = start; i < end; ++i) {
+                response.low_leaves[i] = store_.find_low_value((*keys)[i], includeUncommitted, tx);
+            }
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::get_leaf_at_block(const index_t& index,
+                                                          const index_t& blockNumber,
+                                                          const LeafCallback& completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<GetIndexedLeafResponse<LeafValueType>>(
+            [=, this](TypedResponse<GetIndexedLeafResponse<LeafValueType>>& response) {
+                ReadTransactionPtr tx = store_.create_read_transaction();
+                response.inner.indexed_leaf = store_.get_leaf_at_block(index, blockNumber, *tx);
+            },
+            completion);
+    };
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::find_leaf_index_from_at_block(
+    const LeafValueType& leaf,
+    index_t start_index,
+    const index_t& blockNumber,
+    const AppendOnlyTree<Store, HashingPolicy>::FindLeafCallback& on_completion) const
+{
+    auto job = [=, this]() -> void {
+        execute_and_report<FindLeafIndexResponse>(
+            [=, this](TypedResponse<FindLeafIndexResponse>& response) {
+                typename Store::ReadTransactionPtr tx = store_.create_read_transaction();
+                std::optional<index_t> leaf_index =
+                    store_.find_leaf_index_from_at_block(leaf, start_index, blockNumber, *tx);
+                response.success = leaf_index.has_value();
+                if (response.success) {
+                    response.inner.leaf_index = leaf_index.value();
+                }
+            },
+            on_completion);
+    };
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::find_low_leaf_at_block(const fr& leaf_key,
+                                                               const index_t& blockNumber,
+                                                               const FindLowLeafCallback& on_completion) const
+{
+    auto job = [=, this]() {
+        execute_and_report<std::pair<bool, index_t>>(
+            [=, this](TypedResponse<std::pair<bool, index_t>>& response) {
+                typename Store::ReadTransactionPtr tx = store_.create_read_transaction();
+                response.inner = store_.find_low_value_at_block(leaf_key, blockNumber, *tx);
+            },
+            on_completion);
+    };
+
+    workers_.enqueue(job);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::find_leaf_indices_at_block(
+    const std::vector<LeafValueType>& leaves,
+    const index_t& blockNumber,
+    const AppendOnlyTree<Store, HashingPolicy>::FindLeafIndicesCallback& on_completion) const
+{
+    auto values = std::make_shared<std::vector<LeafValueType>>(leaves);
+    FindLeafIndicesResponse initial;
+    initial.leaf_indices.resize(leaves.size());
+    this->template execute_batched<FindLeafIndicesResponse>(
+        std::move(initial),
+        leaves.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, FindLeafIndicesResponse& response) {
+            for (size_t i = start; i < end; ++i) {
+                response.leaf_indices[i] = store_.find_leaf_index_from_at_block((*values)[i], 0, blockNumber, tx);
+            }
+        },
+        on_completion);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::find_low_leaves_at_block(const std::vector<fr>& leaf_keys,
+                                                                 const index_t& blockNumber,
+                                                                 const FindLowLeavesCallback& on_completion) const
+{
+    auto keys = std::make_shared<std::vector<fr>>(leaf_keys);
+    FindLowLeavesResponse initial;
+    initial.low_leaves.resize(leaf_keys.size());
+    this->template execute_batched<FindLowLeavesResponse>(
+        std::move(initial),
+        leaf_keys.size(),
+        [=, this](size_t start, size_t end, ReadTransaction& tx, FindLowLeavesResponse& response) {
+            for (size_t i = start; i < end; ++i) {
+                response.low_leaves[i] = store_.find_low_value_at_block((*keys)[i], blockNumber, tx);
+            }
+        },
+        on_completion);
+}
+
 template <typename Store, typename HashingPolicy>
 void IndexedTree<Store, HashingPolicy>::add_or_update_value(const LeafValueType& value,
                                                             const AddCompletionCallback& completion)
@@ -444,51 +658,130 @@ void IndexedTree<Store, HashingPolicy>::perform_insertions(size_t total_leaves,
         return;
     }
 
-    // We now kick off multiple workers to perform the low leaf updates
-    // We create set of signals to coordinate the workers as the move up the tree
-    auto signals = std::make_shared<std::vector<Signal>>();
-    std::shared_ptr<Status> status = std::make_shared<Status>();
-    // The first signal is set to 0. This ensures the first worker up the tree is not impeded
-    signals->emplace_back(0);
-    // Workers will follow their leaders up the tree, being triggered by the signal in front of them
+    // The low leaf updates must produce the same nodes and witness paths as applying them one after another. At each
+    // level, the sibling of an insertion's node is the node written by the latest insertion before it, if there is
+    // one, otherwise it is the node already in the store. Nodes are only written once the whole level has been read.
+    auto wavefront = std::make_shared<InsertionWavefront>();
+    wavefront->insertions = insertions;
+    wavefront->low_leaf_witness_data = low_leaf_witness_data;
+    wavefront->completion = completion;
+    wavefront->level = depth_;
+    wavefront->indices.resize(insertions->size());
+    wavefront->hashes.resize(insertions->size());
+    wavefront->next_hashes.resize(insertions->size());
+    wavefront->sibling_writers.resize(insertions->size());
     for (size_t i = 0; i < insertions->size(); ++i) {
-        signals->emplace_back(uint32_t(1 + depth_));
+        const LeafInsertion& insertion = (*insertions)[i];
+        auto& current_witness_data = (*low_leaf_witness_data)[i];
+        current_witness_data.leaf = insertion.original_low_leaf;
+        current_witness_data.index = insertion.low_leaf_index;
+        current_witness_data.path.clear();
+        current_witness_data.path.reserve(depth_);
+        wavefront->indices[i] = insertion.low_leaf_index;
     }
 
-    for (uint32_t i = 0; i < insertions->size(); ++i) {
-        auto op = [=, this]() {
-            LeafInsertion& insertion = (*insertions)[i];
-            Signal& leaderSignal = (*signals)[i];
-            Signal& followerSignal = (*signals)[i + 1];
+    // Hash the updated low leaves, then the levels above them
+    auto hash_leaves = [=](size_t start, size_t end) {
+        for (size_t i = start; i < end; ++i) {
+            wavefront->hashes[i] = HashingPolicy::hash((*insertions)[i].low_leaf.get_hash_inputs());
+        }
+    };
+    for_each_insertion(wavefront, hash_leaves, [=, this]() { hash_insertion_level(wavefront); });
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::hash_insertion_level(const InsertionWavefrontPtr& wavefront)
+{
+    // Identify the insertions whose sibling is written by an earlier insertion in the batch
+    std::unordered_map<index_t, size_t> writers;
+    for (size_t i = 0; i < wavefront->indices.size(); ++i) {
+        auto it = writers.find(wavefront->indices[i] ^ 1);
+        wavefront->sibling_writers[i] = it == writers.end() ? InsertionWavefront::NO_WRITER : it->second;
+        writers[wavefront->indices[i]] = i;
+    }
+
+    auto hash_nodes = [=, this](size_t start, size_t end) {
+        InsertionWavefront& state = *wavefront;
+        ReadTransactionPtr tx = store_.create_read_transaction();
+        for (size_t i = start; i < end; ++i) {
+            index_t index = state.indices[i];
+            size_t writer = state.sibling_writers[i];
+            fr sibling = writer == InsertionWavefront::NO_WRITER
+                             ? get_element_or_zero(state.level, index ^ 1, *tx, true)
+                             : state.hashes[writer];
+            (*state.low_leaf_witness_data)[i].path.push_back(sibling);
+            bool is_right = static_cast<bool>(index & 0x01);
+            state.next_hashes[i] = is_right ? HashingPolicy::hash_pair(sibling, state.hashes[i])
+                                            : HashingPolicy::hash_pair(state.hashes[i], sibling);
+        }
+    };
+
+    auto next_level = [=, this]() {
+        InsertionWavefront& state = *wavefront;
+        // Every read of this level has completed, write its nodes in insertion order so that the last write wins
+        for (size_t i = 0; i < state.indices.size(); ++i) {
+            write_node(state.level, state.indices[i], state.hashes[i]);
+        }
+        std::swap(state.hashes, state.next_hashes);
+        for (index_t& index : state.indices) {
+            index >>= 1;
+        }
+        if (--state.level > 0) {
+            hash_insertion_level(wavefront);
+            return;
+        }
+        write_node(0, 0, state.hashes.back());
+        complete_insertions(wavefront);
+    };
+
+    for_each_insertion(wavefront, hash_nodes, next_level);
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::for_each_insertion(const InsertionWavefrontPtr& wavefront,
+                                                           const std::function<void(size_t, size_t)>& op,
+                                                           const std::function<void()>& on_completion)
+{
+    // Split the insertions into a contiguous range per worker, the last range to complete continues the batch
+    const size_t num_insertions = wavefront->indices.size();
+    const size_t range_size = (num_insertions + workers_.num_threads() - 1) / workers_.num_threads();
+    const size_t num_ranges = (num_insertions + range_size - 1) / range_size;
+    wavefront->remaining_tasks = num_ranges;
+    for (size_t range = 0; range < num_ranges; ++range) {
+        workers_.enqueue([=, this]() {
+            size_t start = range * range_size;
             try {
-                ReadTransactionPtr tx = store_.create_read_transaction();
-                auto& current_witness_data = low_leaf_witness_data->at(i);
-                current_witness_data.leaf = insertion.original_low_leaf;
-                current_witness_data.index = insertion.low_leaf_index;
-                current_witness_data.path.clear();
-                update_leaf_and_hash_to_root(insertion.low_leaf_index,
-                                             insertion.low_leaf,
-                                             leaderSignal,
-                                             followerSignal,
-                                             current_witness_data.path,
-                                             *tx);
+                op(start, std::min(start + range_size, num_insertions));
             } catch (std::exception& e) {
-                status->set_failure(e.what());
-                // ensure that any followers are not blocked by our failure
-                followerSignal.signal_level(0);
+                wavefront->status.set_failure(e.what());
             }
-            if (i == insertions->size() - 1) {
-                TypedResponse<InsertionCompletionResponse> response;
-                response.success = status->success;
-                response.message = status->message;
-                if (response.success) {
-                    response.inner.low_leaf_witness_data = low_leaf_witness_data;
-                }
-                completion(response);
+            if (wavefront->remaining_tasks.fetch_sub(1) != 1) {
+                return;
             }
-        };
-        workers_.enqueue(op);
+            if (!wavefront->status.success) {
+                complete_insertions(wavefront);
+                return;
+            }
+            try {
+                on_completion();
+            } catch (std::exception& e) {
+                wavefront->status.set_failure(e.what());
+                complete_insertions(wavefront);
+            }
+        });
+    }
+}
+
+template <typename Store, typename HashingPolicy>
+void IndexedTree<Store, HashingPolicy>::complete_insertions(const InsertionWavefrontPtr& wavefront)
+{
+    TypedResponse<InsertionCompletionResponse> response;
+    response.success = wavefront->status.success;
+    response.message = wavefront->status.message;
+    if (response.success) {
+        response.inner.low_leaf_witness_data = wavefront->low_leaf_witness_data;
     }
+    wavefront->completion(response);
 }
 
 template <typename Store, typename HashingPolicy>
@@ -547,6 +840,20 @@ void IndexedTree<Store, HashingPolicy>::generate_insertions(
                 if (new_total_size > max_size_) {
                     throw std::runtime_error("Tree is full");
                 }
+
+                // Find all of the low leaves up front in a single pass over the sorted values. Each new leaf is
+                // greater than all of those that follow it, so the leaves inserted below never become the low leaf of
+                // a later value
+                std::vector<fr> keys;
+                keys.reserve(values.size());
+                for (const auto& value_pair : values) {
+                    if (!value_pair.first.is_empty()) {
+                        keys.push_back(value_pair.first.get_key());
+                    }
+                }
+                std::vector<std::pair<bool, index_t>> low_values = store_.find_low_values(keys, true, *tx);
+                size_t low_value_index = 0;
+
                 for (size_t i = 0; i < values.size(); ++i) {
                     std::pair<LeafValueType, size_t>& value_pair = values[i];
                     size_t index_into_appended_leaves = value_pair.second;
@@ -563,8 +870,7 @@ void IndexedTree<Store, HashingPolicy>::generate_insertions(
                     // This gives us the leaf that need updating
                     index_t current = 0;
                     bool is_already_present = false;
-                    std::tie(is_already_present, current) =
-                        store_.find_low_value(value_pair.first.get_key(), true, *tx);
+                    std::tie(is_already_present, current) = low_values[low_value_index++];
                     // .value() throws if the low leaf does not exist
                     IndexedLeafValueType current_leaf = store_.get_leaf(current, *tx, true).value();
 
@@ -613,70 +919,4 @@ void IndexedTree<Store, HashingPolicy>::generate_insertions(
         on_completion);
 }
 
-template <typename Store, typename HashingPolicy>
-void IndexedTree<Store, HashingPolicy>::update_leaf_and_hash_to_root(const index_t& leaf_index,
-                                                                     const IndexedLeafValueType& leaf,
-                                                                     Signal& leader,
-                                                                     Signal& follower,
-                                                                     fr_sibling_path& previous_sibling_path,
-                                                                     ReadTransaction& tx)
-{
-    auto get_node = [&](uint32_t level, index_t index) -> fr { return get_element_or_zero(level, index, tx, true); };
-    // We are a worker at a specific leaf index.
-    // We are going to move up the tree and at each node/level:
-    // 1. Wait for the level above to become 'signalled' as clear for us to write into
-    // 2. Read the node and it's sibling
-    // 3. Write the new node value
-    index_t index = leaf_index;
-    uint32_t level = depth_;
-    fr new_hash = HashingPolicy::hash(leaf.get_hash_inputs());
-
-    // Wait until we see that our leader has cleared 'depth_ - 1' (i.e. the level above the leaves that we are about
-    // to write into) this ensures that our leader is not still reading the leaves
-    uint32_t leader_level = depth_ - 1;
-    leader.wait_for_level(leader_level);
-
-    // Extract the value of the leaf node and it's sibling
-    bool is_right = static_cast<bool>(index & 0x01);
-
-    // Write the new leaf hash in place
-    write_node(level, index, new_hash);
-    // Signal that this level has been written
-    follower.signal_level(level);
-
-    while (level > 0) {
-        if (level > 1) {
-            // Level is > 1. Therefore we need to wait for our leader to have written to the level above meaning we
-            // can read from it
-            leader_level = level - 1;
-            leader.wait_for_level(leader_level);
-
-            // Now read the node and it's sibling
-            index_t index_of_node_above = index >> 1;
-            bool node_above_is_right = static_cast<bool>(index_of_node_above & 0x01);
-            fr above_sibling = get_node(level, node_above_is_right ? index_of_node_above - 1 : index_of_node_above + 1);
-        }
-
-        // Now that we have extracted the hash path from the row above
-        // we can compute the new hash at that level and write it
-        is_right = static_cast<bool>(index & 0x01);
-        fr new_right_value = is_right ? new_hash : get_node(level, index + 1);
-        fr new_left_value = is_right ? get_node(level, index - 1) : new_hash;
-        previous_sibling_path.emplace_back(is_right ? new_left_value : new_right_value);
-        new_hash = HashingPolicy::hash_pair(new_left_value, new_right_value);
-        index >>= 1;
-        --level;
-        if (level > 0) {
-            // Before we write we need to ensure that our leader has already written to the row above it
-            // otherwise it could still be reading from this level
-            leader_level = level - 1;
-            leader.wait_for_level(leader_level);
-        }
-
-        // Write this node and signal that it is done
-        write_node(level, index, new_hash);
-        follower.signal_level(level);
-    }
-}
-
 } // namespace bb::crypto::merkle_tree
@@ -233,6 +233,58 @@ TEST_F(PersistedIndexedTreeTest, can_only_recreate_with_same_name_and_depth)
     EXPECT_ANY_THROW(Store store_wrong_depth(name, depth + 1, db));
 }
 
+TEST_F(PersistedIndexedTreeTest, can_only_recreate_with_same_format_version)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    {
+        Store store(name, depth, db);
+    }
+
+    // Rewrite the persisted meta data as if the tree had been persisted before its format was versioned
+    TreeMeta meta;
+    {
+        LMDBReadTransaction::Ptr tx = db.create_read_transaction();
+        std::vector<uint8_t> data;
+        EXPECT_TRUE(tx->get_node(0, 0, data));
+        msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(meta);
+    }
+    EXPECT_EQ(meta.formatVersion, TREE_FORMAT_VERSION);
+    meta.formatVersion = 0;
+    {
+        msgpack::sbuffer buffer;
+        msgpack::pack(buffer, meta);
+        std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
+        LMDBWriteTransaction::Ptr tx = db.create_write_transaction();
+        tx->put_node(0, 0, encoded);
+        tx->commit();
+    }
+    EXPECT_ANY_THROW(Store store(name, depth, db));
+}
+
+TEST_F(PersistedIndexedTreeTest, rejects_persisted_leaves_of_the_wrong_size)
+{
+    constexpr size_t depth = 10;
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    ThreadPool workers(1);
+    TreeType tree = TreeType(store, workers, 2);
+
+    // Overwrite the second of the initial leaves with a truncated value
+    {
+        LeafIndexKeyType key = 1;
+        std::vector<uint8_t> truncated(sizeof(fr));
+        LMDBWriteTransaction::Ptr tx = db.create_write_transaction();
+        tx->put_value(key, truncated);
+        tx->commit();
+    }
+    LMDBReadTransaction::Ptr tx = db.create_read_transaction();
+    EXPECT_TRUE(store.get_leaf(0, *tx, false).has_value());
+    EXPECT_THROW(store.get_leaf(1, *tx, false), std::runtime_error);
+}
+
 TEST_F(PersistedIndexedTreeTest, test_size)
 {
     index_t current_size = 2;
@@ -524,6 +576,45 @@ TEST_F(PersistedIndexedTreeTest, test_batch_insert)
     }
 }
 
+TEST_F(PersistedIndexedTreeTest, test_batch_insert_over_committed_values)
+{
+    // Large batches whose low leaves are a mix of committed and uncommitted values, some of which are adjacent
+    auto& random_engine = numeric::get_randomness();
+    const uint32_t batch_size = 64;
+    const uint32_t num_batches = 8;
+    uint32_t depth = 12;
+    ThreadPool workers(8);
+    NullifierMemoryTree<HashPolicy> memdb(depth, batch_size);
+
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    auto tree = TreeType(store, workers, batch_size);
+
+    uint256_t base = random_engine.get_random_uint256() >> 2;
+    for (uint32_t i = 0; i < num_batches; i++) {
+        std::vector<NullifierLeafValue> batch;
+        for (uint32_t j = 0; j < batch_size; j++) {
+            // Half of each odd batch interleaves with the values of the previous batch, the rest are random
+            fr value = j < batch_size / 2 ? fr(base + uint256_t(j * 2 + i % 2))
+                                          : fr(random_engine.get_random_uint256());
+            batch.emplace_back(value);
+            memdb.update_element(value);
+        }
+        if (i % 2 == 1) {
+            base += batch_size;
+        }
+        add_values(tree, batch);
+        check_root(tree, memdb.root());
+        check_sibling_path(tree, 0, memdb.get_sibling_path(0));
+        if (i % 3 == 0) {
+            commit_tree(tree);
+        }
+    }
+    commit_tree(tree);
+    check_root(tree, memdb.root());
+}
+
 TEST_F(PersistedIndexedTreeTest, reports_an_error_if_batch_contains_duplicate)
 {
     index_t current_size = 2;
@@ -1019,6 +1110,54 @@ TEST_F(PersistedIndexedTreeTest, returns_low_leaves)
     EXPECT_EQ(predecessor.second, 2);
 }
 
+TEST_F(PersistedIndexedTreeTest, returns_multiple_low_leaves)
+{
+    constexpr uint32_t depth = 8;
+
+    ThreadPool workers(4);
+    std::string name = random_string();
+    LMDBStore db(*_environment, name, false, false, integer_key_cmp);
+    Store store(name, depth, db);
+    auto tree = TreeType(store, workers, 2);
+
+    for (uint32_t i = 1; i <= 50; ++i) {
+        add_value(tree, NullifierLeafValue(i * 10));
+    }
+
+    std::vector<fr> keys;
+    for (uint32_t i = 0; i < 100; ++i) {
+        keys.emplace_back((i * 73) % 600);
+    }
+
+    TypedResponse<FindLowLeavesResponse> response;
+    Signal signal;
+    tree.find_low_leaves(keys, true, [&](const TypedResponse<FindLowLeavesResponse>& r) {
+        response = r;
+        signal.signal_level();
+    });
+    signal.wait_for_level();
+
+    EXPECT_EQ(response.success, true);
+    EXPECT_EQ(response.inner.low_leaves.size(), keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        EXPECT_EQ(response.inner.low_leaves[i], get_low_leaf(tree, NullifierLeafValue(keys[i])));
+    }
+
+    Signal find_signal;
+    std::vector<NullifierLeafValue> leaves = {
+        NullifierLeafValue(10),
+        NullifierLeafValue(15),
+        NullifierLeafValue(500),
+    };
+    tree.find_leaf_indices(leaves, true, [&](const TypedResponse<FindLeafIndicesResponse>& response) {
+        EXPECT_EQ(response.success, true);
+        std::vector<std::optional<index_t>> expected = { 2, std::nullopt, 51 };
+        EXPECT_EQ(response.inner.leaf_indices, expected);
+        find_signal.signal_level();
+    });
+    find_signal.wait_for_level();
+}
+
 TEST_F(PersistedIndexedTreeTest, duplicates)
 {
     // Create a depth-8 indexed merkle tree
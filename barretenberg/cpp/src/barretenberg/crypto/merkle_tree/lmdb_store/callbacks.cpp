@@ -77,6 +77,86 @@ NodeKeyType get_key_for_node(uint32_t level, index_t index)
     return key - 1;
 }
 
+namespace {
+const uint8_t HISTORIC_NODE_TAG = 'N';
+const uint8_t HISTORIC_LEAF_TAG = 'L';
+const uint8_t BLOCK_TAG = 'B';
+const uint8_t BLOCK_JOURNAL_TAG = 'J';
+const uint8_t LOW_LEAF_LINK_TAG = 'P';
+const size_t BLOCK_NUMBER_SIZE = sizeof(uint64_t);
+
+void append_big_endian(std::vector<uint8_t>& buf, uint64_t value, size_t num_bytes)
+{
+    for (size_t i = num_bytes; i > 0; --i) {
+        buf.push_back(static_cast<uint8_t>(value >> ((i - 1) * 8)));
+    }
+}
+} // namespace
+
+// Historic keys have lengths of 21, 17 and 9 bytes respectively. None of these are integer key sizes, so
+// integer_key_cmp orders them lexicographically, which is the (tag, coordinates, block) order due to the big-endian
+// encoding
+std::vector<uint8_t> get_key_for_historic_node(uint32_t level, index_t index, index_t block)
+{
+    std::vector<uint8_t> buf;
+    buf.reserve(1 + sizeof(uint32_t) + sizeof(uint64_t) + BLOCK_NUMBER_SIZE);
+    buf.push_back(HISTORIC_NODE_TAG);
+    append_big_endian(buf, level, sizeof(uint32_t));
+    append_big_endian(buf, index, sizeof(uint64_t));
+    append_big_endian(buf, block, BLOCK_NUMBER_SIZE);
+    return buf;
+}
+
+std::vector<uint8_t> get_key_for_historic_leaf(index_t index, index_t block)
+{
+    std::vector<uint8_t> buf;
+    buf.reserve(1 + sizeof(uint64_t) + BLOCK_NUMBER_SIZE);
+    buf.push_back(HISTORIC_LEAF_TAG);
+    append_big_endian(buf, index, sizeof(uint64_t));
+    append_big_endian(buf, block, BLOCK_NUMBER_SIZE);
+    return buf;
+}
+
+std::vector<uint8_t> get_key_for_block(index_t block)
+{
+    std::vector<uint8_t> buf;
+    buf.reserve(1 + BLOCK_NUMBER_SIZE);
+    buf.push_back(BLOCK_TAG);
+    append_big_endian(buf, block, BLOCK_NUMBER_SIZE);
+    return buf;
+}
+
+std::vector<uint8_t> get_key_for_block_journal(index_t block)
+{
+    std::vector<uint8_t> buf;
+    buf.reserve(1 + BLOCK_NUMBER_SIZE);
+    buf.push_back(BLOCK_JOURNAL_TAG);
+    append_big_endian(buf, block, BLOCK_NUMBER_SIZE);
+    return buf;
+}
+
+// Low leaf links are keyed by leaf index rather than block, but share the 9 byte length of the block keys and sort
+// after them
+std::vector<uint8_t> get_key_for_low_leaf_link(index_t index)
+{
+    std::vector<uint8_t> buf;
+    buf.reserve(1 + sizeof(uint64_t));
+    buf.push_back(LOW_LEAF_LINK_TAG);
+    append_big_endian(buf, index, sizeof(uint64_t));
+    return buf;
+}
+
+/**
+ * Returns true if the 2 historic keys refer to the same node/leaf, regardless of the block number they were written at
+ */
+bool historic_keys_match(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b)
+{
+    if (a.size() != b.size() || a.size() <= BLOCK_NUMBER_SIZE) {
+        return false;
+    }
+    return std::equal(a.begin(), a.end() - BLOCK_NUMBER_SIZE, b.begin());
+}
+
 int size_cmp(const MDB_val* a, const MDB_val* b)
 {
     if (a->mv_size < b->mv_size) {
@@ -94,14 +174,21 @@ std::vector<uint8_t> mdb_val_to_vector(const MDB_val& dbVal)
     return std::vector<uint8_t>(p, p + dbVal.mv_size);
 }
 
+std::span<const uint8_t> mdb_val_to_span(const MDB_val& dbVal)
+{
+    return { static_cast<const uint8_t*>(dbVal.mv_data), dbVal.mv_size };
+}
+
 /**
  * Default lexicographical implementation of key comparisons used in our LMDB implementation
  */
 int lexico_cmp(const MDB_val* a, const MDB_val* b)
 {
-    std::vector<uint8_t> a_vector = mdb_val_to_vector(*a);
-    std::vector<uint8_t> b_vector = mdb_val_to_vector(*b);
-    return std::lexicographical_compare(a_vector.begin(), a_vector.end(), b_vector.begin(), b_vector.end());
+    int result = std::memcmp(a->mv_data, b->mv_data, std::min(a->mv_size, b->mv_size));
+    if (result != 0) {
+        return result < 0 ? -1 : 1;
+    }
+    return size_cmp(a, b);
 }
 
 /**
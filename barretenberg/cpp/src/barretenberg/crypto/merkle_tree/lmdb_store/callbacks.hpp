@@ -5,6 +5,7 @@
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include <cstdint>
 #include <lmdb.h>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -21,6 +22,15 @@ int lexico_cmp(const MDB_val*, const MDB_val*);
 
 NodeKeyType get_key_for_node(uint32_t level, index_t index);
 
+// Keys for the historic (per-block) key spaces. These are big-endian encoded and tagged by their first byte so that
+// they sort by (tag, coordinates, block) under lexicographical comparison
+std::vector<uint8_t> get_key_for_historic_node(uint32_t level, index_t index, index_t block);
+std::vector<uint8_t> get_key_for_historic_leaf(index_t index, index_t block);
+std::vector<uint8_t> get_key_for_block(index_t block);
+std::vector<uint8_t> get_key_for_block_journal(index_t block);
+std::vector<uint8_t> get_key_for_low_leaf_link(index_t index);
+bool historic_keys_match(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b);
+
 std::vector<uint8_t> serialise_key(uint8_t key);
 std::vector<uint8_t> serialise_key(uint64_t key);
 std::vector<uint8_t> serialise_key(uint128_t key);
@@ -48,6 +58,7 @@ template <typename T> int value_cmp(const MDB_val* a, const MDB_val* b)
 
 int integer_key_cmp(const MDB_val* a, const MDB_val* b);
 std::vector<uint8_t> mdb_val_to_vector(const MDB_val& dbVal);
+std::span<const uint8_t> mdb_val_to_span(const MDB_val& dbVal);
 void copy_to_vector(const MDB_val& dbVal, std::vector<uint8_t>& target);
 
 template <typename... TArgs> bool call_lmdb_func(int (*f)(TArgs...), TArgs... args)
@@ -1,11 +1,34 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_read_transaction.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
+#include <algorithm>
 #include <cstdint>
+#include <cstring>
+#include <exception>
+#include <optional>
+#include <span>
 
 namespace bb::crypto::merkle_tree {
 LMDBReadTransaction::LMDBReadTransaction(LMDBEnvironment& env, const LMDBDatabase& database)
     : LMDBTransaction(env, true)
     , _database(database)
+{
+    // LMDB loads the record of a database on its first use in a transaction. This is the only state a read modifies,
+    // so load it now, before the transaction can be shared between threads.
+    MDB_stat stat;
+    try {
+        call_lmdb_func("mdb_stat", mdb_stat, underlying(), _database.underlying(), &stat);
+    } catch (std::exception&) {
+        // Also releases the reader taken for this transaction
+        LMDBReadTransaction::abort();
+        throw;
+    }
+}
+
+LMDBReadTransaction::LMDBReadTransaction(LMDBEnvironment& env,
+                                         const LMDBDatabase& database,
+                                         const LMDBReadTransaction& snapshot)
+    : LMDBTransaction(env, snapshot)
+    , _database(database)
 {}
 
 LMDBReadTransaction::~LMDBReadTransaction()
@@ -15,11 +38,25 @@ LMDBReadTransaction::~LMDBReadTransaction()
 
 void LMDBReadTransaction::abort()
 {
+    // Only the owner of the snapshot holds a reader
+    bool releaseReader = state == TransactionState::OPEN && _ownsTransaction;
     LMDBTransaction::abort();
-    _environment.release_reader();
+    if (releaseReader) {
+        _environment.release_reader();
+    }
 }
 
 bool LMDBReadTransaction::get_value(std::vector<uint8_t>& key, std::vector<uint8_t>& data) const
+{
+    std::span<const uint8_t> value;
+    if (!get_value(key, value)) {
+        return false;
+    }
+    data.assign(value.begin(), value.end());
+    return true;
+}
+
+bool LMDBReadTransaction::get_value(std::vector<uint8_t>& key, std::span<const uint8_t>& data) const
 {
     MDB_val dbKey;
     dbKey.mv_size = key.size();
@@ -29,13 +66,145 @@ bool LMDBReadTransaction::get_value(std::vector<uint8_t>& key, std::vector<uint8
     if (!call_lmdb_func(mdb_get, underlying(), _database.underlying(), &dbKey, &dbVal)) {
         return false;
     }
-    copy_to_vector(dbVal, data);
+    data = mdb_val_to_span(dbVal);
     return true;
 }
 
+bool LMDBReadTransaction::get_value_or_previous(std::vector<uint8_t>& key, std::vector<uint8_t>& data) const
+{
+    std::span<const uint8_t> value;
+    if (!get_value_or_previous(key, value)) {
+        return false;
+    }
+    data.assign(value.begin(), value.end());
+    return true;
+}
+
+bool LMDBReadTransaction::get_value_or_previous(std::vector<uint8_t>& key, std::span<const uint8_t>& data) const
+{
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, underlying(), _database.underlying(), &cursor);
+
+    MDB_val dbKey;
+    MDB_val dbVal;
+    bool success = false;
+    try {
+        success = seek_value_or_previous(cursor, key, dbKey, dbVal);
+    } catch (std::exception&) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    if (success) {
+        data = mdb_val_to_span(dbVal);
+        // The keys are the same size, so the found key can be copied in place
+        std::memcpy(key.data(), dbKey.mv_data, key.size());
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+    return success;
+}
+
+void LMDBReadTransaction::get_values_or_previous(std::vector<std::vector<uint8_t>>& keys,
+                                                 std::vector<std::optional<std::span<const uint8_t>>>& data) const
+{
+    data.assign(keys.size(), std::nullopt);
+    if (keys.empty()) {
+        return;
+    }
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, underlying(), _database.underlying(), &cursor);
+
+    MDB_val dbKey;
+    MDB_val dbVal;
+    // Whether the cursor rests on the result for the previous key
+    bool positioned = false;
+    try {
+        for (size_t i = 0; i < keys.size(); ++i) {
+            std::vector<uint8_t>& key = keys[i];
+            MDB_val requested;
+            requested.mv_size = key.size();
+            requested.mv_data = (void*)key.data();
+            bool found = false;
+            if (positioned && mdb_cmp(underlying(), _database.underlying(), &dbKey, &requested) <= 0) {
+                // The result for the previous (larger) key is also the result for this one
+                found = true;
+            } else if (positioned) {
+                // Try the entry immediately preceding the cursor before resorting to a seek, batches are often dense
+                // relative to the database
+                int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_PREV);
+                if (code == MDB_NOTFOUND || (code == 0 && dbKey.mv_size != key.size())) {
+                    // There are no smaller keys, so there is nothing to find for this or any remaining key
+                    break;
+                }
+                if (code != 0) {
+                    throw_error("get_values_or_previous::mdb_cursor_get", code);
+                }
+                found = mdb_cmp(underlying(), _database.underlying(), &dbKey, &requested) <= 0 ||
+                        seek_value_or_previous(cursor, key, dbKey, dbVal);
+            } else {
+                found = seek_value_or_previous(cursor, key, dbKey, dbVal);
+            }
+            if (!found) {
+                break;
+            }
+            data[i] = mdb_val_to_span(dbVal);
+            std::memcpy(key.data(), dbKey.mv_data, key.size());
+            positioned = true;
+        }
+    } catch (std::exception&) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+}
+
+bool LMDBReadTransaction::seek_value_or_previous(MDB_cursor* cursor,
+                                                 const std::vector<uint8_t>& key,
+                                                 MDB_val& dbKey,
+                                                 MDB_val& dbVal) const
+{
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    // Look for the key >= to that provided
+    int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_SET_RANGE);
+    if (code == 0) {
+        // we found the key, now determine if it is the exact key
+        std::span<const uint8_t> found = mdb_val_to_span(dbKey);
+        if (std::equal(key.begin(), key.end(), found.begin(), found.end())) {
+            // we have the exact key
+            return true;
+        }
+        // We have a key of the same size but larger value OR a larger size
+        // either way we now need to find the previous key
+        code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_PREV);
+    } else if (code == MDB_NOTFOUND) {
+        // The key was not found, use the last key in the db
+        code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_PREV);
+    } else {
+        throw_error("get_value_or_previous::mdb_cursor_get", code);
+    }
+
+    if (code == MDB_NOTFOUND) {
+        // There is no previous key (or the DB is empty)
+        return false;
+    }
+    if (code != 0) {
+        throw_error("get_value_or_previous::mdb_cursor_get", code);
+    }
+    // We have found a previous key. It could be of the same size but smaller value, or smaller size which is equal to
+    // not found
+    return dbKey.mv_size == key.size();
+}
+
 bool LMDBReadTransaction::get_node(uint32_t level, index_t index, std::vector<uint8_t>& data) const
 {
     NodeKeyType key = get_key_for_node(level, index);
     return get_value(key, data);
 }
+
+bool LMDBReadTransaction::get_node(uint32_t level, index_t index, std::span<const uint8_t>& data) const
+{
+    NodeKeyType key = get_key_for_node(level, index);
+    return get_value(key, data);
+}
 } // namespace bb::crypto::merkle_tree
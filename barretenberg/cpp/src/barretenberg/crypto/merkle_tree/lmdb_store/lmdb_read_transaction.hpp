@@ -6,6 +6,8 @@
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include <cstdint>
 #include <cstring>
+#include <optional>
+#include <span>
 #include <vector>
 
 namespace bb::crypto::merkle_tree {
@@ -13,6 +15,11 @@ namespace bb::crypto::merkle_tree {
 /**
  * RAII wrapper around a read transaction.
  * Contains various methods for retrieving values by their keys.
+ * Values can either be copied out or returned as a span directly into the memory map, avoiding a copy. A span is only
+ * valid for the lifetime of the transaction.
+ * The environment is opened with MDB_NOTLS, so a read transaction is not bound to a thread. Its database record is
+ * loaded when it begins, after which reads do not modify the transaction, so several threads can read through it at
+ * once, either directly or through transactions that share its snapshot.
  * Aborts the transaction upon object destruction.
  */
 class LMDBReadTransaction : public LMDBTransaction {
@@ -20,6 +27,11 @@ class LMDBReadTransaction : public LMDBTransaction {
     using Ptr = std::unique_ptr<LMDBReadTransaction>;
 
     LMDBReadTransaction(LMDBEnvironment& env, const LMDBDatabase& database);
+    /**
+     * @brief Reads a database through the snapshot of another read transaction, in the same environment, which must
+     * outlive this one
+     */
+    LMDBReadTransaction(LMDBEnvironment& env, const LMDBDatabase& database, const LMDBReadTransaction& snapshot);
     LMDBReadTransaction(const LMDBReadTransaction& other) = delete;
     LMDBReadTransaction(LMDBReadTransaction&& other) = delete;
     LMDBReadTransaction& operator=(const LMDBReadTransaction& other) = delete;
@@ -28,17 +40,45 @@ class LMDBReadTransaction : public LMDBTransaction {
     ~LMDBReadTransaction() override;
 
     template <typename T> bool get_value_or_previous(T& key, std::vector<uint8_t>& data) const;
+    template <typename T> bool get_value_or_previous(T& key, std::span<const uint8_t>& data) const;
+
+    /**
+     * @brief Retrieves the value for the largest key <= the one provided, considering only keys of the same size.
+     * Upon success the provided key is updated to the key that was found.
+     */
+    bool get_value_or_previous(std::vector<uint8_t>& key, std::vector<uint8_t>& data) const;
+    bool get_value_or_previous(std::vector<uint8_t>& key, std::span<const uint8_t>& data) const;
+
+    template <typename T>
+    void get_values_or_previous(std::vector<T>& keys, std::vector<std::optional<std::span<const uint8_t>>>& data) const;
+
+    /**
+     * @brief Performs get_value_or_previous for each of a set of keys of the same size, provided in descending order,
+     * using a single cursor. Consecutive keys that share a result, or whose results are adjacent in the database, do
+     * not require a seek. Each key is updated to the key that was found, the value is nullopt if there was none.
+     */
+    void get_values_or_previous(std::vector<std::vector<uint8_t>>& keys,
+                                std::vector<std::optional<std::span<const uint8_t>>>& data) const;
 
     bool get_node(uint32_t level, index_t index, std::vector<uint8_t>& data) const;
+    bool get_node(uint32_t level, index_t index, std::span<const uint8_t>& data) const;
 
     template <typename T> bool get_value(T& key, std::vector<uint8_t>& data) const;
+    template <typename T> bool get_value(T& key, std::span<const uint8_t>& data) const;
 
     bool get_value(std::vector<uint8_t>& key, std::vector<uint8_t>& data) const;
+    bool get_value(std::vector<uint8_t>& key, std::span<const uint8_t>& data) const;
 
     void abort() override;
 
   protected:
     const LMDBDatabase& _database;
+
+  private:
+    bool seek_value_or_previous(MDB_cursor* cursor,
+                                const std::vector<uint8_t>& key,
+                                MDB_val& dbKey,
+                                MDB_val& dbVal) const;
 };
 
 template <typename T> bool LMDBReadTransaction::get_value(T& key, std::vector<uint8_t>& data) const
@@ -47,71 +87,46 @@ template <typename T> bool LMDBReadTransaction::get_value(T& key, std::vector<ui
     return get_value(keyBuffer, data);
 }
 
+template <typename T> bool LMDBReadTransaction::get_value(T& key, std::span<const uint8_t>& data) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    return get_value(keyBuffer, data);
+}
+
 template <typename T> bool LMDBReadTransaction::get_value_or_previous(T& key, std::vector<uint8_t>& data) const
 {
     std::vector<uint8_t> keyBuffer = serialise_key(key);
-    uint32_t keySize = static_cast<uint32_t>(keyBuffer.size());
-    MDB_cursor* cursor = nullptr;
-    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, underlying(), _database.underlying(), &cursor);
-
-    MDB_val dbKey;
-    dbKey.mv_size = keySize;
-    dbKey.mv_data = (void*)keyBuffer.data();
-
-    MDB_val dbVal;
-
-    bool success = false;
-
-    // Look for the key >= to that provided
-    int code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_SET_RANGE);
-    if (code == 0) {
-        // we found the key, now determine if it is the exact key
-        std::vector<uint8_t> temp = mdb_val_to_vector(dbKey);
-        if (keyBuffer == temp) {
-            // we have the exact key
-            copy_to_vector(dbVal, data);
-            success = true;
-        } else {
-            // We have a key of the same size but larger value OR a larger size
-            // either way we now need to find the previous key
-            code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_PREV);
-            if (code == 0) {
-                // We have found a previous key. It could be of the same size but smaller value, or smaller size which
-                // is equal to not found
-                if (dbKey.mv_size != keySize) {
-                    // There is no previous key, do nothing
-                } else {
-                    copy_to_vector(dbVal, data);
-                    deserialise_key(dbKey.mv_data, key);
-                    success = true;
-                }
-            } else if (code == MDB_NOTFOUND) {
-                // There is no previous key, do nothing
-            } else {
-                throw_error("get_value_or_previous::mdb_cursor_get", code);
-            }
-        }
-    } else if (code == MDB_NOTFOUND) {
-        // The key was not found, use the last key in the db
-        code = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_PREV);
-        if (code == 0) {
-            // We found the last key, but we need to ensure it is the same size
-            if (dbKey.mv_size != keySize) {
-                // The key is not the same size, same as not found, do nothing
-            } else {
-                copy_to_vector(dbVal, data);
-                deserialise_key(dbKey.mv_data, key);
-                success = true;
-            }
-        } else if (code == MDB_NOTFOUND) {
-            // DB is empty?
-        } else {
-            throw_error("get_value_or_previous::mdb_cursor_get", code);
-        }
-    } else {
-        throw_error("get_value_or_previous::mdb_cursor_get", code);
+    bool success = get_value_or_previous(keyBuffer, data);
+    if (success) {
+        deserialise_key(keyBuffer.data(), key);
+    }
+    return success;
+}
+
+template <typename T> bool LMDBReadTransaction::get_value_or_previous(T& key, std::span<const uint8_t>& data) const
+{
+    std::vector<uint8_t> keyBuffer = serialise_key(key);
+    bool success = get_value_or_previous(keyBuffer, data);
+    if (success) {
+        deserialise_key(keyBuffer.data(), key);
     }
-    call_lmdb_func(mdb_cursor_close, cursor);
     return success;
 }
+
+template <typename T>
+void LMDBReadTransaction::get_values_or_previous(std::vector<T>& keys,
+                                                 std::vector<std::optional<std::span<const uint8_t>>>& data) const
+{
+    std::vector<std::vector<uint8_t>> keyBuffers;
+    keyBuffers.reserve(keys.size());
+    for (const T& key : keys) {
+        keyBuffers.push_back(serialise_key(key));
+    }
+    get_values_or_previous(keyBuffers, data);
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (data[i].has_value()) {
+            deserialise_key(keyBuffers[i].data(), keys[i]);
+        }
+    }
+}
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
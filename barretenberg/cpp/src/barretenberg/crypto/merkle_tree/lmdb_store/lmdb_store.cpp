@@ -20,9 +20,17 @@ LMDBWriteTransaction::Ptr LMDBStore::create_write_transaction() const
 {
     return std::make_unique<LMDBWriteTransaction>(_environment, _database);
 }
+LMDBWriteTransaction::Ptr LMDBStore::create_write_transaction(LMDBWriteTransaction& parent) const
+{
+    return std::make_unique<LMDBWriteTransaction>(_environment, _database, parent);
+}
 LMDBReadTransaction::Ptr LMDBStore::create_read_transaction()
 {
     _environment.wait_for_reader();
     return std::make_unique<LMDBReadTransaction>(_environment, _database);
 }
+LMDBReadTransaction::Ptr LMDBStore::create_read_transaction(const LMDBReadTransaction& snapshot) const
+{
+    return std::make_unique<LMDBReadTransaction>(_environment, _database, snapshot);
+}
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
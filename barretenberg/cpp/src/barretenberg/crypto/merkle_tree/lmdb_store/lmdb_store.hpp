@@ -27,7 +27,13 @@ class LMDBStore {
     ~LMDBStore() = default;
 
     LMDBWriteTransaction::Ptr create_write_transaction() const;
+    LMDBWriteTransaction::Ptr create_write_transaction(LMDBWriteTransaction& parent) const;
     LMDBReadTransaction::Ptr create_read_transaction();
+    /**
+     * @brief Creates a transaction reading this store through the snapshot of another read transaction in the same
+     * environment. It does not take a reader of its own.
+     */
+    LMDBReadTransaction::Ptr create_read_transaction(const LMDBReadTransaction& snapshot) const;
 
   private:
     LMDBEnvironment& _environment;
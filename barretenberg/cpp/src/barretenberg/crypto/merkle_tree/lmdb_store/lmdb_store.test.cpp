@@ -1,9 +1,12 @@
 #include <cstdint>
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <chrono>
 #include <cstdlib>
 #include <filesystem>
+#include <optional>
+#include <span>
 #include <stdexcept>
 #include <thread>
 #include <vector>
@@ -311,6 +314,67 @@ TEST_F(LMDBStoreTest, can_retrieve_the_value_at_the_previous_key)
     }
 }
 
+TEST_F(LMDBStoreTest, can_retrieve_the_values_at_the_previous_keys_in_a_batch)
+{
+    LMDBStore store(*_environment, "note hash tree", false, false, integer_key_cmp);
+
+    auto& random_engine = bb::numeric::get_randomness();
+    const uint32_t num_keys = 64;
+    // ensure first key is at least 100
+    uint128_t key = random_engine.get_random_uint32() + 100;
+    std::vector<uint128_t> keys;
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (uint32_t i = 0; i < num_keys; i++) {
+            keys.push_back(key);
+            std::vector<uint8_t> value;
+            write(value, i);
+            transaction->put_value(key, value);
+            // Alternate between keys that are far apart and keys that are adjacent
+            key += i % 2 == 0 ? 1 : random_engine.get_random_uint32() + 50;
+        }
+        // Keys of different sizes must not be returned
+        std::vector<uint8_t> value;
+        write(value, num_keys);
+        uint64_t lower64 = static_cast<uint64_t>(keys[0]) - 50;
+        uint256_t higher256 = uint256_t::from_uint128(keys[num_keys - 1]) + 50;
+        transaction->put_value(lower64, value);
+        transaction->put_value(higher256, value);
+        transaction->commit();
+    }
+
+    // Query every stored key, the gaps either side of them and keys outside of the stored range, in descending order
+    std::vector<uint128_t> queries;
+    queries.push_back(keys[num_keys - 1] + 10);
+    for (uint32_t i = num_keys; i > 0; i--) {
+        queries.push_back(keys[i - 1]);
+        queries.push_back(keys[i - 1]);
+        queries.push_back(keys[i - 1] - 1);
+    }
+    queries.push_back(keys[0] - 10);
+    queries.push_back(0);
+
+    LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+    std::vector<uint128_t> found = queries;
+    std::vector<std::optional<std::span<const uint8_t>>> data;
+    transaction->get_values_or_previous(found, data);
+    EXPECT_EQ(data.size(), queries.size());
+
+    // The results must match those of individual lookups
+    for (size_t i = 0; i < queries.size(); i++) {
+        uint128_t expected_key = queries[i];
+        std::vector<uint8_t> expected;
+        bool success = transaction->get_value_or_previous(expected_key, expected);
+        EXPECT_EQ(data[i].has_value(), success);
+        if (success) {
+            EXPECT_EQ(found[i], expected_key);
+            EXPECT_TRUE(std::equal(data[i]->begin(), data[i]->end(), expected.begin(), expected.end()));
+        }
+    }
+    EXPECT_FALSE(data[queries.size() - 1].has_value());
+    EXPECT_EQ(from_buffer<uint32_t>(*data[1]), num_keys - 1);
+}
+
 TEST_F(LMDBStoreTest, can_not_retrieve_previous_key_from_empty_db)
 {
     LMDBStore store(*_environment, "note hash tree", false, false);
@@ -534,4 +598,42 @@ TEST_F(LMDBStoreTest, produces_correct_key_sizes)
         uint256_t value = random_engine.get_random_uint256();
         TestSerialisation(value, 32);
     }
-}
\ No newline at end of file
+}
+
+TEST_F(LMDBStoreTest, can_read_values_in_place)
+{
+    LMDBStore store(*_environment, "DB1", false, false, integer_key_cmp);
+    const uint32_t num_keys = 16;
+    {
+        LMDBWriteTransaction::Ptr transaction = store.create_write_transaction();
+        for (uint32_t i = 0; i < num_keys; i++) {
+            std::vector<uint8_t> buf;
+            write(buf, VALUES[i]);
+            transaction->put_node(10, i * 2, buf);
+        }
+        transaction->commit();
+    }
+
+    LMDBReadTransaction::Ptr transaction = store.create_read_transaction();
+    for (uint32_t i = 0; i < num_keys; i++) {
+        std::span<const uint8_t> data;
+        EXPECT_TRUE(transaction->get_node(10, i * 2, data));
+        EXPECT_EQ(data.size(), sizeof(bb::fr));
+        EXPECT_EQ(from_buffer<bb::fr>(data), VALUES[i]);
+
+        // The span matches the value copied out of the database
+        std::vector<uint8_t> copy;
+        EXPECT_TRUE(transaction->get_node(10, i * 2, copy));
+        EXPECT_TRUE(std::equal(data.begin(), data.end(), copy.begin(), copy.end()));
+    }
+
+    // Reading the previous key also returns the value in place and updates the key
+    NodeKeyType key = get_key_for_node(10, 5);
+    std::span<const uint8_t> data;
+    EXPECT_TRUE(transaction->get_value_or_previous(key, data));
+    EXPECT_EQ(key, get_key_for_node(10, 4));
+    EXPECT_EQ(from_buffer<bb::fr>(data), VALUES[2]);
+
+    std::span<const uint8_t> missing;
+    EXPECT_FALSE(transaction->get_node(10, 1, missing));
+}
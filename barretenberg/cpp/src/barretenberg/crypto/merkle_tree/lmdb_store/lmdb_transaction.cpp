@@ -2,15 +2,21 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
 
 namespace bb::crypto::merkle_tree {
-LMDBTransaction::LMDBTransaction(LMDBEnvironment& env, bool readOnly)
+LMDBTransaction::LMDBTransaction(LMDBEnvironment& env, bool readOnly, MDB_txn* parent)
     : _environment(env)
     , state(TransactionState::OPEN)
 {
-    MDB_txn* p = nullptr;
     call_lmdb_func(
-        "mdb_txn_begin", mdb_txn_begin, _environment.underlying(), p, readOnly ? MDB_RDONLY : 0U, &_transaction);
+        "mdb_txn_begin", mdb_txn_begin, _environment.underlying(), parent, readOnly ? MDB_RDONLY : 0U, &_transaction);
 }
 
+LMDBTransaction::LMDBTransaction(LMDBEnvironment& env, const LMDBTransaction& owner)
+    : _environment(env)
+    , _transaction(owner._transaction)
+    , state(TransactionState::OPEN)
+    , _ownsTransaction(false)
+{}
+
 LMDBTransaction::~LMDBTransaction() = default;
 
 MDB_txn* LMDBTransaction::underlying() const
@@ -18,12 +24,19 @@ MDB_txn* LMDBTransaction::underlying() const
     return _transaction;
 }
 
+uint64_t LMDBTransaction::id() const
+{
+    return mdb_txn_id(_transaction);
+}
+
 void LMDBTransaction::abort()
 {
     if (state != TransactionState::OPEN) {
         return;
     }
-    call_lmdb_func(mdb_txn_abort, _transaction);
+    if (_ownsTransaction) {
+        call_lmdb_func(mdb_txn_abort, _transaction);
+    }
     state = TransactionState::ABORTED;
 }
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
@@ -16,7 +16,11 @@ enum TransactionState {
 
 class LMDBTransaction {
   public:
-    LMDBTransaction(LMDBEnvironment& env, bool readOnly = false);
+    LMDBTransaction(LMDBEnvironment& env, bool readOnly = false, MDB_txn* parent = nullptr);
+    /*
+     * Shares the underlying transaction of another, which must outlive this one and remains responsible for ending it.
+     */
+    LMDBTransaction(LMDBEnvironment& env, const LMDBTransaction& owner);
     LMDBTransaction(const LMDBTransaction& other) = delete;
     LMDBTransaction(LMDBTransaction&& other) = delete;
     LMDBTransaction& operator=(const LMDBTransaction& other) = delete;
@@ -26,6 +30,12 @@ class LMDBTransaction {
 
     MDB_txn* underlying() const;
 
+    /*
+     * Returns the ID of the transaction. For read transactions this identifies the snapshot being read and changes
+     * with every commit to the environment.
+     */
+    uint64_t id() const;
+
     /*
      * Rolls back the transaction.
      * Must be called by read transactions to signal the end of the transaction.
@@ -37,5 +47,6 @@ class LMDBTransaction {
     LMDBEnvironment& _environment;
     MDB_txn* _transaction;
     TransactionState state;
+    bool _ownsTransaction = true;
 };
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
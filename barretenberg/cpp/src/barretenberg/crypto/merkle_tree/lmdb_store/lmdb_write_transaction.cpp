@@ -10,6 +10,13 @@ LMDBWriteTransaction::LMDBWriteTransaction(LMDBEnvironment& env, const LMDBDatab
     , _database(database)
 {}
 
+LMDBWriteTransaction::LMDBWriteTransaction(LMDBEnvironment& env,
+                                           const LMDBDatabase& database,
+                                           LMDBWriteTransaction& parent)
+    : LMDBTransaction(env, false, parent.underlying())
+    , _database(database)
+{}
+
 LMDBWriteTransaction::~LMDBWriteTransaction()
 {
     try_abort();
@@ -49,4 +56,52 @@ void LMDBWriteTransaction::put_value(std::vector<uint8_t>& key, std::vector<uint
     dbVal.mv_data = (void*)data.data();
     call_lmdb_func("mdb_put", mdb_put, underlying(), _database.underlying(), &dbKey, &dbVal, 0U);
 }
+
+void LMDBWriteTransaction::put_batch(const WriteBatch& batch)
+{
+    if (batch.empty()) {
+        return;
+    }
+    MDB_cursor* cursor = nullptr;
+    call_lmdb_func("mdb_cursor_open", mdb_cursor_open, underlying(), _database.underlying(), &cursor);
+    try {
+        // Take a copy of the last key, the memory it references can be modified by our writes
+        MDB_val dbKey;
+        MDB_val dbVal;
+        bool empty = mdb_cursor_get(cursor, &dbKey, &dbVal, MDB_LAST) == MDB_NOTFOUND;
+        std::vector<uint8_t> lastKey = empty ? std::vector<uint8_t>() : mdb_val_to_vector(dbKey);
+        MDB_val lastDbKey;
+        lastDbKey.mv_size = lastKey.size();
+        lastDbKey.mv_data = (void*)lastKey.data();
+
+        bool appending = empty;
+        for (size_t i = 0; i < batch.size(); ++i) {
+            MDB_val key = batch.key(i);
+            MDB_val value = batch.value(i);
+            // Once we pass the last key, every subsequent key in the sorted batch can also be appended
+            appending = appending || mdb_cmp(underlying(), _database.underlying(), &key, &lastDbKey) > 0;
+            call_lmdb_func("mdb_cursor_put", mdb_cursor_put, cursor, &key, &value, appending ? MDB_APPEND : 0U);
+        }
+    } catch (std::exception& e) {
+        call_lmdb_func(mdb_cursor_close, cursor);
+        throw;
+    }
+    call_lmdb_func(mdb_cursor_close, cursor);
+}
+
+bool LMDBWriteTransaction::delete_value(std::vector<uint8_t>& key)
+{
+    MDB_val dbKey;
+    dbKey.mv_size = key.size();
+    dbKey.mv_data = (void*)key.data();
+
+    int code = mdb_del(underlying(), _database.underlying(), &dbKey, nullptr);
+    if (code == MDB_NOTFOUND) {
+        return false;
+    }
+    if (code != 0) {
+        throw_error("mdb_del", code);
+    }
+    return true;
+}
 } // namespace bb::crypto::merkle_tree
@@ -3,6 +3,7 @@
 #include "barretenberg/crypto/merkle_tree/lmdb_store/callbacks.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_database.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_transaction.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/write_batch.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 
 namespace bb::crypto::merkle_tree {
@@ -19,6 +20,11 @@ class LMDBWriteTransaction : public LMDBTransaction {
     using Ptr = std::unique_ptr<LMDBWriteTransaction>;
 
     LMDBWriteTransaction(LMDBEnvironment& env, const LMDBDatabase& database);
+    /**
+     * @brief Creates a transaction nested within the given parent. Committing it makes its changes part of the parent,
+     * they are only persisted once the parent is committed. The parent must not be used until this transaction ends.
+     */
+    LMDBWriteTransaction(LMDBEnvironment& env, const LMDBDatabase& database, LMDBWriteTransaction& parent);
     LMDBWriteTransaction(const LMDBWriteTransaction& other) = delete;
     LMDBWriteTransaction(LMDBWriteTransaction&& other) = delete;
     LMDBWriteTransaction& operator=(const LMDBWriteTransaction& other) = delete;
@@ -31,6 +37,18 @@ class LMDBWriteTransaction : public LMDBTransaction {
 
     void put_value(std::vector<uint8_t>& key, std::vector<uint8_t>& data);
 
+    /**
+     * @brief Writes a batch of values through a single cursor. The batch must be sorted in the database's key order
+     * and contain unique keys. Entries with keys beyond the last key in the database are appended (MDB_APPEND),
+     * avoiding a search of the tree.
+     */
+    void put_batch(const WriteBatch& batch);
+
+    /**
+     * @brief Removes the value at the given key, returns false if the key did not exist
+     */
+    bool delete_value(std::vector<uint8_t>& key);
+
     void commit();
 
     void try_abort();
@@ -0,0 +1,95 @@
+#pragma once
+#include "barretenberg/common/serialize.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <lmdb.h>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief A batch of key/value pairs to be written to a store, serialised into a single contiguous buffer.
+ * An entry is started by providing its key, its value is then streamed in via write(). This allows values to be packed
+ * directly into the batch, e.g. by passing the batch to msgpack::pack as the output stream.
+ */
+class WriteBatch {
+  public:
+    WriteBatch() = default;
+    ~WriteBatch() = default;
+    WriteBatch(const WriteBatch& other) = delete;
+    WriteBatch(WriteBatch&& other) noexcept = default;
+    WriteBatch& operator=(const WriteBatch& other) = delete;
+    WriteBatch& operator=(WriteBatch&& other) noexcept = default;
+
+    void reserve(size_t numEntries, size_t numBytes)
+    {
+        entries_.reserve(numEntries);
+        buffer_.reserve(numBytes);
+    }
+
+    /**
+     * @brief Starts a new entry with the given key
+     */
+    void add_key(const std::vector<uint8_t>& key)
+    {
+        entries_.push_back(Entry{ buffer_.size(), key.size(), buffer_.size() + key.size(), 0 });
+        buffer_.insert(buffer_.end(), key.begin(), key.end());
+    }
+
+    /**
+     * @brief Appends data to the value of the current entry
+     */
+    void write(const char* data, size_t size)
+    {
+        buffer_.insert(buffer_.end(), data, data + size);
+        entries_.back().valueSize += size;
+    }
+
+    /**
+     * @brief Appends a value to the current entry in its fixed width binary encoding (see common/serialize.hpp), which
+     * can be read back in place without first being copied out of the database
+     */
+    template <typename T> void write_fixed_width(const T& value)
+    {
+        using serialize::write;
+        const size_t start = buffer_.size();
+        write(buffer_, value);
+        entries_.back().valueSize += buffer_.size() - start;
+    }
+
+    void add(const std::vector<uint8_t>& key, const std::vector<uint8_t>& value)
+    {
+        add_key(key);
+        write(reinterpret_cast<const char*>(value.data()), value.size());
+    }
+
+    size_t size() const { return entries_.size(); }
+
+    bool empty() const { return entries_.empty(); }
+
+    MDB_val key(size_t i) const { return to_val(entries_[i].keyOffset, entries_[i].keySize); }
+
+    MDB_val value(size_t i) const { return to_val(entries_[i].valueOffset, entries_[i].valueSize); }
+
+  private:
+    struct Entry {
+        size_t keyOffset;
+        size_t keySize;
+        size_t valueOffset;
+        size_t valueSize;
+    };
+
+    std::vector<Entry> entries_;
+    std::vector<uint8_t> buffer_;
+
+    MDB_val to_val(size_t offset, size_t size) const
+    {
+        MDB_val val;
+        val.mv_size = size;
+        // LMDB does not modify the data provided to it on writes
+        val.mv_data = const_cast<uint8_t*>(buffer_.data() + offset); // NOLINT
+        return val;
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
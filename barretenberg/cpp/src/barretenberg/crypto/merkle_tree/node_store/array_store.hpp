@@ -41,10 +41,8 @@ template <typename PersistedStore> class ArrayStore {
     using WriteTransaction = typename PersistedStore::WriteTransaction;
     using ReadTransactionPtr = std::unique_ptr<ReadTransaction>;
     ArrayStore(const std::string& name, uint32_t depth, index_t indices = 1024)
-        : map(std::vector<std::vector<std::pair<bool, std::vector<uint8_t>>>>(
-              depth + 1,
-              std::vector<std::pair<bool, std::vector<uint8_t>>>(
-                  indices, std::pair<bool, std::vector<uint8_t>>(false, std::vector<uint8_t>()))))
+        : map(std::vector<std::vector<std::pair<bool, fr>>>(
+              depth + 1, std::vector<std::pair<bool, fr>>(indices, std::pair<bool, fr>(false, fr::zero()))))
     {
         meta.depth = depth;
         meta.name = name;
@@ -58,15 +56,12 @@ template <typename PersistedStore> class ArrayStore {
     ArrayStore& operator=(ArrayStore const& other) = delete;
     ArrayStore& operator=(ArrayStore const&& other) = delete;
 
-    void put_node(uint32_t level, index_t index, const std::vector<uint8_t>& data)
+    void put_node(uint32_t level, index_t index, const fr& value) { map[level][index] = std::make_pair(true, value); }
+    bool get_node(uint32_t level, index_t index, fr& value, ReadTransaction&, bool) const
     {
-        map[level][index] = std::make_pair(true, data);
-    }
-    bool get_node(uint32_t level, index_t index, std::vector<uint8_t>& data, ReadTransaction&, bool) const
-    {
-        const std::pair<bool, std::vector<uint8_t>>& slot = map[level][index];
+        const std::pair<bool, fr>& slot = map[level][index];
         if (slot.first) {
-            data = slot.second;
+            value = slot.second;
         }
         return slot.first;
     }
@@ -88,7 +83,7 @@ template <typename PersistedStore> class ArrayStore {
     ReadTransactionPtr create_read_transactiono() { return std::make_unique<ReadTransaction>(); }
 
   private:
-    std::vector<std::vector<std::pair<bool, std::vector<uint8_t>>>> map;
+    std::vector<std::vector<std::pair<bool, fr>>> map;
     TreeMeta meta;
 };
 } // namespace bb::crypto::merkle_tree
\ No newline at end of file
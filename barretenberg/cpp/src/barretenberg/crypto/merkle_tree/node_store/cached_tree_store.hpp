@@ -1,18 +1,33 @@
 #pragma once
+#include "./hot_node_cache.hpp"
+#include "./node_cache.hpp"
 #include "./tree_meta.hpp"
+#include "barretenberg/common/serialize.hpp"
+#include "barretenberg/common/thread_pool.hpp"
+#include "barretenberg/common/timer.hpp"
 #include "barretenberg/crypto/merkle_tree/indexed_tree/indexed_leaf.hpp"
 #include "barretenberg/crypto/merkle_tree/lmdb_store/lmdb_store.hpp"
+#include "barretenberg/crypto/merkle_tree/lmdb_store/write_batch.hpp"
+#include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/crypto/merkle_tree/types.hpp"
 #include "barretenberg/numeric/uint256/uint256.hpp"
 #include "barretenberg/serialize/msgpack.hpp"
 #include "barretenberg/stdlib/primitives/field/field.hpp"
 #include "msgpack/assert.hpp"
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cstdint>
 #include <exception>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
+#include <span>
+#include <string>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 
@@ -24,6 +39,14 @@ namespace bb::crypto::merkle_tree {
  * 8 byte integers: The index of each leaf to the value of that leaf
  * 16 byte integers: Nodes in the tree, key value = ((2 ^ level) + index - 1)
  * 32 bytes integers: The value of the leaf (32 bytes) to the set of indices where the leaf exists in the tree.
+ *
+ * If constructed with a non-zero number of historic blocks to retain, every commit is recorded as a new block and the
+ * store additionally keeps a copy-on-write history of the tree. Each commit writes a new version of only the nodes and
+ * leaves that it modified, keyed by (coordinates, block). The state as of any retained block is then read by seeking
+ * to the latest version at or before that block, requiring one read per node. Versions that are no longer visible to
+ * any retained block are journaled against the block that superseded them and deleted once that block falls outside of
+ * the retention window. Indexed trees also record a link from each leaf to its low leaf as of the block before it was
+ * inserted, which bounds the number of reads needed to find a low leaf as of a retained block.
  */
 template <typename PersistedStore, typename LeafValueType> class CachedTreeStore {
   public:
@@ -35,12 +58,107 @@ template <typename PersistedStore, typename LeafValueType> class CachedTreeStore
     using ReadTransactionPtr = std::unique_ptr<ReadTransaction>;
     using WriteTransactionPtr = std::unique_ptr<WriteTransaction>;
 
-    CachedTreeStore(std::string name, uint32_t levels, PersistedStore& dataStore)
+    // Writes are grouped into batches by key space. Each batch is sorted and the batches are listed in the database's
+    // key order (by key size) so the whole commit is written in key order
+    enum CommitBatch { LEAVES, BLOCK, NODES, HISTORIC_LEAVES, HISTORIC_NODES, INDICES, NUM_COMMIT_BATCHES };
+
+    /**
+     * @brief A commit in progress. Its batches are serialised on a thread pool, overlapping with reading the persisted
+     * state and with writing the earlier batches. The writer serialises any batch that the pool has yet to start
+     * itself, so a commit never waits on a busy pool, including the one it is running on.
+     */
+    struct PendingCommit {
+        std::vector<WriteBatch> batches = std::vector<WriteBatch>(NUM_COMMIT_BATCHES);
+        std::vector<std::function<void()>> serialisers = std::vector<std::function<void()>>(NUM_COMMIT_BATCHES);
+        // Set once a batch's serialiser has been taken by either the pool or the writer. Shared with the pool's tasks,
+        // which can outlive an abandoned commit
+        std::shared_ptr<std::vector<std::atomic<bool>>> claimed =
+            std::make_shared<std::vector<std::atomic<bool>>>(NUM_COMMIT_BATCHES);
+        std::vector<Signal> serialised = std::vector<Signal>(NUM_COMMIT_BATCHES);
+        std::atomic<uint64_t> serialiseTime = 0;
+        std::mutex errorMutex;
+        std::exception_ptr serialiseError;
+        std::vector<std::vector<uint8_t>> prunable;
+        // The meta data being committed. The store's own meta data is only updated once the commit completes
+        TreeMeta meta;
+        // The persisted indices of each uncommitted leaf value, in the order of the uncommitted indices
+        std::vector<std::vector<index_t>> committedIndices;
+        CommitStats stats;
+
+        PendingCommit() = default;
+        PendingCommit(PendingCommit const& other) = delete;
+        PendingCommit(PendingCommit&& other) = delete;
+        PendingCommit& operator=(PendingCommit const& other) = delete;
+        PendingCommit& operator=(PendingCommit&& other) = delete;
+        ~PendingCommit()
+        {
+            // Cancel the serialisers yet to start and wait for the rest, they reference the commit and the store
+            for (size_t batch = 0; batch < NUM_COMMIT_BATCHES; ++batch) {
+                if ((*claimed)[batch].exchange(true)) {
+                    serialised[batch].wait_for_level(0);
+                }
+            }
+        }
+
+        /**
+         * @brief Serialises a batch on the thread pool
+         */
+        void start(CommitBatch batch, ThreadPool& workers, std::function<void(WriteBatch&)> func)
+        {
+            serialisers[batch] = [this, batch, func = std::move(func)]() {
+                Timer timer;
+                try {
+                    func(batches[batch]);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(errorMutex);
+                    serialiseError = std::current_exception();
+                }
+                serialiseTime += static_cast<uint64_t>(timer.nanoseconds());
+                serialised[batch].signal_level(0);
+            };
+            workers.enqueue([this, batch, flags = claimed]() {
+                // The commit is only guaranteed to exist if the serialiser has not been claimed
+                if (!(*flags)[batch].exchange(true)) {
+                    serialisers[batch]();
+                }
+            });
+        }
+
+        /**
+         * @brief Marks a batch as having nothing to serialise
+         */
+        void skip(CommitBatch batch)
+        {
+            (*claimed)[batch] = true;
+            serialised[batch].signal_level(0);
+        }
+
+        /**
+         * @brief Waits for a batch to be serialised, serialising it on the calling thread if the pool has not started
+         */
+        void await(CommitBatch batch)
+        {
+            if (!(*claimed)[batch].exchange(true)) {
+                serialisers[batch]();
+            }
+            serialised[batch].wait_for_level(0);
+        }
+    };
+    using PendingCommitPtr = std::unique_ptr<PendingCommit>;
+
+    CachedTreeStore(std::string name,
+                    uint32_t levels,
+                    PersistedStore& dataStore,
+                    index_t historicBlocksToRetain = 0,
+                    const ReadTransaction* snapshot = nullptr,
+                    std::shared_ptr<HotNodeCache> committedNodeCache = nullptr)
         : name(std::move(name))
         , depth(levels)
-        , nodes(std::vector<std::unordered_map<index_t, std::vector<uint8_t>>>(
-              depth + 1, std::unordered_map<index_t, std::vector<uint8_t>>()))
+        , nodes(depth + 1)
+        , committedNodes(committedNodeCache ? std::move(committedNodeCache) : std::make_shared<HotNodeCache>(depth))
         , dataStore(dataStore)
+        , snapshot(snapshot)
+        , historicBlocksToRetain(historicBlocksToRetain)
     {
         initialise();
     }
@@ -57,6 +175,14 @@ template <typename PersistedStore, typename LeafValueType> class CachedTreeStore
      */
     std::pair<bool, index_t> find_low_value(const fr& new_leaf_key, bool includeUncommitted, ReadTransaction& tx) const;
 
+    /**
+     * @brief Performs find_low_value for a batch of keys, which must be in descending order. The committed low values
+     * are found in a single walk of a database cursor
+     */
+    std::vector<std::pair<bool, index_t>> find_low_values(const std::vector<fr>& new_leaf_keys,
+                                                          bool includeUncommitted,
+                                                          ReadTransaction& tx) const;
+
     /**
      * @brief Returns the leaf at the provided index, if one exists
      */
@@ -75,16 +201,16 @@ template <typename PersistedStore, typename LeafValueType> class CachedTreeStore
     void update_index(const index_t& index, const fr& leaf);
 
     /**
-     * @brief Writes the provided data at the given node coordinates. Only writes to uncommitted data.
+     * @brief Writes the provided value at the given node coordinates. Only writes to uncommitted data.
      */
-    void put_node(uint32_t level, index_t index, const std::vector<uint8_t>& data);
+    void put_node(uint32_t level, index_t index, const fr& value);
 
     /**
-     * @brief Returns the data at the given node coordinates if available. Reads from uncommitted state if requested.
+     * @brief Returns the value at the given node coordinates if available. Reads from uncommitted state if requested.
      */
     bool get_node(uint32_t level,
                   index_t index,
-                  std::vector<uint8_t>& data,
+                  fr& value,
                   ReadTransaction& transaction,
                   bool includeUncommitted) const;
 
@@ -124,24 +250,120 @@ template <typename PersistedStore, typename LeafValueType> class CachedTreeStore
                                                 bool includeUncommitted) const;
 
     /**
-     * @brief Commits the uncommitted data to the underlying store
+     * @brief Commits the uncommitted data to the underlying store as the next block, serialising it on the given pool
      */
-    void commit();
+    void commit(ThreadPool& workers);
+
+    /**
+     * @brief Begins committing the uncommitted data as the next block. Validates that the data can be committed and
+     * starts serialising it on the given pool. The commit is then written via write_commit and finished with
+     * complete_commit once the write transaction has been committed. Allows the commits of several stores sharing an
+     * environment to be written in a single transaction. The store's state is not modified until complete_commit, so
+     * a commit that fails or is abandoned leaves the uncommitted state as it was.
+     */
+    PendingCommitPtr prepare_commit(ThreadPool& workers);
+
+    /**
+     * @brief Writes a prepared commit in a transaction nested within the given write transaction, which may be
+     * against any store in the same environment. The commit is only persisted once that transaction is committed.
+     */
+    void write_commit(PendingCommit& pending, WriteTransaction& tx);
+
+    /**
+     * @brief Completes a commit once its write transaction has been committed, clearing the uncommitted state
+     */
+    void complete_commit(PendingCommit& pending);
+
+    /**
+     * @brief Commits the uncommitted data to the underlying store as the initial state of the tree (block 0). The
+     * genesis state can't be modified once further blocks have been committed, in which case the uncommitted data is
+     * discarded.
+     */
+    void commit_genesis_state(ThreadPool& workers);
 
     /**
      * @brief Rolls back the uncommitted state
      */
     void rollback();
 
+    /**
+     * @brief Returns the timings of the phases of the most recent commit
+     */
+    CommitStats get_last_commit_stats() const { return lastCommitStats; }
+
+    /**
+     * @brief Returns the number of hits and misses of the committed node cache
+     */
+    NodeCacheStats get_node_cache_stats() const { return committedNodes->get_stats(); }
+
+    /**
+     * @brief Returns the cache of committed nodes, which can be shared with other stores of the same persisted store
+     */
+    std::shared_ptr<HotNodeCache> get_committed_node_cache() const { return committedNodes; }
+
+    /**
+     * @brief Returns true if the state as of previous blocks is retained by this store
+     */
+    bool is_retaining_history() const { return historicBlocksToRetain > 0; }
+
+    /**
+     * @brief Returns true if the persisted store is read through a snapshot, as it is by the store of a fork
+     */
+    bool has_snapshot() const { return snapshot != nullptr; }
+
+    /**
+     * @brief Reads the size and root of the tree as of the given block. Throws if the block is not retained.
+     */
+    void get_block_meta(const index_t& blockNumber, index_t& size, bb::fr& root, ReadTransaction& tx) const;
+
+    /**
+     * @brief Returns the value at the given node coordinates as of the given block if available. Does not validate
+     * that the block is retained, that is expected to have been done once via get_block_meta.
+     */
+    bool get_node_at_block(
+        uint32_t level, index_t index, const index_t& blockNumber, fr& value, ReadTransaction& tx) const;
+
+    /**
+     * @brief Returns the leaf at the provided index as of the given block, if one exists
+     */
+    std::optional<IndexedLeafValueType> get_leaf_at_block(const index_t& index,
+                                                          const index_t& blockNumber,
+                                                          ReadTransaction& tx) const;
+
+    /**
+     * @brief Returns the index of the leaf with a value immediately lower than the value provided as of the given
+     * block. Starts from the current low leaf and follows the low leaf links back to the first leaf present as of the
+     * block, requiring O(log n) reads regardless of the number of leaves inserted since.
+     */
+    std::pair<bool, index_t> find_low_value_at_block(const fr& new_leaf_key,
+                                                     const index_t& blockNumber,
+                                                     ReadTransaction& tx) const;
+
+    /**
+     * @brief Finds the index of the given leaf value as of the given block, only considering indices from start_index
+     */
+    std::optional<index_t> find_leaf_index_from_at_block(const LeafValueType& leaf,
+                                                         index_t start_index,
+                                                         const index_t& blockNumber,
+                                                         ReadTransaction& tx) const;
+
     /**
      * @brief Returns the name of the tree
      */
     std::string get_name() const { return name; }
 
     /**
-     * @brief Returns a read transaction against the underlying store.
+     * @brief Returns the depth of the tree
      */
-    ReadTransactionPtr create_read_transaction() const { return dataStore.create_read_transaction(); }
+    uint32_t get_depth() const { return depth; }
+
+    /**
+     * @brief Returns a read transaction against the underlying store, through the store's snapshot if it has one.
+     */
+    ReadTransactionPtr create_read_transaction() const
+    {
+        return snapshot == nullptr ? dataStore.create_read_transaction() : dataStore.create_read_transaction(*snapshot);
+    }
 
   private:
     struct Indices {
@@ -150,18 +372,80 @@ template <typename PersistedStore, typename LeafValueType> class CachedTreeStore
         MSGPACK_FIELDS(indices);
     };
 
+    using LeafEntry = std::pair<const index_t, IndexedLeafValueType>;
+
+    // Used to preallocate the buffers for serialising a commit
+    static constexpr size_t ESTIMATED_LEAF_WRITE_SIZE = 128;
+    static constexpr size_t ESTIMATED_HISTORIC_KEY_SIZE = 21;
+    static constexpr size_t ESTIMATED_INDICES_SIZE = 16;
+
     std::string name;
     uint32_t depth;
-    std::vector<std::unordered_map<index_t, std::vector<uint8_t>>> nodes;
+    // Uncommitted nodes, one cache per level
+    std::vector<NodeLevelCache> nodes;
+    // Committed nodes of the upper levels, shared by all readers and possibly other stores
+    std::shared_ptr<HotNodeCache> committedNodes;
     std::map<uint256_t, Indices> indices_;
     std::unordered_map<index_t, IndexedLeafValueType> leaves_;
     PersistedStore& dataStore;
+    // If set, the persisted store is read as of this snapshot rather than its latest state. Must outlive the store
+    const ReadTransaction* snapshot;
     TreeMeta meta;
+    index_t historicBlocksToRetain;
+    CommitStats lastCommitStats;
 
     void initialise();
 
+    void commit_block(const index_t& blockNumber, ThreadPool& workers);
+
+    PendingCommitPtr prepare_commit_block(const index_t& blockNumber, ThreadPool& workers);
+
+    void write_batches(PendingCommit& pending, WriteTransaction& tx);
+
+    void collect_superseded_history(const index_t& blockNumber,
+                                    std::vector<std::vector<uint8_t>>& superseded,
+                                    ReadTransaction& tx) const;
+
+    void collect_prunable_history(const index_t& blockNumber,
+                                  std::vector<std::vector<uint8_t>>& superseded,
+                                  PendingCommit& pending,
+                                  ReadTransaction& tx) const;
+
+    void collect_low_leaf_links(std::vector<std::pair<index_t, LowLeafLink>>& links, ReadTransaction& tx) const;
+
+    LowLeafLink read_low_leaf_link(const index_t& index, ReadTransaction& tx) const;
+
+    std::vector<const LeafEntry*> get_sorted_leaves() const;
+
+    std::vector<const NodeLevelCache::Entry*> get_sorted_nodes(uint32_t level) const;
+
+    void serialise_leaves(WriteBatch& batch) const;
+
+    void serialise_historic_leaves(const index_t& blockNumber, WriteBatch& batch) const;
+
+    void serialise_nodes(WriteBatch& batch) const;
+
+    void serialise_historic_nodes(const index_t& blockNumber, WriteBatch& batch) const;
+
+    void serialise_indices(std::vector<std::vector<index_t>>& committedIndices, WriteBatch& batch) const;
+
+    void serialise_block(const index_t& blockNumber,
+                         const std::vector<std::vector<uint8_t>>& superseded,
+                         const std::vector<std::pair<index_t, LowLeafLink>>& links,
+                         WriteBatch& batch) const;
+
+    // Combines the low value found in the database with those in the uncommitted index
+    std::pair<bool, index_t> merge_low_value(const uint256_t& new_value_as_number,
+                                             const uint256_t& retrieved_value,
+                                             const index_t& db_index,
+                                             bool includeUncommitted) const;
+
     bool read_persisted_meta(TreeMeta& m, ReadTransaction& tx) const;
 
+    // Decodes a value read in place from the persisted store, validating that it is the size of its fixed width
+    // encoding
+    template <typename T> T decode_fixed_width(std::span<const uint8_t> data) const;
+
     void persist_meta(TreeMeta& m, WriteTransaction& tx);
 
     WriteTransactionPtr create_write_transaction() const { return dataStore.create_write_transaction(); }
@@ -172,14 +456,47 @@ std::pair<bool, index_t> CachedTreeStore<PersistedStore, LeafValueType>::find_lo
                                                                                         bool includeUncommitted,
                                                                                         ReadTransaction& tx) const
 {
-    uint256_t new_value_as_number = uint256_t(new_leaf_key);
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     FrKeyType key(new_leaf_key);
     tx.get_value_or_previous(key, data);
     Indices committed;
-    msgpack::unpack((const char*)data.data(), data.size()).get().convert(committed);
-    auto db_index = committed.indices[0];
-    uint256_t retrieved_value = key;
+    msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(committed);
+    return merge_low_value(uint256_t(new_leaf_key), key, committed.indices[0], includeUncommitted);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::vector<std::pair<bool, index_t>> CachedTreeStore<PersistedStore, LeafValueType>::find_low_values(
+    const std::vector<fr>& new_leaf_keys, bool includeUncommitted, ReadTransaction& tx) const
+{
+    std::vector<FrKeyType> keys;
+    keys.reserve(new_leaf_keys.size());
+    for (const fr& new_leaf_key : new_leaf_keys) {
+        keys.emplace_back(new_leaf_key);
+    }
+    std::vector<std::optional<std::span<const uint8_t>>> data;
+    tx.get_values_or_previous(keys, data);
+
+    std::vector<std::pair<bool, index_t>> low_values;
+    low_values.reserve(keys.size());
+    for (size_t i = 0; i < keys.size(); ++i) {
+        if (!data[i].has_value()) {
+            throw std::runtime_error("Failed to find low value");
+        }
+        Indices committed;
+        msgpack::unpack(reinterpret_cast<const char*>(data[i]->data()), data[i]->size()).get().convert(committed);
+        low_values.push_back(
+            merge_low_value(uint256_t(new_leaf_keys[i]), keys[i], committed.indices[0], includeUncommitted));
+    }
+    return low_values;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::pair<bool, index_t> CachedTreeStore<PersistedStore, LeafValueType>::merge_low_value(
+    const uint256_t& new_value_as_number,
+    const uint256_t& retrieved_value,
+    const index_t& db_index,
+    bool includeUncommitted) const
+{
     if (!includeUncommitted || retrieved_value == new_value_as_number || indices_.empty()) {
         return std::make_pair(new_value_as_number == retrieved_value, db_index);
     }
@@ -224,12 +541,10 @@ std::optional<typename CachedTreeStore<PersistedStore, LeafValueType>::IndexedLe
         }
     }
     LeafIndexKeyType key = index;
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     bool success = tx.get_value(key, data);
     if (success) {
-        IndexedLeafValueType return_value;
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(return_value);
-        return return_value;
+        return decode_fixed_width<IndexedLeafValueType>(data);
     }
     return std::nullopt;
 }
@@ -280,10 +595,10 @@ std::optional<index_t> CachedTreeStore<PersistedStore, LeafValueType>::find_leaf
     Indices committed;
     std::optional<index_t> result = std::nullopt;
     FrKeyType key = leaf;
-    std::vector<uint8_t> value;
+    std::span<const uint8_t> value;
     bool success = tx.get_value(key, value);
     if (success) {
-        msgpack::unpack((const char*)value.data(), value.size()).get().convert(committed);
+        msgpack::unpack(reinterpret_cast<const char*>(value.data()), value.size()).get().convert(committed);
         if (!committed.indices.empty()) {
             for (size_t i = 0; i < committed.indices.size(); ++i) {
                 index_t ind = committed.indices[i];
@@ -318,29 +633,40 @@ std::optional<index_t> CachedTreeStore<PersistedStore, LeafValueType>::find_leaf
 }
 
 template <typename PersistedStore, typename LeafValueType>
-void CachedTreeStore<PersistedStore, LeafValueType>::put_node(uint32_t level,
-                                                              index_t index,
-                                                              const std::vector<uint8_t>& data)
+void CachedTreeStore<PersistedStore, LeafValueType>::put_node(uint32_t level, index_t index, const fr& value)
 {
-    nodes[level][index] = data;
+    nodes[level].put(index, value);
 }
 
 template <typename PersistedStore, typename LeafValueType>
-bool CachedTreeStore<PersistedStore, LeafValueType>::get_node(uint32_t level,
-                                                              index_t index,
-                                                              std::vector<uint8_t>& data,
-                                                              ReadTransaction& transaction,
-                                                              bool includeUncommitted) const
+bool CachedTreeStore<PersistedStore, LeafValueType>::get_node(
+    uint32_t level, index_t index, fr& value, ReadTransaction& transaction, bool includeUncommitted) const
 {
-    if (includeUncommitted) {
-        const auto& level_map = nodes[level];
-        auto it = level_map.find(index);
-        if (it != level_map.end()) {
-            data = it->second;
-            return true;
+    if (includeUncommitted && nodes[level].get(index, value)) {
+        return true;
+    }
+    if (!committedNodes->is_cached(level, index)) {
+        std::span<const uint8_t> data;
+        if (!transaction.get_node(level, index, data)) {
+            return false;
+        }
+        value = decode_fixed_width<fr>(data);
+        return true;
+    }
+    const uint64_t snapshot = transaction.id();
+    std::optional<fr> node;
+    if (!committedNodes->get(level, index, snapshot, node)) {
+        std::span<const uint8_t> data;
+        if (transaction.get_node(level, index, data)) {
+            node = decode_fixed_width<fr>(data);
         }
+        committedNodes->put(level, index, snapshot, node);
     }
-    return transaction.get_node(level, index, data);
+    if (!node.has_value()) {
+        return false;
+    }
+    value = node.value();
+    return true;
 }
 
 template <typename PersistedStore, typename LeafValueType>
@@ -386,55 +712,505 @@ void CachedTreeStore<PersistedStore, LeafValueType>::get_full_meta(
     name = m.name;
 }
 
-template <typename PersistedStore, typename LeafValueType> void CachedTreeStore<PersistedStore, LeafValueType>::commit()
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::commit(ThreadPool& workers)
+{
+    commit_block(meta.blockHeight + 1, workers);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::commit_genesis_state(ThreadPool& workers)
 {
+    if (meta.blockHeight != 0) {
+        rollback();
+        return;
+    }
+    commit_block(0, workers);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::commit_block(const index_t& blockNumber, ThreadPool& workers)
+{
+    PendingCommitPtr pending = prepare_commit_block(blockNumber, workers);
+    WriteTransactionPtr tx = create_write_transaction();
+    try {
+        write_batches(*pending, *tx);
+        Timer commitTimer;
+        tx->commit();
+        pending->stats.commitTimeNs = static_cast<uint64_t>(commitTimer.nanoseconds());
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw;
+    }
+    complete_commit(*pending);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+typename CachedTreeStore<PersistedStore, LeafValueType>::PendingCommitPtr CachedTreeStore<
+    PersistedStore,
+    LeafValueType>::prepare_commit(ThreadPool& workers)
+{
+    return prepare_commit_block(meta.blockHeight + 1, workers);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+typename CachedTreeStore<PersistedStore, LeafValueType>::PendingCommitPtr CachedTreeStore<
+    PersistedStore,
+    LeafValueType>::prepare_commit_block(const index_t& blockNumber, ThreadPool& workers)
+{
+    PendingCommitPtr pending = std::make_unique<PendingCommit>();
+    PendingCommit& c = *pending;
+    c.start(LEAVES, workers, [this](WriteBatch& b) { serialise_leaves(b); });
+    c.start(NODES, workers, [this](WriteBatch& b) { serialise_nodes(b); });
+    if (is_retaining_history()) {
+        c.start(HISTORIC_LEAVES, workers, [=, this](WriteBatch& b) { serialise_historic_leaves(blockNumber, b); });
+        c.start(HISTORIC_NODES, workers, [=, this](WriteBatch& b) { serialise_historic_nodes(blockNumber, b); });
+    } else {
+        c.skip(HISTORIC_LEAVES);
+        c.skip(HISTORIC_NODES);
+    }
+
+    c.meta = meta;
+    c.meta.blockHeight = blockNumber;
+    std::vector<std::vector<uint8_t>> superseded;
+    std::vector<std::pair<index_t, LowLeafLink>> links;
     {
-        {
-            ReadTransactionPtr tx = create_read_transaction();
-            for (auto& idx : indices_) {
-                std::vector<uint8_t> value;
-                FrKeyType key = idx.first;
-                bool success = tx->get_value(key, value);
-                if (success) {
-                    Indices indices;
-                    msgpack::unpack((const char*)value.data(), value.size()).get().convert(indices);
-                    idx.second.indices.insert(
-                        idx.second.indices.begin(), indices.indices.begin(), indices.indices.end());
-                }
-            }
+        Timer timer;
+        // The commit is written on top of the latest committed state, so read that rather than any snapshot
+        ReadTransactionPtr tx = dataStore.create_read_transaction();
+        // Uncommitted state can only be committed on top of the block it was built from. Another store instance
+        // sharing the same persisted store may have committed since
+        TreeMeta committedMeta;
+        if (read_persisted_meta(committedMeta, *tx) && committedMeta.blockHeight != meta.blockHeight) {
+            throw std::runtime_error("Tree " + name + " has been committed to since its uncommitted state was created");
         }
-        WriteTransactionPtr tx = create_write_transaction();
-        try {
-            for (uint32_t i = 1; i < nodes.size(); i++) {
-                auto& level = nodes[i];
-                for (auto& item : level) {
-                    index_t index = item.first;
-                    std::vector<uint8_t>& data = item.second;
-                    tx->put_node(i, index, data);
-                }
+        c.committedIndices.reserve(indices_.size());
+        for (const auto& idx : indices_) {
+            std::span<const uint8_t> value;
+            FrKeyType key = idx.first;
+            Indices indices;
+            if (tx->get_value(key, value)) {
+                msgpack::unpack(reinterpret_cast<const char*>(value.data()), value.size()).get().convert(indices);
             }
-            for (auto& idx : indices_) {
-                msgpack::sbuffer buffer;
-                msgpack::pack(buffer, idx.second);
-                std::vector<uint8_t> encoded(buffer.data(), buffer.data() + buffer.size());
-                FrKeyType key = idx.first;
-                tx->put_value(key, encoded);
+            c.committedIndices.push_back(std::move(indices.indices));
+        }
+        if (is_retaining_history()) {
+            collect_superseded_history(blockNumber, superseded, *tx);
+            collect_prunable_history(blockNumber, superseded, c, *tx);
+            collect_low_leaf_links(links, *tx);
+        }
+        c.stats.readTimeNs = static_cast<uint64_t>(timer.nanoseconds());
+    }
+
+    c.start(INDICES, workers, [this, &c](WriteBatch& b) { serialise_indices(c.committedIndices, b); });
+    if (is_retaining_history()) {
+        c.start(BLOCK,
+                workers,
+                [this, blockNumber, superseded = std::move(superseded), links = std::move(links)](WriteBatch& b) {
+                    serialise_block(blockNumber, superseded, links, b);
+                });
+    } else {
+        c.skip(BLOCK);
+    }
+    return pending;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::write_commit(PendingCommit& pending, WriteTransaction& tx)
+{
+    WriteTransactionPtr nested = dataStore.create_write_transaction(tx);
+    try {
+        write_batches(pending, *nested);
+        nested->commit();
+    } catch (std::exception& e) {
+        nested->try_abort();
+        throw;
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::complete_commit(PendingCommit& pending)
+{
+    pending.stats.serialiseTimeNs = pending.serialiseTime;
+    lastCommitStats = pending.stats;
+    // Clears the uncommitted state and reads back the meta data that has just been committed
+    rollback();
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::write_batches(PendingCommit& pending, WriteTransaction& tx)
+{
+    Timer writeTimer;
+    for (size_t batch = 0; batch < NUM_COMMIT_BATCHES; ++batch) {
+        if (batch == NODES) {
+            // Keys are ordered by size first. The meta data is stored against the root's node key, so precedes the
+            // other nodes
+            persist_meta(pending.meta, tx);
+        }
+        pending.await(static_cast<CommitBatch>(batch));
+        {
+            std::lock_guard<std::mutex> lock(pending.errorMutex);
+            if (pending.serialiseError) {
+                std::rethrow_exception(pending.serialiseError);
             }
-            for (const auto& leaf : leaves_) {
-                msgpack::sbuffer buffer;
-                msgpack::pack(buffer, leaf.second);
-                std::vector<uint8_t> value(buffer.data(), buffer.data() + buffer.size());
-                LeafIndexKeyType key = leaf.first;
-                tx->put_value(key, value);
+        }
+        tx.put_batch(pending.batches[batch]);
+        pending.stats.numWrites += pending.batches[batch].size();
+    }
+    for (auto& key : pending.prunable) {
+        tx.delete_value(key);
+    }
+    pending.stats.writeTimeNs = static_cast<uint64_t>(writeTimer.nanoseconds());
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::vector<const typename CachedTreeStore<PersistedStore, LeafValueType>::LeafEntry*> CachedTreeStore<
+    PersistedStore,
+    LeafValueType>::get_sorted_leaves() const
+{
+    std::vector<const LeafEntry*> sorted;
+    sorted.reserve(leaves_.size());
+    for (const auto& leaf : leaves_) {
+        sorted.push_back(&leaf);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+    return sorted;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::vector<const NodeLevelCache::Entry*> CachedTreeStore<PersistedStore, LeafValueType>::get_sorted_nodes(
+    uint32_t level) const
+{
+    std::vector<const NodeLevelCache::Entry*> sorted;
+    sorted.reserve(nodes[level].size());
+    for (const auto& entry : nodes[level].entries()) {
+        sorted.push_back(&entry);
+    }
+    std::sort(sorted.begin(), sorted.end(), [](const auto* a, const auto* b) { return a->first < b->first; });
+    return sorted;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::serialise_leaves(WriteBatch& batch) const
+{
+    batch.reserve(leaves_.size(), leaves_.size() * ESTIMATED_LEAF_WRITE_SIZE);
+    for (const auto* leaf : get_sorted_leaves()) {
+        LeafIndexKeyType key = leaf->first;
+        batch.add_key(serialise_key(key));
+        batch.write_fixed_width(leaf->second);
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::serialise_historic_leaves(const index_t& blockNumber,
+                                                                               WriteBatch& batch) const
+{
+    batch.reserve(leaves_.size(), leaves_.size() * ESTIMATED_LEAF_WRITE_SIZE);
+    for (const auto* leaf : get_sorted_leaves()) {
+        batch.add_key(get_key_for_historic_leaf(leaf->first, blockNumber));
+        batch.write_fixed_width(leaf->second);
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::serialise_nodes(WriteBatch& batch) const
+{
+    size_t numNodes = 0;
+    for (const auto& level : nodes) {
+        numNodes += level.size();
+    }
+    batch.reserve(numNodes, numNodes * (sizeof(NodeKeyType) + sizeof(fr)));
+    // Node keys are ordered by level, then by index
+    for (uint32_t i = 1; i < nodes.size(); i++) {
+        for (const auto* entry : get_sorted_nodes(i)) {
+            batch.add_key(serialise_key(get_key_for_node(i, entry->first)));
+            batch.write_fixed_width(entry->second);
+        }
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::serialise_historic_nodes(const index_t& blockNumber,
+                                                                              WriteBatch& batch) const
+{
+    size_t numNodes = 0;
+    for (const auto& level : nodes) {
+        numNodes += level.size();
+    }
+    batch.reserve(numNodes, numNodes * (ESTIMATED_HISTORIC_KEY_SIZE + sizeof(fr)));
+    for (uint32_t i = 1; i < nodes.size(); i++) {
+        for (const auto* entry : get_sorted_nodes(i)) {
+            batch.add_key(get_key_for_historic_node(i, entry->first, blockNumber));
+            batch.write_fixed_width(entry->second);
+        }
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::serialise_indices(
+    std::vector<std::vector<index_t>>& committedIndices, WriteBatch& batch) const
+{
+    // The indices are held in key order
+    batch.reserve(indices_.size(), indices_.size() * (sizeof(FrKeyType) + ESTIMATED_INDICES_SIZE));
+    size_t i = 0;
+    for (const auto& idx : indices_) {
+        FrKeyType key = idx.first;
+        batch.add_key(serialise_key(key));
+        // The persisted indices precede those added since
+        Indices merged{ std::move(committedIndices[i++]) };
+        merged.indices.insert(merged.indices.end(), idx.second.indices.begin(), idx.second.indices.end());
+        msgpack::pack(batch, merged);
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::serialise_block(
+    const index_t& blockNumber,
+    const std::vector<std::vector<uint8_t>>& superseded,
+    const std::vector<std::pair<index_t, LowLeafLink>>& links,
+    WriteBatch& batch) const
+{
+    // Block keys sort before journal keys, which sort before the low leaf links
+    BlockMeta blockMeta{ .size = meta.size, .root = meta.root };
+    batch.add_key(get_key_for_block(blockNumber));
+    msgpack::pack(batch, blockMeta);
+    if (!superseded.empty()) {
+        batch.add_key(get_key_for_block_journal(blockNumber));
+        msgpack::pack(batch, superseded);
+    }
+    for (const auto& link : links) {
+        batch.add_key(get_key_for_low_leaf_link(link.first));
+        msgpack::pack(batch, link.second);
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::collect_superseded_history(
+    const index_t& blockNumber, std::vector<std::vector<uint8_t>>& superseded, ReadTransaction& tx) const
+{
+    // Nothing can be superseded by the genesis state
+    if (blockNumber == 0) {
+        return;
+    }
+    // For every node/leaf being written, find the version that is visible as of the previous block, if there is one.
+    // That version is superseded by the one we are about to write
+    auto collect = [&](const std::vector<uint8_t>& versionKey) {
+        std::vector<uint8_t> key = versionKey;
+        std::span<const uint8_t> data;
+        if (tx.get_value_or_previous(key, data) && historic_keys_match(key, versionKey)) {
+            superseded.push_back(key);
+        }
+    };
+    for (uint32_t i = 1; i < nodes.size(); i++) {
+        for (const auto& entry : nodes[i].entries()) {
+            collect(get_key_for_historic_node(i, entry.first, blockNumber - 1));
+        }
+    }
+    for (const auto& leaf : leaves_) {
+        collect(get_key_for_historic_leaf(leaf.first, blockNumber - 1));
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::collect_prunable_history(
+    const index_t& blockNumber,
+    std::vector<std::vector<uint8_t>>& superseded,
+    PendingCommit& pending,
+    ReadTransaction& tx) const
+{
+    if (blockNumber < historicBlocksToRetain) {
+        return;
+    }
+    index_t oldestRetained = blockNumber + 1 - historicBlocksToRetain;
+    std::vector<std::vector<uint8_t>>& prunable = pending.prunable;
+    // The state as of the block before the oldest retained block is no longer needed
+    prunable.push_back(get_key_for_block(oldestRetained - 1));
+    // Versions superseded at the oldest retained block were only visible to blocks before it
+    if (oldestRetained == blockNumber) {
+        prunable.insert(prunable.end(), superseded.begin(), superseded.end());
+        superseded.clear();
+    } else {
+        std::vector<uint8_t> journalKey = get_key_for_block_journal(oldestRetained);
+        std::span<const uint8_t> data;
+        if (tx.get_value(journalKey, data)) {
+            std::vector<std::vector<uint8_t>> journal;
+            msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(journal);
+            prunable.insert(prunable.end(), journal.begin(), journal.end());
+            prunable.push_back(journalKey);
+        }
+    }
+    pending.meta.oldestHistoricBlock = std::max(pending.meta.oldestHistoricBlock, oldestRetained);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::collect_low_leaf_links(
+    std::vector<std::pair<index_t, LowLeafLink>>& links, ReadTransaction& tx) const
+{
+    // Only indexed trees hold leaves, the index of an append only tree has no low leaves
+    if (leaves_.empty()) {
+        return;
+    }
+    // The committed state is that of the previous block, so the low leaf found for each new key is present in every
+    // earlier block
+    for (const auto& idx : indices_) {
+        FrKeyType key = idx.first;
+        std::span<const uint8_t> data;
+        std::optional<LowLeafLink> lowLeaf;
+        if (tx.get_value_or_previous(key, data)) {
+            Indices committed;
+            msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(committed);
+            index_t lowLeafIndex = *std::min_element(committed.indices.begin(), committed.indices.end());
+            // Skew binary jumps, each leaf jumps to its low leaf or to the jump of its low leaf's jump
+            LowLeafLink parent = read_low_leaf_link(lowLeafIndex, tx);
+            LowLeafLink jump = read_low_leaf_link(parent.jumpIndex, tx);
+            lowLeaf = LowLeafLink{ .lowLeafIndex = lowLeafIndex,
+                                   .jumpIndex = lowLeafIndex,
+                                   .depth = parent.depth + 1,
+                                   .jumpDepth = parent.depth };
+            if (parent.depth - parent.jumpDepth == jump.depth - jump.jumpDepth) {
+                lowLeaf->jumpIndex = jump.jumpIndex;
+                lowLeaf->jumpDepth = jump.jumpDepth;
             }
-            persist_meta(meta, *tx);
-            tx->commit();
-        } catch (std::exception& e) {
-            tx->try_abort();
-            throw;
+        }
+        for (const index_t& index : idx.second.indices) {
+            // Leaves without a committed low leaf are those of the genesis state, they are the roots of the links
+            links.emplace_back(index,
+                               lowLeaf.value_or(LowLeafLink{
+                                   .lowLeafIndex = index, .jumpIndex = index, .depth = 0, .jumpDepth = 0 }));
         }
     }
-    rollback();
+    std::sort(links.begin(), links.end(), [](const auto& a, const auto& b) { return a.first < b.first; });
+}
+
+template <typename PersistedStore, typename LeafValueType>
+LowLeafLink CachedTreeStore<PersistedStore, LeafValueType>::read_low_leaf_link(const index_t& index,
+                                                                               ReadTransaction& tx) const
+{
+    std::vector<uint8_t> key = get_key_for_low_leaf_link(index);
+    std::span<const uint8_t> data;
+    if (!tx.get_value(key, data)) {
+        throw std::runtime_error("Low leaf link not found for leaf " + std::to_string(index) + " of tree " + name);
+    }
+    LowLeafLink link;
+    msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(link);
+    return link;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+void CachedTreeStore<PersistedStore, LeafValueType>::get_block_meta(const index_t& blockNumber,
+                                                                    index_t& size,
+                                                                    bb::fr& root,
+                                                                    ReadTransaction& tx) const
+{
+    if (!is_retaining_history()) {
+        throw std::runtime_error("Historic state is not retained for tree " + name);
+    }
+    TreeMeta m;
+    read_persisted_meta(m, tx);
+    std::vector<uint8_t> key = get_key_for_block(blockNumber);
+    std::span<const uint8_t> data;
+    if (blockNumber > m.blockHeight || blockNumber < m.oldestHistoricBlock || !tx.get_value(key, data)) {
+        throw std::runtime_error("Block " + std::to_string(blockNumber) + " is not available for tree " + name);
+    }
+    BlockMeta blockMeta;
+    msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(blockMeta);
+    size = blockMeta.size;
+    root = blockMeta.root;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+bool CachedTreeStore<PersistedStore, LeafValueType>::get_node_at_block(
+    uint32_t level, index_t index, const index_t& blockNumber, fr& value, ReadTransaction& tx) const
+{
+    std::vector<uint8_t> requested = get_key_for_historic_node(level, index, blockNumber);
+    std::vector<uint8_t> key = requested;
+    std::span<const uint8_t> data;
+    if (!tx.get_value_or_previous(key, data) || !historic_keys_match(key, requested)) {
+        return false;
+    }
+    value = decode_fixed_width<fr>(data);
+    return true;
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::optional<typename CachedTreeStore<PersistedStore, LeafValueType>::IndexedLeafValueType> CachedTreeStore<
+    PersistedStore,
+    LeafValueType>::get_leaf_at_block(const index_t& index, const index_t& blockNumber, ReadTransaction& tx) const
+{
+    index_t size = 0;
+    bb::fr root;
+    get_block_meta(blockNumber, size, root, tx);
+    if (index >= size) {
+        return std::nullopt;
+    }
+    std::vector<uint8_t> requested = get_key_for_historic_leaf(index, blockNumber);
+    std::vector<uint8_t> key = requested;
+    std::span<const uint8_t> data;
+    if (!tx.get_value_or_previous(key, data) || !historic_keys_match(key, requested)) {
+        return std::nullopt;
+    }
+    return decode_fixed_width<IndexedLeafValueType>(data);
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::pair<bool, index_t> CachedTreeStore<PersistedStore, LeafValueType>::find_low_value_at_block(
+    const fr& new_leaf_key, const index_t& blockNumber, ReadTransaction& tx) const
+{
+    index_t size = 0;
+    bb::fr root;
+    get_block_meta(blockNumber, size, root, tx);
+
+    FrKeyType key(new_leaf_key);
+    std::span<const uint8_t> data;
+    if (!tx.get_value_or_previous(key, data)) {
+        throw std::runtime_error("Unable to find low leaf at block " + std::to_string(blockNumber));
+    }
+    Indices committed;
+    msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(committed);
+    index_t index = *std::min_element(committed.indices.begin(), committed.indices.end());
+    // Leaves are only ever appended, so a leaf was present if its index is below the size of the tree at that block
+    if (index < size) {
+        return std::make_pair(key == uint256_t(new_leaf_key), index);
+    }
+    // Otherwise the low leaf as of the block is the first leaf present as of the block in the current low leaf's chain
+    // of low leaf links. The indices along the chain decrease, so any jump that is not present as of the block can be
+    // followed without passing it
+    while (true) {
+        LowLeafLink link = read_low_leaf_link(index, tx);
+        index_t next = link.jumpIndex < index && link.jumpIndex >= size ? link.jumpIndex : link.lowLeafIndex;
+        if (next >= index) {
+            throw std::runtime_error("Unable to find low leaf at block " + std::to_string(blockNumber));
+        }
+        if (next < size) {
+            return std::make_pair(false, next);
+        }
+        index = next;
+    }
+}
+
+template <typename PersistedStore, typename LeafValueType>
+std::optional<index_t> CachedTreeStore<PersistedStore, LeafValueType>::find_leaf_index_from_at_block(
+    const LeafValueType& leaf, index_t start_index, const index_t& blockNumber, ReadTransaction& tx) const
+{
+    index_t size = 0;
+    bb::fr root;
+    get_block_meta(blockNumber, size, root, tx);
+
+    std::optional<index_t> result = std::nullopt;
+    FrKeyType key = leaf;
+    std::span<const uint8_t> value;
+    if (!tx.get_value(key, value)) {
+        return result;
+    }
+    Indices committed;
+    msgpack::unpack(reinterpret_cast<const char*>(value.data()), value.size()).get().convert(committed);
+    for (const index_t& ind : committed.indices) {
+        if (ind < start_index || ind >= size) {
+            continue;
+        }
+        result = result.has_value() ? std::min(ind, result.value()) : ind;
+    }
+    return result;
 }
 
 template <typename PersistedStore, typename LeafValueType>
@@ -445,8 +1221,10 @@ void CachedTreeStore<PersistedStore, LeafValueType>::rollback()
         ReadTransactionPtr tx = create_read_transaction();
         read_persisted_meta(meta, *tx);
     }
-    nodes = std::vector<std::unordered_map<index_t, std::vector<uint8_t>>>(
-        depth + 1, std::unordered_map<index_t, std::vector<uint8_t>>());
+    // Retain the memory allocated by the node caches for the next batch of updates
+    for (auto& level : nodes) {
+        level.clear();
+    }
     indices_ = std::map<uint256_t, Indices>();
     leaves_ = std::unordered_map<index_t, IndexedLeafValueType>();
 }
@@ -454,14 +1232,26 @@ void CachedTreeStore<PersistedStore, LeafValueType>::rollback()
 template <typename PersistedStore, typename LeafValueType>
 bool CachedTreeStore<PersistedStore, LeafValueType>::read_persisted_meta(TreeMeta& m, ReadTransaction& tx) const
 {
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     bool success = tx.get_node(0, 0, data);
     if (success) {
-        msgpack::unpack((const char*)data.data(), data.size()).get().convert(m);
+        msgpack::unpack(reinterpret_cast<const char*>(data.data()), data.size()).get().convert(m);
     }
     return success;
 }
 
+template <typename PersistedStore, typename LeafValueType>
+template <typename T>
+T CachedTreeStore<PersistedStore, LeafValueType>::decode_fixed_width(std::span<const uint8_t> data) const
+{
+    static const size_t encodedSize = to_buffer(T{}).size();
+    if (data.size() != encodedSize) {
+        throw std::runtime_error("Invalid persisted value in tree " + name + ", expected " +
+                                 std::to_string(encodedSize) + " bytes but found " + std::to_string(data.size()));
+    }
+    return from_buffer<T>(data);
+}
+
 template <typename PersistedStore, typename LeafValueType>
 void CachedTreeStore<PersistedStore, LeafValueType>::persist_meta(TreeMeta& m, WriteTransaction& tx)
 {
@@ -476,15 +1266,25 @@ void CachedTreeStore<PersistedStore, LeafValueType>::initialise()
 {
     // Read the persisted meta data, if the name or depth of the tree is not consistent with what was provided during
     // construction then we throw
-    std::vector<uint8_t> data;
+    std::span<const uint8_t> data;
     {
         ReadTransactionPtr tx = create_read_transaction();
         bool success = read_persisted_meta(meta, *tx);
         if (success) {
-            if (name == meta.name && depth == meta.depth) {
-                return;
+            if (meta.formatVersion != TREE_FORMAT_VERSION) {
+                throw std::runtime_error("Tree " + name + " was persisted in format version " +
+                                         std::to_string(meta.formatVersion) + ", expected version " +
+                                         std::to_string(TREE_FORMAT_VERSION) + ". The store must be recreated");
+            }
+            if (name != meta.name || depth != meta.depth) {
+                throw std::runtime_error("Invalid tree meta data");
             }
-            throw std::runtime_error("Invalid tree meta data");
+            // History can only be served if it has been retained since genesis
+            std::vector<uint8_t> key = get_key_for_block(meta.blockHeight);
+            if (is_retaining_history() && meta.size > 0 && !tx->get_value(key, data)) {
+                throw std::runtime_error("Tree " + name + " was created without retaining historic state");
+            }
+            return;
         }
     }
 
@@ -492,6 +1292,9 @@ void CachedTreeStore<PersistedStore, LeafValueType>::initialise()
     meta.name = name;
     meta.size = 0;
     meta.depth = depth;
+    meta.blockHeight = 0;
+    meta.oldestHistoricBlock = 0;
+    meta.formatVersion = TREE_FORMAT_VERSION;
     WriteTransactionPtr tx = create_write_transaction();
     try {
         persist_meta(meta, *tx);
@@ -0,0 +1,154 @@
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+struct NodeCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+};
+
+/**
+ * @brief A bounded, lock free cache of the committed nodes in the upper levels of a tree. These nodes are read by
+ * almost every sibling path query.
+ * Each level is a directly addressed table of slots, allocated on first use. Every entry is tagged with the ID of the
+ * database snapshot it was read from and is only returned to readers of that same snapshot. A commit creates a new
+ * snapshot, so implicitly invalidates the whole cache. Nodes that do not exist in the snapshot are cached as such, as
+ * the upper levels of a sparsely populated tree are mostly empty.
+ * Snapshot IDs are those of the persisted store, so a single cache can be shared by every store reading it, such as the
+ * stores of a tree's forks, whatever snapshot each of them reads.
+ * Slots are updated using a sequence lock. Each slot has a sequence number, which is odd whilst the slot is being
+ * written and only ever increases. Readers never block and concurrent writers of the same slot give way to one another.
+ */
+class HotNodeCache {
+  public:
+    // Levels 1 to 16 occupy 2^17 slots (~6MB) once fully populated
+    static constexpr uint32_t DEFAULT_MAX_LEVEL = 16;
+
+    HotNodeCache(uint32_t depth, uint32_t maxLevel = DEFAULT_MAX_LEVEL)
+        : maxLevel_(std::min(depth, maxLevel))
+        , levels_(maxLevel_ + 1)
+    {}
+    ~HotNodeCache()
+    {
+        for (auto& level : levels_) {
+            delete[] level.load();
+        }
+    }
+    HotNodeCache(HotNodeCache const& other) = delete;
+    HotNodeCache(HotNodeCache&& other) = delete;
+    HotNodeCache& operator=(HotNodeCache const& other) = delete;
+    HotNodeCache& operator=(HotNodeCache&& other) = delete;
+
+    bool is_cached(uint32_t level, const index_t& index) const
+    {
+        return level > 0 && level <= maxLevel_ && index < (index_t(1) << level);
+    }
+
+    /**
+     * @brief Reads a node as of the given snapshot, returns false if it is not cached. The value is set to nullopt if
+     * the node is cached as not existing in the snapshot.
+     */
+    bool get(uint32_t level, const index_t& index, uint64_t snapshot, std::optional<bb::fr>& value) const
+    {
+        const Slot* slots = levels_[level].load(std::memory_order_acquire);
+        if (slots != nullptr) {
+            const Slot& slot = slots[index];
+            const uint64_t sequence = slot.sequence.load(std::memory_order_acquire);
+            if ((sequence & 1) == 0) {
+                const uint64_t tag = slot.tag.load(std::memory_order_relaxed);
+                bb::fr node;
+                for (size_t i = 0; i < 4; ++i) {
+                    node.data[i] = slot.limbs[i].load(std::memory_order_relaxed);
+                }
+                std::atomic_thread_fence(std::memory_order_acquire);
+                // The slot was not written whilst being read, so the tag and the node are consistent
+                if (slot.sequence.load(std::memory_order_relaxed) == sequence && (tag & ~EMPTY) == tag_for(snapshot)) {
+                    value = (tag & EMPTY) != 0 ? std::nullopt : std::optional<bb::fr>(node);
+                    hits_.fetch_add(1, std::memory_order_relaxed);
+                    return true;
+                }
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /**
+     * @brief Writes a node as read from the given snapshot, nullopt if the node does not exist in the snapshot
+     */
+    void put(uint32_t level, const index_t& index, uint64_t snapshot, const std::optional<bb::fr>& value)
+    {
+        Slot& slot = get_slots(level)[index];
+        uint64_t sequence = slot.sequence.load(std::memory_order_relaxed);
+        // Another thread is writing this slot
+        if ((sequence & 1) != 0) {
+            return;
+        }
+        const uint64_t tag = tag_for(snapshot) | (value.has_value() ? 0 : EMPTY);
+        // Already up to date
+        if (slot.tag.load(std::memory_order_relaxed) == tag) {
+            return;
+        }
+        if (!slot.sequence.compare_exchange_strong(sequence, sequence + 1, std::memory_order_relaxed)) {
+            return;
+        }
+        std::atomic_thread_fence(std::memory_order_release);
+        const bb::fr node = value.value_or(bb::fr::zero());
+        slot.tag.store(tag, std::memory_order_relaxed);
+        for (size_t i = 0; i < 4; ++i) {
+            slot.limbs[i].store(node.data[i], std::memory_order_relaxed);
+        }
+        slot.sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    NodeCacheStats get_stats() const
+    {
+        return NodeCacheStats{ .hits = hits_.load(std::memory_order_relaxed),
+                               .misses = misses_.load(std::memory_order_relaxed) };
+    }
+
+  private:
+    struct Slot {
+        // Incremented when a write starts and again when it ends
+        std::atomic<uint64_t> sequence = 0;
+        // The (1 based) snapshot ID of the value shifted left by 1, 0 if never written. The low bit is set if the node
+        // does not exist in the snapshot.
+        std::atomic<uint64_t> tag = 0;
+        std::atomic<uint64_t> limbs[4] = {};
+    };
+
+    uint32_t maxLevel_;
+    std::vector<std::atomic<Slot*>> levels_;
+    mutable std::atomic<uint64_t> hits_ = 0;
+    mutable std::atomic<uint64_t> misses_ = 0;
+
+    static constexpr uint64_t EMPTY = 1;
+
+    static uint64_t tag_for(uint64_t snapshot) { return (snapshot + 1) << 1; }
+
+    Slot* get_slots(uint32_t level)
+    {
+        Slot* slots = levels_[level].load(std::memory_order_acquire);
+        if (slots != nullptr) {
+            return slots;
+        }
+        Slot* allocated = new Slot[size_t(1) << level];
+        if (levels_[level].compare_exchange_strong(slots, allocated, std::memory_order_acq_rel)) {
+            return allocated;
+        }
+        // Another thread allocated the level first
+        delete[] allocated;
+        return slots;
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
@@ -0,0 +1,122 @@
+#include <array>
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include <optional>
+#include <thread>
+#include <vector>
+
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "hot_node_cache.hpp"
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+TEST(HotNodeCacheTest, only_caches_upper_levels)
+{
+    HotNodeCache cache(40, 8);
+    EXPECT_FALSE(cache.is_cached(0, 0));
+    EXPECT_TRUE(cache.is_cached(1, 1));
+    EXPECT_FALSE(cache.is_cached(1, 2));
+    EXPECT_TRUE(cache.is_cached(8, 255));
+    EXPECT_FALSE(cache.is_cached(9, 0));
+
+    HotNodeCache shallow(4);
+    EXPECT_TRUE(shallow.is_cached(4, 15));
+    EXPECT_FALSE(shallow.is_cached(5, 0));
+}
+
+TEST(HotNodeCacheTest, entries_are_only_visible_to_their_snapshot)
+{
+    HotNodeCache cache(32);
+    std::optional<fr> value;
+    EXPECT_FALSE(cache.get(3, 5, 1, value));
+
+    fr first = fr(random_engine.get_random_uint256());
+    cache.put(3, 5, 1, first);
+    EXPECT_TRUE(cache.get(3, 5, 1, value));
+    EXPECT_EQ(value, std::optional<fr>(first));
+    EXPECT_FALSE(cache.get(3, 5, 2, value));
+    EXPECT_FALSE(cache.get(3, 4, 1, value));
+
+    fr second = fr(random_engine.get_random_uint256());
+    cache.put(3, 5, 2, second);
+    EXPECT_TRUE(cache.get(3, 5, 2, value));
+    EXPECT_EQ(value, std::optional<fr>(second));
+    EXPECT_FALSE(cache.get(3, 5, 1, value));
+
+    NodeCacheStats stats = cache.get_stats();
+    EXPECT_EQ(stats.hits, 2);
+    EXPECT_EQ(stats.misses, 4);
+}
+
+TEST(HotNodeCacheTest, can_cache_missing_nodes)
+{
+    HotNodeCache cache(32);
+    std::optional<fr> value = fr(1);
+    cache.put(16, 1000, 7, std::nullopt);
+    EXPECT_TRUE(cache.get(16, 1000, 7, value));
+    EXPECT_FALSE(value.has_value());
+    EXPECT_FALSE(cache.get(16, 1000, 8, value));
+
+    cache.put(16, 1000, 8, fr(5));
+    EXPECT_TRUE(cache.get(16, 1000, 8, value));
+    EXPECT_EQ(value, std::optional<fr>(fr(5)));
+}
+
+TEST(HotNodeCacheTest, can_be_read_and_written_concurrently)
+{
+    constexpr uint32_t level = 10;
+    constexpr uint64_t num_reads = 10000;
+    HotNodeCache cache(32);
+    auto expected = [](index_t index, uint64_t snapshot) { return fr(index * 100 + snapshot); };
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < 8; i++) {
+        threads.emplace_back([&cache, &expected, i]() {
+            for (uint64_t j = 0; j < num_reads; j++) {
+                index_t index = (j * 7919 + i) % (1UL << level);
+                uint64_t snapshot = j % 3;
+                std::optional<fr> value;
+                if (cache.get(level, index, snapshot, value)) {
+                    EXPECT_EQ(value, std::optional<fr>(expected(index, snapshot)));
+                } else {
+                    cache.put(level, index, snapshot, expected(index, snapshot));
+                }
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    NodeCacheStats stats = cache.get_stats();
+    EXPECT_EQ(stats.hits + stats.misses, num_reads * 8);
+}
+
+TEST(HotNodeCacheTest, readers_are_consistent_when_a_slot_alternates_between_snapshots)
+{
+    constexpr uint64_t num_iterations = 100000;
+    HotNodeCache cache(32);
+    // Values differing in every limb, so that a node mixing the two is detected
+    const std::array<fr, 2> values = { fr(random_engine.get_random_uint256()), fr(random_engine.get_random_uint256()) };
+
+    // Readers of an older and a newer snapshot repeatedly overwrite the same slot, as happens around a commit
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < 4; i++) {
+        threads.emplace_back([&cache, &values, i]() {
+            const uint64_t snapshot = i % 2;
+            for (uint64_t j = 0; j < num_iterations; j++) {
+                std::optional<fr> value;
+                if (cache.get(5, 3, snapshot, value)) {
+                    EXPECT_EQ(value, std::optional<fr>(values[snapshot]));
+                }
+                cache.put(5, 3, snapshot, values[snapshot]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+}
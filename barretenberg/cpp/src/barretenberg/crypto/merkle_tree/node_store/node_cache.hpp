@@ -0,0 +1,137 @@
+#pragma once
+#include "barretenberg/crypto/merkle_tree/types.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace bb::crypto::merkle_tree {
+
+/**
+ * @brief Caches the uncommitted nodes of a single level of a tree.
+ * Node values are stored in insertion order in a contiguous arena and located through an open addressing (linear
+ * probing) table of slots. Clearing the cache is constant time, the arena and the slots retain their capacity and slots
+ * are invalidated by advancing the cache's generation. This avoids any per-node heap allocation once the cache has
+ * grown to the size of a typical batch.
+ */
+class NodeLevelCache {
+  public:
+    using Entry = std::pair<index_t, bb::fr>;
+
+    NodeLevelCache() = default;
+    ~NodeLevelCache() = default;
+    NodeLevelCache(NodeLevelCache const& other) = default;
+    NodeLevelCache(NodeLevelCache&& other) noexcept = default;
+    NodeLevelCache& operator=(NodeLevelCache const& other) = default;
+    NodeLevelCache& operator=(NodeLevelCache&& other) noexcept = default;
+
+    /**
+     * @brief Writes the value of the node at the given index, replacing any existing value
+     */
+    void put(const index_t& index, const bb::fr& value)
+    {
+        if ((entries_.size() + 1) * 2 > slots_.size()) {
+            grow();
+        }
+        Slot& slot = find_slot(index);
+        if (slot.generation == generation_) {
+            entries_[slot.entry].second = value;
+            return;
+        }
+        slot.index = index;
+        slot.generation = generation_;
+        slot.entry = static_cast<uint32_t>(entries_.size());
+        entries_.emplace_back(index, value);
+    }
+
+    /**
+     * @brief Reads the value of the node at the given index, returns false if the node is not cached
+     */
+    bool get(const index_t& index, bb::fr& value) const
+    {
+        if (entries_.empty()) {
+            return false;
+        }
+        const Slot& slot = find_slot(index);
+        if (slot.generation != generation_) {
+            return false;
+        }
+        value = entries_[slot.entry].second;
+        return true;
+    }
+
+    /**
+     * @brief Removes all nodes from the cache whilst retaining the allocated memory
+     */
+    void clear()
+    {
+        entries_.clear();
+        if (++generation_ == 0) {
+            // The generation has wrapped, explicitly invalidate every slot
+            for (Slot& slot : slots_) {
+                slot.generation = 0;
+            }
+            generation_ = 1;
+        }
+    }
+
+    size_t size() const { return entries_.size(); }
+
+    bool empty() const { return entries_.empty(); }
+
+    /**
+     * @brief The cached nodes, in the order in which they were first written
+     */
+    const std::vector<Entry>& entries() const { return entries_; }
+
+  private:
+    struct Slot {
+        index_t index = 0;
+        // The slot is only occupied if its generation matches that of the cache
+        uint32_t generation = 0;
+        // The position of the node's value in the arena
+        uint32_t entry = 0;
+    };
+
+    static constexpr size_t MIN_SLOTS = 16;
+
+    std::vector<Slot> slots_;
+    std::vector<Entry> entries_;
+    uint32_t generation_ = 1;
+
+    size_t slot_position(const index_t& index) const
+    {
+        // Fibonacci hashing spreads runs of adjacent indices across the table
+        return static_cast<size_t>((index * 0x9E3779B97F4A7C15ULL) >> 32) & (slots_.size() - 1);
+    }
+
+    // Returns the slot occupied by the given index, or the empty slot at which it should be inserted
+    template <typename Self> static auto& find_slot(Self& self, const index_t& index)
+    {
+        const size_t mask = self.slots_.size() - 1;
+        size_t position = self.slot_position(index);
+        while (self.slots_[position].generation == self.generation_ && self.slots_[position].index != index) {
+            position = (position + 1) & mask;
+        }
+        return self.slots_[position];
+    }
+    Slot& find_slot(const index_t& index) { return find_slot(*this, index); }
+    const Slot& find_slot(const index_t& index) const { return find_slot(*this, index); }
+
+    void grow()
+    {
+        size_t capacity = std::max(MIN_SLOTS, slots_.size() * 2);
+        slots_ = std::vector<Slot>(capacity);
+        generation_ = 1;
+        for (size_t i = 0; i < entries_.size(); ++i) {
+            Slot& slot = find_slot(entries_[i].first);
+            slot.index = entries_[i].first;
+            slot.generation = generation_;
+            slot.entry = static_cast<uint32_t>(i);
+        }
+    }
+};
+
+} // namespace bb::crypto::merkle_tree
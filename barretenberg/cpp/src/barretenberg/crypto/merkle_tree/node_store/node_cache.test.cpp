@@ -0,0 +1,61 @@
+#include <cstdint>
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+
+#include "barretenberg/crypto/merkle_tree/fixtures.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "node_cache.hpp"
+
+using namespace bb;
+using namespace bb::crypto::merkle_tree;
+
+TEST(NodeLevelCacheTest, can_write_and_read_nodes)
+{
+    NodeLevelCache cache;
+    std::unordered_map<index_t, fr> expected;
+    for (size_t i = 0; i < 4096; i++) {
+        index_t index = random_engine.get_random_uint64() % 1024;
+        fr value = fr(random_engine.get_random_uint256());
+        cache.put(index, value);
+        expected[index] = value;
+    }
+
+    EXPECT_EQ(cache.size(), expected.size());
+    for (index_t i = 0; i < 2048; i++) {
+        fr value;
+        bool found = cache.get(i, value);
+        auto it = expected.find(i);
+        EXPECT_EQ(found, it != expected.end());
+        if (found) {
+            EXPECT_EQ(value, it->second);
+        }
+    }
+
+    // entries are presented in the order in which they were first written
+    for (const auto& [index, value] : cache.entries()) {
+        EXPECT_EQ(value, expected[index]);
+    }
+}
+
+TEST(NodeLevelCacheTest, clearing_removes_all_nodes)
+{
+    NodeLevelCache cache;
+    for (index_t i = 0; i < 100; i++) {
+        cache.put(i, fr(i));
+    }
+    cache.clear();
+    EXPECT_TRUE(cache.empty());
+
+    fr value;
+    for (index_t i = 0; i < 100; i++) {
+        EXPECT_FALSE(cache.get(i, value));
+    }
+
+    // the cache can be re-used once cleared
+    cache.put(5, fr(10));
+    EXPECT_TRUE(cache.get(5, value));
+    EXPECT_EQ(value, fr(10));
+    EXPECT_FALSE(cache.get(6, value));
+    EXPECT_EQ(cache.size(), 1);
+}
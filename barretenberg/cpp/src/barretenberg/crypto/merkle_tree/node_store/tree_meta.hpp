@@ -7,13 +7,64 @@
 
 namespace bb::crypto::merkle_tree {
 
+// The version of the format in which trees are persisted. Must be incremented whenever the encoding of any of a tree's
+// persisted data changes, stores persisted in any other format can't be opened and must be recreated.
+// Version 1: leaves are persisted in their fixed width binary encoding
+// Version 2: indexed trees retaining history persist a low leaf link for each leaf
+const uint32_t TREE_FORMAT_VERSION = 2;
+
 struct TreeMeta {
     std::string name;
     uint32_t depth;
     index_t size;
     bb::fr root;
+    // The number of the most recently committed block, the genesis state is block 0
+    index_t blockHeight;
+    // The oldest block for which historic state is still retained
+    index_t oldestHistoricBlock;
+    // Stores persisted before the format was versioned don't have a version, and read as version 0
+    uint32_t formatVersion = 0;
+
+    MSGPACK_FIELDS(name, depth, size, root, blockHeight, oldestHistoricBlock, formatVersion)
+};
+
+/**
+ * @brief The state of a tree as of the end of a given block
+ */
+struct BlockMeta {
+    index_t size;
+    bb::fr root;
+
+    MSGPACK_FIELDS(size, root)
+};
+
+/**
+ * @brief The low leaf of an indexed tree's leaf as of the block before the leaf was inserted, i.e. the leaf with the
+ * greatest key below its own that is present in every earlier block. The links form a tree rooted at the leaves of the
+ * genesis state, in which every leaf's ancestors are found at decreasing indices. Each link also holds a jump to a
+ * further ancestor, chosen such that the first ancestor below any given index is reached in O(log n) steps.
+ */
+struct LowLeafLink {
+    index_t lowLeafIndex;
+    index_t jumpIndex;
+    // The number of links between the leaf and a root of the tree, and between its jump and a root
+    index_t depth;
+    index_t jumpDepth;
+
+    MSGPACK_FIELDS(lowLeafIndex, jumpIndex, depth, jumpDepth)
+};
 
-    MSGPACK_FIELDS(name, depth, size, root)
+/**
+ * @brief Timings of the phases of a commit, in nanoseconds. Serialisation is performed on a thread pool, overlapping
+ * with the other phases, so its time is the total across the threads involved.
+ */
+struct CommitStats {
+    uint64_t readTimeNs = 0;
+    uint64_t serialiseTimeNs = 0;
+    // Includes any time spent waiting for serialisation to complete
+    uint64_t writeTimeNs = 0;
+    uint64_t commitTimeNs = 0;
+    uint64_t numWrites = 0;
 };
 
 struct LeavesMeta {
@@ -10,6 +10,8 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace bb::crypto::merkle_tree {
 struct TreeMetaResponse {
@@ -17,6 +19,9 @@ struct TreeMetaResponse {
     uint32_t depth;
     index_t size;
     fr root;
+    // Hits and misses of the store's committed node cache since the tree was opened
+    uint64_t nodeCacheHits = 0;
+    uint64_t nodeCacheMisses = 0;
 };
 
 struct AddDataResponse {
@@ -28,6 +33,11 @@ struct GetSiblingPathResponse {
     fr_sibling_path path;
 };
 
+struct GetSiblingPathsResponse {
+    // The sibling paths, in the order in which the leaf indices were requested
+    std::vector<fr_sibling_path> paths;
+};
+
 template <typename LeafType> struct LowLeafWitnessData {
     IndexedLeaf<LeafType> leaf;
     index_t index;
@@ -47,6 +57,16 @@ struct FindLeafIndexResponse {
     index_t leaf_index;
 };
 
+struct FindLeafIndicesResponse {
+    // The index of each requested leaf, or nullopt if the leaf was not found
+    std::vector<std::optional<index_t>> leaf_indices;
+};
+
+struct FindLowLeavesResponse {
+    // For each requested key, whether the key is already present and the index of its low leaf
+    std::vector<std::pair<bool, index_t>> low_leaves;
+};
+
 struct GetLeafResponse {
     std::optional<bb::fr> leaf;
 };
@@ -13,6 +13,7 @@ namespace bb::crypto {
  *
  * @details This method uses `Curve::BaseField` members as inputs. This aligns with what we expect when creating
  * grumpkin commitments to field elements inside a BN254 SNARK circuit.
+ * The generators are fixed, so the scalar multiplications use the cached tables of `fixed_base_msm`.
  * @param inputs
  * @param context
  * @return Curve::AffineElement
@@ -22,12 +23,11 @@ typename Curve::AffineElement pedersen_commitment_base<Curve>::commit_native(con
                                                                              const GeneratorContext context)
 {
     const auto generators = context.generators->get(inputs.size(), context.offset, context.domain_separator);
-    Element result = Group::point_at_infinity;
-
+    std::vector<Fr> scalars(inputs.size());
     for (size_t i = 0; i < inputs.size(); ++i) {
-        result += Element(generators[i]) * static_cast<uint256_t>(inputs[i]);
+        scalars[i] = static_cast<uint256_t>(inputs[i]);
     }
-    return result.normalize();
+    return fixed_base_msm<Curve>(scalars, generators).normalize();
 }
 template class pedersen_commitment_base<curve::Grumpkin>;
 } // namespace bb::crypto
@@ -1,6 +1,7 @@
 // TODO(@zac-wiliamson #2341 delete this file once we migrate to new hash standard
 
 #pragma once
+#include "../generators/fixed_base_table.hpp"
 #include "../generators/generator_data.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
@@ -56,7 +56,8 @@ std::vector<typename Curve::BaseField> pedersen_hash_base<Curve>::convert_buffer
 template <typename Curve>
 typename Curve::BaseField pedersen_hash_base<Curve>::hash(const std::vector<Fq>& inputs, const GeneratorContext context)
 {
-    Element result = length_generator * Fr(inputs.size());
+    const Fr length = inputs.size();
+    Element result = fixed_base_msm<Curve>({ &length, 1 }, { &length_generator, 1 });
     return (result + pedersen_commitment_base<Curve>::commit_native(inputs, context)).normalize().x;
 }
 
@@ -390,6 +390,48 @@ void subaddmul_bench(State& state) noexcept
 }
 BENCHMARK(subaddmul_bench);
 
+/**
+ * The benchmarks above measure the latency of dependent operations. The following measure the throughput of a single
+ * core on independent multiplications, as in the elementwise products of the relations and univariates, reported as
+ * items_per_second.
+ */
+constexpr size_t NUM_BATCH_ELEMENTS = 1 << 16;
+
+void mul_throughput_bench(State& state) noexcept
+{
+    std::vector<fr> result(NUM_BATCH_ELEMENTS);
+    for (auto _ : state) {
+        for (size_t i = 0; i < NUM_BATCH_ELEMENTS; ++i) {
+            result[i] = oldx[i] * oldy[i];
+        }
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(mul_throughput_bench);
+
+void mul_batch_bench(State& state) noexcept
+{
+    std::vector<fr> result(NUM_BATCH_ELEMENTS);
+    for (auto _ : state) {
+        fr::mul_batch({ oldx.data(), NUM_BATCH_ELEMENTS }, { oldy.data(), NUM_BATCH_ELEMENTS }, result);
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(mul_batch_bench);
+
+void fma_batch_bench(State& state) noexcept
+{
+    std::vector<fr> result(oldx.begin(), oldx.begin() + NUM_BATCH_ELEMENTS);
+    for (auto _ : state) {
+        fr::fma_batch({ oldx.data(), NUM_BATCH_ELEMENTS }, { oldy.data(), NUM_BATCH_ELEMENTS }, result, result);
+        DoNotOptimize(result.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(NUM_BATCH_ELEMENTS));
+}
+BENCHMARK(fma_batch_bench);
+
 void field_bench(State& state) noexcept
 {
     uint64_t clocks = 0;
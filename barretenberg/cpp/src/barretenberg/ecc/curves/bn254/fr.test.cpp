@@ -364,6 +364,41 @@ TEST(fr, BatchInvert)
     }
 }
 
+// The batch operations agree with the scalar ones, including on the elements left over after the vectorized part
+TEST(fr, MulBatchAndFmaBatch)
+{
+    const std::vector<size_t> sizes = { 0, 1, 7, 8, 9, 64, 67 };
+    for (size_t n : sizes) {
+        std::vector<fr> a(n);
+        std::vector<fr> b(n);
+        std::vector<fr> c(n);
+        for (size_t i = 0; i < n; ++i) {
+            a[i] = fr::random_element();
+            b[i] = fr::random_element();
+            c[i] = fr::random_element();
+        }
+        if (n > 2) {
+            a[0] = fr::zero();
+            a[1] = fr::one();
+            b[2] = -fr::one();
+        }
+
+        std::vector<fr> products(n);
+        std::vector<fr> sums(n);
+        fr::mul_batch(a, b, products);
+        fr::fma_batch(a, b, c, sums);
+        for (size_t i = 0; i < n; ++i) {
+            EXPECT_EQ(products[i], a[i] * b[i]);
+            EXPECT_EQ(sums[i], a[i] * b[i] + c[i]);
+        }
+
+        // The result may alias an input
+        std::vector<fr> in_place = a;
+        fr::fma_batch(in_place, b, c, in_place);
+        EXPECT_EQ(in_place, sums);
+    }
+}
+
 TEST(fr, MultiplicativeGenerator)
 {
     EXPECT_EQ(fr::multiplicative_generator(), fr(5));
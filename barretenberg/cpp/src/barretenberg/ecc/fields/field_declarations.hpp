@@ -325,6 +325,19 @@ template <class Params_> struct alignas(32) field {
     constexpr field invert() const noexcept;
     static void batch_invert(std::span<field> coeffs) noexcept;
     static void batch_invert(field* coeffs, size_t n) noexcept;
+    /**
+     * @brief Compute result[i] = a[i] * b[i] for spans of equal size
+     * @details Uses AVX-512 IFMA when the CPU supports it, see field_impl_batch.hpp. result may alias a or b.
+     */
+    static void mul_batch(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept;
+    /**
+     * @brief Compute result[i] = a[i] * b[i] + c[i] for spans of equal size
+     * @details Uses AVX-512 IFMA when the CPU supports it, see field_impl_batch.hpp. result may alias a, b or c.
+     */
+    static void fma_batch(std::span<const field> a,
+                          std::span<const field> b,
+                          std::span<const field> c,
+                          std::span<field> result) noexcept;
     /**
      * @brief Compute square root of the field element.
      *
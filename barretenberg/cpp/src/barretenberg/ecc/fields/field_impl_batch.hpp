@@ -0,0 +1,255 @@
+#pragma once
+#include "./field_impl.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <span>
+
+// The AVX-512 IFMA kernels are compiled with function target attributes, so that a binary built for generic x86-64
+// still contains them, and they are only called when the CPU supports them.
+#if defined(__x86_64__) && !defined(__wasm__) && !defined(DISABLE_ASM) && (defined(__GNUC__) || defined(__clang__))
+#define BB_FIELD_BATCH_IFMA 1
+#include <immintrin.h>
+#define BB_IFMA_TARGET __attribute__((target("avx512f,avx512ifma")))
+#else
+#define BB_FIELD_BATCH_IFMA 0
+#endif
+
+namespace bb {
+namespace field_batch {
+
+/**
+ * @brief Whether the vectorized batch kernels apply to a field
+ * @details The kernels rely on the same coarse reduction as the scalar field arithmetic, where values lie in [0, 2p),
+ * which is only used for 256-bit moduli below 2^254.
+ */
+template <class T>
+constexpr bool has_vector_kernel =
+    (T::modulus_3 < 0x4000000000000000ULL) && !(T::modulus_1 == 0 && T::modulus_2 == 0 && T::modulus_3 == 0);
+
+#if BB_FIELD_BATCH_IFMA
+
+inline bool cpu_supports_ifma()
+{
+    static const bool supported = __builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512ifma");
+    return supported;
+}
+
+constexpr uint64_t IFMA_LIMB_MASK = (1ULL << 52) - 1;
+
+// Shifts of each lane. The zero-masked forms avoid a spurious -Wmaybe-uninitialized from GCC on the unmasked ones
+BB_IFMA_TARGET inline __m512i ifma_shl(__m512i x, unsigned shift)
+{
+    return _mm512_maskz_slli_epi64(0xFF, x, shift);
+}
+
+BB_IFMA_TARGET inline __m512i ifma_shr(__m512i x, unsigned shift)
+{
+    return _mm512_maskz_srli_epi64(0xFF, x, shift);
+}
+
+// Load 8 consecutive field elements, transposed so that x[k] holds limb k of each element
+BB_IFMA_TARGET inline void ifma_load_transposed(const uint64_t* data, __m512i* x)
+{
+    // Each vector holds 2 elements; first gather limbs {0, 1} and {2, 3} of 4 elements, then of all 8
+    const __m512i even_limbs = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i odd_limbs = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const __m512i v0 = _mm512_loadu_si512(data);
+    const __m512i v1 = _mm512_loadu_si512(data + 8);
+    const __m512i v2 = _mm512_loadu_si512(data + 16);
+    const __m512i v3 = _mm512_loadu_si512(data + 24);
+    const __m512i u0 = _mm512_permutex2var_epi64(v0, even_limbs, v1);
+    const __m512i u1 = _mm512_permutex2var_epi64(v0, odd_limbs, v1);
+    const __m512i w0 = _mm512_permutex2var_epi64(v2, even_limbs, v3);
+    const __m512i w1 = _mm512_permutex2var_epi64(v2, odd_limbs, v3);
+    x[0] = _mm512_permutex2var_epi64(u0, low_halves, w0);
+    x[1] = _mm512_permutex2var_epi64(u0, high_halves, w0);
+    x[2] = _mm512_permutex2var_epi64(u1, low_halves, w1);
+    x[3] = _mm512_permutex2var_epi64(u1, high_halves, w1);
+}
+
+// The inverse of ifma_load_transposed
+BB_IFMA_TARGET inline void ifma_store_transposed(uint64_t* data, const __m512i* x)
+{
+    const __m512i even_limbs = _mm512_setr_epi64(0, 4, 8, 12, 1, 5, 9, 13);
+    const __m512i odd_limbs = _mm512_setr_epi64(2, 6, 10, 14, 3, 7, 11, 15);
+    const __m512i low_halves = _mm512_setr_epi64(0, 1, 2, 3, 8, 9, 10, 11);
+    const __m512i high_halves = _mm512_setr_epi64(4, 5, 6, 7, 12, 13, 14, 15);
+    const __m512i u0 = _mm512_permutex2var_epi64(x[0], low_halves, x[1]);
+    const __m512i w0 = _mm512_permutex2var_epi64(x[0], high_halves, x[1]);
+    const __m512i u1 = _mm512_permutex2var_epi64(x[2], low_halves, x[3]);
+    const __m512i w1 = _mm512_permutex2var_epi64(x[2], high_halves, x[3]);
+    _mm512_storeu_si512(data, _mm512_permutex2var_epi64(u0, even_limbs, u1));
+    _mm512_storeu_si512(data + 8, _mm512_permutex2var_epi64(u0, odd_limbs, u1));
+    _mm512_storeu_si512(data + 16, _mm512_permutex2var_epi64(w0, even_limbs, w1));
+    _mm512_storeu_si512(data + 24, _mm512_permutex2var_epi64(w0, odd_limbs, w1));
+}
+
+// Load 8 field elements as 5 52-bit limbs each, after shifting their values left by `shift` < 12 bits
+BB_IFMA_TARGET inline void ifma_load(const uint64_t* data, __m512i* out, unsigned shift)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(IFMA_LIMB_MASK));
+    __m512i x[4];
+    ifma_load_transposed(data, x);
+    out[0] = _mm512_and_si512(ifma_shl(x[0], shift), mask);
+    out[1] = _mm512_and_si512(_mm512_or_si512(ifma_shr(x[0], 52 - shift), ifma_shl(x[1], 12 + shift)),
+                              mask);
+    out[2] = _mm512_and_si512(_mm512_or_si512(ifma_shr(x[1], 40 - shift), ifma_shl(x[2], 24 + shift)),
+                              mask);
+    out[3] = _mm512_and_si512(_mm512_or_si512(ifma_shr(x[2], 28 - shift), ifma_shl(x[3], 36 + shift)),
+                              mask);
+    out[4] = ifma_shr(x[3], 16 - shift);
+}
+
+// Store 8 field elements from 5 carry-free 52-bit limbs each
+BB_IFMA_TARGET inline void ifma_store(uint64_t* data, const __m512i* t)
+{
+    const __m512i x[4] = {
+        _mm512_or_si512(t[0], ifma_shl(t[1], 52)),
+        _mm512_or_si512(ifma_shr(t[1], 12), ifma_shl(t[2], 40)),
+        _mm512_or_si512(ifma_shr(t[2], 24), ifma_shl(t[3], 28)),
+        _mm512_or_si512(ifma_shr(t[3], 36), ifma_shl(t[4], 16)),
+    };
+    ifma_store_transposed(data, x);
+}
+
+BB_IFMA_TARGET inline void ifma_propagate_carries(__m512i* t)
+{
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(IFMA_LIMB_MASK));
+    for (size_t j = 0; j < 4; ++j) {
+        t[j + 1] = _mm512_add_epi64(t[j + 1], ifma_shr(t[j], 52));
+        t[j] = _mm512_and_si512(t[j], mask);
+    }
+}
+
+/**
+ * @brief Multiply (and add) 8 field elements at a time with AVX-512 IFMA
+ *
+ * @details Each lane of a vector holds one field element, as 5 limbs of 52 bits. The products are reduced with a
+ * 5-round Montgomery reduction by 2^260, where the field uses R = 2^256; multiplying the left operand by 2^4 as an
+ * integer beforehand makes up the difference. As a, b < 2p and p < 2^254, 16 * a fits in 260 bits and the result lies
+ * in [0, 2p), the same range as the scalar multiplication.
+ *
+ * If c is not null, the kernel computes a[i] * b[i] + c[i], reduced to [0, 2p).
+ *
+ * @return The number of elements processed, which is n rounded down to a multiple of 8. The caller handles the rest.
+ */
+template <class T>
+BB_IFMA_TARGET size_t ifma_mul_batch(const field<T>* a, const field<T>* b, const field<T>* c, field<T>* r, size_t n)
+{
+    constexpr uint256_t modulus = field<T>::modulus;
+    constexpr uint256_t twice_modulus = modulus + modulus;
+    const auto to_limb = [](const uint256_t& x, size_t i) {
+        return static_cast<uint64_t>((x >> (52 * i)).data[0]) & IFMA_LIMB_MASK;
+    };
+
+    const __m512i zero = _mm512_setzero_si512();
+    const __m512i mask = _mm512_set1_epi64(static_cast<int64_t>(IFMA_LIMB_MASK));
+    const __m512i r_inv = _mm512_set1_epi64(static_cast<int64_t>(T::r_inv & IFMA_LIMB_MASK));
+    __m512i p[5];
+    __m512i twice_p[5];
+    for (size_t i = 0; i < 5; ++i) {
+        p[i] = _mm512_set1_epi64(static_cast<int64_t>(to_limb(modulus, i)));
+        twice_p[i] = _mm512_set1_epi64(static_cast<int64_t>(to_limb(twice_modulus, i)));
+    }
+
+    const size_t num_vectorized = n & ~static_cast<size_t>(7);
+    for (size_t i = 0; i < num_vectorized; i += 8) {
+        __m512i left[5];
+        __m512i right[5];
+        ifma_load(a[i].data, left, 4);
+        ifma_load(b[i].data, right, 0);
+
+        __m512i t[6] = { zero, zero, zero, zero, zero, zero };
+        for (size_t j = 0; j < 5; ++j) {
+            for (size_t k = 0; k < 5; ++k) {
+                t[k] = _mm512_madd52lo_epu64(t[k], left[j], right[k]);
+                t[k + 1] = _mm512_madd52hi_epu64(t[k + 1], left[j], right[k]);
+            }
+            const __m512i m = _mm512_madd52lo_epu64(zero, t[0], r_inv);
+            for (size_t k = 0; k < 5; ++k) {
+                t[k] = _mm512_madd52lo_epu64(t[k], m, p[k]);
+                t[k + 1] = _mm512_madd52hi_epu64(t[k + 1], m, p[k]);
+            }
+            // The low 52 bits of t[0] are now zero: divide by 2^52
+            t[0] = _mm512_add_epi64(t[1], ifma_shr(t[0], 52));
+            for (size_t k = 1; k < 5; ++k) {
+                t[k] = t[k + 1];
+            }
+            t[5] = zero;
+        }
+        ifma_propagate_carries(t);
+
+        if (c != nullptr) {
+            __m512i addend[5];
+            ifma_load(c[i].data, addend, 0);
+            for (size_t k = 0; k < 5; ++k) {
+                t[k] = _mm512_add_epi64(t[k], addend[k]);
+            }
+            ifma_propagate_carries(t);
+            // The sum lies in [0, 4p): subtract 2p unless that borrows
+            __m512i reduced[5];
+            __m512i borrow = zero;
+            for (size_t k = 0; k < 5; ++k) {
+                const __m512i difference = _mm512_sub_epi64(_mm512_sub_epi64(t[k], twice_p[k]), borrow);
+                borrow = ifma_shr(difference, 63);
+                reduced[k] = _mm512_and_si512(difference, mask);
+            }
+            const __mmask8 no_borrow = _mm512_cmpeq_epi64_mask(borrow, zero);
+            for (size_t k = 0; k < 5; ++k) {
+                t[k] = _mm512_mask_blend_epi64(no_borrow, t[k], reduced[k]);
+            }
+        }
+
+        ifma_store(r[i].data, t);
+    }
+    return num_vectorized;
+}
+
+#endif // BB_FIELD_BATCH_IFMA
+
+} // namespace field_batch
+
+template <class T>
+void field<T>::mul_batch(std::span<const field> a, std::span<const field> b, std::span<field> result) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::mul_batch");
+    ASSERT(a.size() == b.size() && a.size() == result.size());
+    const size_t n = result.size();
+    size_t i = 0;
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (field_batch::has_vector_kernel<T>) {
+        if (field_batch::cpu_supports_ifma()) {
+            i = field_batch::ifma_mul_batch<T>(a.data(), b.data(), nullptr, result.data(), n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        result[i] = a[i] * b[i];
+    }
+}
+
+template <class T>
+void field<T>::fma_batch(std::span<const field> a,
+                         std::span<const field> b,
+                         std::span<const field> c,
+                         std::span<field> result) noexcept
+{
+    BB_OP_COUNT_TRACK_NAME("fr::fma_batch");
+    ASSERT(a.size() == b.size() && a.size() == c.size() && a.size() == result.size());
+    const size_t n = result.size();
+    size_t i = 0;
+#if BB_FIELD_BATCH_IFMA
+    if constexpr (field_batch::has_vector_kernel<T>) {
+        if (field_batch::cpu_supports_ifma()) {
+            i = field_batch::ifma_mul_batch<T>(a.data(), b.data(), c.data(), result.data(), n);
+        }
+    }
+#endif
+    for (; i < n; ++i) {
+        result[i] = a[i] * b[i] + c[i];
+    }
+}
+
+} // namespace bb
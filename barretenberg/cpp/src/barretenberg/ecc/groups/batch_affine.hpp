@@ -0,0 +1,198 @@
+#pragma once
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/compiler_hints.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include <algorithm>
+#include <cstddef>
+#include <span>
+#include <vector>
+
+namespace bb::group_elements {
+
+/**
+ * @brief Batched affine point arithmetic using Montgomery's batch inversion trick
+ *
+ * @details An affine addition or doubling needs the inverse of a denominator (x2 - x1, or 2y), and a Jacobian to affine
+ * conversion needs the inverse of z. Given n independent operations, the inverses can be computed with a single
+ * inversion: we accumulate the products d_1, d_1 * d_2, ..., invert the full product, and then peel off individual
+ * inverses while walking back down. This costs 3 multiplications per inverse, so an affine addition costs 6
+ * multiplications in total, against 11 for a mixed Jacobian addition.
+ *
+ * batch_invert_apply implements the trick once; the add, dbl and normalize operations are expressed in terms of it.
+ * The static *_chunk methods are single-threaded and use caller-provided scratch space, for callers that already
+ * divide the work between threads. The member methods split the work over threads and into batches of BATCH_SIZE
+ * operations, using scratch space owned by the object, which is reused between calls.
+ *
+ * @warning The operations must be independent, and no denominator may be zero: adding a point to itself or to its
+ * negation aborts. Callers that can hit these cases must filter them out beforehand.
+ *
+ * @tparam AffineElement
+ */
+template <typename AffineElement> class BatchAffine {
+  public:
+    using Fq = typename AffineElement::Fq;
+
+    // The operations sharing one inversion. An inversion costs ~300 multiplications, so larger batches barely reduce
+    // the cost per operation, while smaller ones keep the batch's points and scratch space in the L2 cache.
+    static constexpr size_t BATCH_SIZE = 2048;
+
+    BatchAffine(const size_t max_num_points = 0)
+        : scratch_space(max_num_points)
+    {}
+
+    /**
+     * @brief Compute the inverses of n nonzero denominators with a single inversion, and pass each one on
+     *
+     * @param num_operations
+     * @param scratch Space for num_operations field elements
+     * @param denominator denominator(i) returns the i-th denominator. It is called twice for each i, so it should be
+     * cheap, and must return the same value both times
+     * @param consume consume(i, inverse) is called with the inverse of denominator(i), in decreasing order of i. It
+     * may overwrite scratch[i], so the inverses can be written back to the scratch space
+     */
+    template <typename Denominator, typename Consume>
+    BB_INLINE static void batch_invert_apply(const size_t num_operations,
+                                             Fq* scratch,
+                                             const Denominator& denominator,
+                                             const Consume& consume)
+    {
+        if (num_operations == 0) {
+            return;
+        }
+        Fq accumulator = Fq::one();
+        for (size_t i = 0; i < num_operations; ++i) {
+            scratch[i] = accumulator;
+            accumulator *= denominator(i);
+        }
+        if (accumulator.is_zero()) {
+            // prefer abort to throw for code that might emit from multiple threads
+            abort_with_message("attempted to invert zero in a batch affine operation");
+        }
+        accumulator = accumulator.invert();
+        for (size_t i = num_operations - 1; i < num_operations; --i) {
+            const Fq inverse = accumulator * scratch[i];
+            accumulator *= denominator(i);
+            consume(i, inverse);
+        }
+    }
+
+    /**
+     * @brief Compute rhs[i] = lhs[i] + rhs[i] for points with distinct x coordinates
+     *
+     * @param scratch Space for rhs.size() field elements
+     */
+    static void add_chunk(std::span<const AffineElement> lhs, std::span<AffineElement> rhs, Fq* scratch)
+    {
+        batch_invert_apply(
+            rhs.size(),
+            scratch,
+            [&](size_t i) { return rhs[i].x - lhs[i].x; },
+            [&](size_t i, const Fq& inverse) {
+                const Fq lambda = (rhs[i].y - lhs[i].y) * inverse;
+                const Fq x3 = lambda.sqr() - rhs[i].x - lhs[i].x;
+                rhs[i].y = lambda * (lhs[i].x - x3) - lhs[i].y;
+                rhs[i].x = x3;
+            });
+    }
+
+    /**
+     * @brief Compute points[i] = 2 * points[i] for points with nonzero y coordinates
+     *
+     * @param scratch Space for points.size() field elements
+     */
+    static void dbl_chunk(std::span<AffineElement> points, Fq* scratch)
+    {
+        batch_invert_apply(
+            points.size(),
+            scratch,
+            [&](size_t i) { return points[i].y + points[i].y; },
+            [&](size_t i, const Fq& inverse) {
+                const Fq x_squared = points[i].x.sqr();
+                const Fq lambda = (x_squared + x_squared + x_squared) * inverse;
+                const Fq x3 = lambda.sqr() - (points[i].x + points[i].x);
+                points[i].y = lambda * (points[i].x - x3) - points[i].y;
+                points[i].x = x3;
+            });
+    }
+
+    /**
+     * @brief Convert Jacobian elements to affine coordinates in place (z = 1), skipping points at infinity
+     *
+     * @param scratch Space for elements.size() field elements
+     */
+    template <typename Element> static void normalize_chunk(std::span<Element> elements, Fq* scratch)
+    {
+        batch_invert_apply(
+            elements.size(),
+            scratch,
+            [&](size_t i) { return elements[i].is_point_at_infinity() ? Fq::one() : elements[i].z; },
+            [&](size_t i, const Fq& z_inv) {
+                if (!elements[i].is_point_at_infinity()) {
+                    // x = X / Z^2, y = Y / Z^3
+                    const Fq zz_inv = z_inv.sqr();
+                    elements[i].x *= zz_inv;
+                    elements[i].y *= (zz_inv * z_inv);
+                }
+                elements[i].z = Fq::one();
+            });
+    }
+
+    // Multithreaded forms of the above
+    void add(std::span<const AffineElement> lhs, std::span<AffineElement> rhs)
+    {
+        ASSERT(lhs.size() == rhs.size());
+        for_each_batch(
+            rhs.size(),
+            [&](size_t start, size_t end, Fq* scratch) {
+                add_chunk(lhs.subspan(start, end - start), rhs.subspan(start, end - start), scratch);
+            },
+            thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
+    }
+
+    void dbl(std::span<AffineElement> points)
+    {
+        for_each_batch(
+            points.size(),
+            [&](size_t start, size_t end, Fq* scratch) { dbl_chunk(points.subspan(start, end - start), scratch); },
+            thread_heuristics::FF_ADDITION_COST * 7 + thread_heuristics::FF_MULTIPLICATION_COST * 7);
+    }
+
+    template <typename Element> void normalize(std::span<Element> elements)
+    {
+        for_each_batch(
+            elements.size(),
+            [&](size_t start, size_t end, Fq* scratch) {
+                normalize_chunk(elements.subspan(start, end - start), scratch);
+            },
+            thread_heuristics::FF_MULTIPLICATION_COST * 6);
+    }
+
+  private:
+    std::vector<Fq> scratch_space;
+
+    /**
+     * @brief Split [0, num_operations) over the threads, and each thread's range into batches of at most BATCH_SIZE
+     *
+     * @param func func(start, end, scratch) processes the batch [start, end) using scratch
+     * @param heuristic_cost The cost of one operation, see thread_heuristics
+     */
+    template <typename Func>
+    void for_each_batch(const size_t num_operations, const Func& func, const size_t heuristic_cost)
+    {
+        if (scratch_space.size() < num_operations) {
+            scratch_space.resize(num_operations);
+        }
+        parallel_for_heuristic(
+            num_operations,
+            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+                for (size_t batch_start = start; batch_start < end; batch_start += BATCH_SIZE) {
+                    const size_t batch_end = std::min(end, batch_start + BATCH_SIZE);
+                    func(batch_start, batch_end, &scratch_space[batch_start]);
+                }
+            },
+            heuristic_cost + thread_heuristics::FF_INVERSION_COST / BATCH_SIZE);
+    }
+};
+
+} // namespace bb::group_elements
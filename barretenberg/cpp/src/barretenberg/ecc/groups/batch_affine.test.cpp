@@ -0,0 +1,85 @@
+#include "batch_affine.hpp"
+#include "barretenberg/ecc/curves/bn254/g1.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/numeric/random/engine.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+namespace {
+auto& engine = numeric::get_debug_randomness();
+
+template <typename Group> std::vector<typename Group::affine_element> random_points(const size_t num_points)
+{
+    std::vector<typename Group::affine_element> points(num_points);
+    for (auto& point : points) {
+        point = Group::affine_element::random_element(&engine);
+    }
+    return points;
+}
+} // namespace
+
+template <typename Group> class BatchAffineTest : public ::testing::Test {};
+
+using Groups = ::testing::Types<g1, grumpkin::g1>;
+TYPED_TEST_SUITE(BatchAffineTest, Groups);
+
+// Sizes that span several batches and threads, with a partial last batch
+TYPED_TEST(BatchAffineTest, Add)
+{
+    using AffineElement = typename TypeParam::affine_element;
+    using Element = typename TypeParam::element;
+    const size_t num_points = 3 * group_elements::BatchAffine<AffineElement>::BATCH_SIZE + 17;
+
+    const auto lhs = random_points<TypeParam>(num_points);
+    auto rhs = random_points<TypeParam>(num_points);
+    std::vector<AffineElement> expected(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        expected[i] = AffineElement(Element(lhs[i]) + Element(rhs[i]));
+    }
+
+    group_elements::BatchAffine<AffineElement> batch_affine;
+    batch_affine.add(lhs, rhs);
+    EXPECT_EQ(rhs, expected);
+}
+
+TYPED_TEST(BatchAffineTest, Dbl)
+{
+    using AffineElement = typename TypeParam::affine_element;
+    using Element = typename TypeParam::element;
+    const size_t num_points = 3 * group_elements::BatchAffine<AffineElement>::BATCH_SIZE + 17;
+
+    auto points = random_points<TypeParam>(num_points);
+    std::vector<AffineElement> expected(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        expected[i] = AffineElement(Element(points[i]).dbl());
+    }
+
+    group_elements::BatchAffine<AffineElement> batch_affine(num_points);
+    batch_affine.dbl(points);
+    EXPECT_EQ(points, expected);
+}
+
+TYPED_TEST(BatchAffineTest, NormalizeWithPointsAtInfinity)
+{
+    using AffineElement = typename TypeParam::affine_element;
+    using Element = typename TypeParam::element;
+    const size_t num_points = 3 * group_elements::BatchAffine<AffineElement>::BATCH_SIZE + 17;
+
+    std::vector<Element> elements(num_points);
+    std::vector<AffineElement> expected(num_points);
+    for (size_t i = 0; i < num_points; ++i) {
+        elements[i] = Element::random_element(&engine);
+        if (i % 5 == 0) {
+            elements[i].self_set_infinity();
+        }
+        expected[i] = AffineElement(elements[i]);
+    }
+
+    group_elements::BatchAffine<AffineElement> batch_affine;
+    batch_affine.normalize(std::span{ elements });
+    for (size_t i = 0; i < num_points; ++i) {
+        EXPECT_EQ(elements[i].z, TypeParam::Fq::one());
+        EXPECT_EQ(AffineElement(elements[i]), expected[i]);
+    }
+}
@@ -1,6 +1,7 @@
 #pragma once
 #include "barretenberg/common/op_count.hpp"
 #include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/ecc/groups/element.hpp"
 #include "element.hpp"
 #include <cstdint>
@@ -721,61 +722,14 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
                                           const std::span<affine_element<Fq, Fr, T>>& second_group,
                                           const std::span<affine_element<Fq, Fr, T>>& results) noexcept
 {
-    typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = first_group.size();
     ASSERT(second_group.size() == first_group.size());
 
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
     parallel_for_heuristic(
         num_points, [&](size_t i) { results[i] = first_group[i]; }, thread_heuristics::FF_COPY_COST * 2);
 
-    // TODO(#826): Same code as in batch mul
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal = [&](const affine_element* lhs, affine_element* rhs) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-            },
-            thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
-    };
-    batch_affine_add_internal(&second_group[0], &results[0]);
+    BatchAffine<affine_element<Fq, Fr, T>> batch_affine(num_points);
+    batch_affine.add(second_group, results.subspan(0, num_points));
 }
 
 /**
@@ -791,103 +745,34 @@ void element<Fq, Fr, T>::batch_affine_add(const std::span<affine_element<Fq, Fr,
 template <class Fq, class Fr, class T>
 std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomorphism(
     const std::span<const affine_element<Fq, Fr, T>>& points, const Fr& scalar) noexcept
+{
+    std::vector<affine_element<Fq, Fr, T>> results(points.size());
+    batch_mul_with_endomorphism(points, scalar, results);
+    return results;
+}
+
+/**
+ * @brief Multiply each point by the same scalar, writing the results to a caller-provided span
+ *
+ * @details As above. Each points[i] is read before results[i] is written, so results may alias points to multiply in
+ * place.
+ */
+template <class Fq, class Fr, class T>
+void element<Fq, Fr, T>::batch_mul_with_endomorphism(const std::span<const affine_element<Fq, Fr, T>>& points,
+                                                     const Fr& scalar,
+                                                     const std::span<affine_element<Fq, Fr, T>>& results) noexcept
 {
     BB_OP_COUNT_TIME();
     typedef affine_element<Fq, Fr, T> affine_element;
     const size_t num_points = points.size();
+    ASSERT(results.size() == num_points);
 
-    // Space for temporary values
-    std::vector<Fq> scratch_space(num_points);
-
-    // TODO(#826): Same code as in batch add
-    //  we can mutate rhs but NOT lhs!
-    //  output is stored in rhs
-    /**
-     * @brief Perform point addition rhs[i]=rhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_add_chunked =
-        [](const affine_element* lhs, affine_element* rhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-                personal_scratch_space[i] = lhs[i].x + rhs[i].x; // x2 + x1
-                rhs[i].x -= lhs[i].x;                            // x2 - x1
-                rhs[i].y -= lhs[i].y;                            // y2 - y1
-                rhs[i].y *= batch_inversion_accumulator;         // (y2 - y1)*accumulator_old
-                batch_inversion_accumulator *= (rhs[i].x);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-                rhs[i].y *= batch_inversion_accumulator; // update accumulator
-                batch_inversion_accumulator *= rhs[i].x;
-                rhs[i].x = rhs[i].y.sqr();
-                rhs[i].x = rhs[i].x - (personal_scratch_space[i]); // x3 = lambda_squared - x2
-                                                                   // - x1
-                personal_scratch_space[i] = lhs[i].x - rhs[i].x;
-                personal_scratch_space[i] *= rhs[i].y;
-                rhs[i].y = personal_scratch_space[i] - lhs[i].y;
-            }
-        };
-
-    /**
-     * @brief Perform batch affine addition in parallel
-     *
-     */
-    const auto batch_affine_add_internal =
-        [num_points, &scratch_space, &batch_affine_add_chunked](const affine_element* lhs, affine_element* rhs) {
-            parallel_for_heuristic(
-                num_points,
-                [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                    batch_affine_add_chunked(lhs + start, rhs + start, end - start, &scratch_space[0] + start);
-                },
-                thread_heuristics::FF_ADDITION_COST * 6 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
-        };
-
-    /**
-     * @brief Perform point doubling lhs[i]=lhs[i]+lhs[i] with batch inversion
-     *
-     */
-    const auto batch_affine_double_chunked =
-        [](affine_element* lhs, const size_t point_count, Fq* personal_scratch_space) {
-            Fq batch_inversion_accumulator = Fq::one();
-
-            for (size_t i = 0; i < point_count; i += 1) {
-
-                personal_scratch_space[i] = lhs[i].x.sqr();
-                personal_scratch_space[i] =
-                    personal_scratch_space[i] + personal_scratch_space[i] + personal_scratch_space[i];
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-            }
-            batch_inversion_accumulator = batch_inversion_accumulator.invert();
-
-            Fq temp;
-            for (size_t i = (point_count)-1; i < point_count; i -= 1) {
-
-                personal_scratch_space[i] *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (lhs[i].y + lhs[i].y);
-
-                temp = lhs[i].x;
-                lhs[i].x = personal_scratch_space[i].sqr() - (lhs[i].x + lhs[i].x);
-                lhs[i].y = personal_scratch_space[i] * (temp - lhs[i].x) - lhs[i].y;
-            }
-        };
-    /**
-     * @brief Perform point doubling in parallel
-     *
-     */
-    const auto batch_affine_double = [num_points, &scratch_space, &batch_affine_double_chunked](affine_element* lhs) {
-        parallel_for_heuristic(
-            num_points,
-            [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
-                batch_affine_double_chunked(lhs + start, end - start, &scratch_space[0] + start);
-            },
-            thread_heuristics::FF_ADDITION_COST * 7 + thread_heuristics::FF_MULTIPLICATION_COST * 6);
+    // Batched affine additions and doublings, sharing one set of scratch space
+    BatchAffine<affine_element> batch_affine(num_points);
+    const auto batch_affine_add_internal = [&](const affine_element* lhs, affine_element* rhs) {
+        batch_affine.add({ lhs, num_points }, { rhs, num_points });
     };
+    const auto batch_affine_double = [&](affine_element* lhs) { batch_affine.dbl({ lhs, num_points }); };
 
     // We compute the resulting point through WNAF by evaluating (the (\sum_i (16ⁱ⋅
     // (a_i ∈ {-15,-13,-11,-9,-7,-5,-3,-1,1,3,5,7,9,11,13,15}))) - skew), where skew is 0 or 1. The result of the sum is
@@ -896,10 +781,9 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     // computing p⋅Point, we get a point at infinity, which is an edgecase, and we don't want to handle edgecases in the
     // hot loop since the slow the computation down. So it's better to just handle it here.
     if (scalar == -Fr::one()) {
-        std::vector<affine_element> results(num_points);
         parallel_for_heuristic(
             num_points, [&](size_t i) { results[i] = -points[i]; }, thread_heuristics::FF_COPY_COST);
-        return results;
+        return;
     }
     // Compute wnaf for scalar
     const Fr converted_scalar = scalar.from_montgomery_form();
@@ -908,10 +792,9 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     if (converted_scalar.is_zero()) {
         affine_element result{ Fq::zero(), Fq::zero() };
         result.self_set_infinity();
-        std::vector<affine_element> results(num_points);
         parallel_for_heuristic(
             num_points, [&](size_t i) { results[i] = result; }, thread_heuristics::FF_COPY_COST);
-        return results;
+        return;
     }
 
     constexpr size_t LOOKUP_SIZE = 8;
@@ -1025,11 +908,9 @@ std::vector<affine_element<Fq, Fr, T>> element<Fq, Fr, T>::batch_mul_with_endomo
     parallel_for_heuristic(
         num_points,
         [&](size_t i) {
-            work_elements[i] = points[i].is_point_at_infinity() ? work_elements[i].set_infinity() : work_elements[i];
+            results[i] = points[i].is_point_at_infinity() ? work_elements[i].set_infinity() : work_elements[i];
         },
         thread_heuristics::FF_COPY_COST);
-
-    return work_elements;
 }
 
 template <typename Fq, typename Fr, typename T>
@@ -1043,54 +924,9 @@ void element<Fq, Fr, T>::conditional_negate_affine(const affine_element<Fq, Fr,
 template <typename Fq, typename Fr, typename T>
 void element<Fq, Fr, T>::batch_normalize(element* elements, const size_t num_elements) noexcept
 {
-    std::vector<Fq> temporaries;
-    temporaries.reserve(num_elements * 2);
-    Fq accumulator = Fq::one();
-
-    // Iterate over the points, computing the product of their z-coordinates.
-    // At each iteration, store the currently-accumulated z-coordinate in `temporaries`
-    for (size_t i = 0; i < num_elements; ++i) {
-        temporaries.emplace_back(accumulator);
-        if (!elements[i].is_point_at_infinity()) {
-            accumulator *= elements[i].z;
-        }
-    }
-    // For the rest of this method we refer to the product of all z-coordinates as the 'global' z-coordinate
-    // Invert the global z-coordinate and store in `accumulator`
-    accumulator = accumulator.invert();
-
-    /**
-     * We now proceed to iterate back down the array of points.
-     * At each iteration we update the accumulator to contain the z-coordinate of the currently worked-upon
-     *z-coordinate. We can then multiply this accumulator with `temporaries`, to get a scalar that is equal to the
-     *inverse of the z-coordinate of the point at the next iteration cycle e.g. Imagine we have 4 points, such that:
-     *
-     * accumulator = 1 / z.data[0]*z.data[1]*z.data[2]*z.data[3]
-     * temporaries[3] = z.data[0]*z.data[1]*z.data[2]
-     * temporaries[2] = z.data[0]*z.data[1]
-     * temporaries[1] = z.data[0]
-     * temporaries[0] = 1
-     *
-     * At the first iteration, accumulator * temporaries[3] = z.data[0]*z.data[1]*z.data[2] /
-     *z.data[0]*z.data[1]*z.data[2]*z.data[3]  = (1 / z.data[3]) We then update accumulator, such that:
-     *
-     * accumulator = accumulator * z.data[3] = 1 / z.data[0]*z.data[1]*z.data[2]
-     *
-     * At the second iteration, accumulator * temporaries[2] = z.data[0]*z.data[1] / z.data[0]*z.data[1]*z.data[2] =
-     *(1 z.data[2]) And so on, until we have computed every z-inverse!
-     *
-     * We can then convert out of Jacobian form (x = X / Z^2, y = Y / Z^3) with 4 muls and 1 square.
-     **/
-    for (size_t i = num_elements - 1; i < num_elements; --i) {
-        if (!elements[i].is_point_at_infinity()) {
-            Fq z_inv = accumulator * temporaries[i];
-            Fq zz_inv = z_inv.sqr();
-            elements[i].x *= zz_inv;
-            elements[i].y *= (zz_inv * z_inv);
-            accumulator *= elements[i].z;
-        }
-        elements[i].z = Fq::one();
-    }
+    // Convert out of Jacobian form (x = X / Z^2, y = Y / Z^3), inverting all the z-coordinates at once
+    std::vector<Fq> scratch_space(num_elements);
+    BatchAffine<affine_element<Fq, Fr, T>>::normalize_chunk(std::span{ elements, num_elements }, scratch_space.data());
 }
 
 template <typename Fq, typename Fr, typename T>
@@ -1,9 +1,16 @@
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <cmath>
 #include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <limits>
 #include <memory>
+#include <string>
+#ifndef __wasm__
+#include <unistd.h>
+#endif
 
 #include "./process_buckets.hpp"
 #include "./runtime_states.hpp"
@@ -14,6 +21,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/common/throw_or_abort.hpp"
 #include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/ecc/groups/wnaf.hpp"
 #include "barretenberg/numeric/bitop/get_msb.hpp"
 
@@ -101,20 +109,43 @@ namespace bb::scalar_multiplication {
 /**
  * The pippppenger point table computes for each point P = (x,y), a point P' = (\beta * x, -y) which enables us
  * to use the curve endomorphism for faster scalar multiplication. See below for more details.
+ * `points` and `table` must either be the same memory location or not overlap.
  */
 template <typename Curve>
 void generate_pippenger_point_table(const typename Curve::AffineElement* points,
                                     typename Curve::AffineElement* table,
                                     size_t num_points)
 {
-    // iterate backwards, so that `points` and `table` can point to the same memory location
+    // Smaller ranges are not worth spreading over threads
+    constexpr size_t MINIMUM_PARALLEL_POINT_TABLE_SIZE = 1UL << 12;
     using Fq = typename Curve::BaseField;
-    Fq beta = Fq::cube_root_of_unity();
-    for (size_t i = num_points - 1; i < num_points; --i) {
-        table[i * 2] = points[i];
-        table[i * 2 + 1].x = beta * points[i].x;
-        table[i * 2 + 1].y = -points[i].y;
+    const Fq beta = Fq::cube_root_of_unity();
+    const auto expand_points = [&](size_t start, size_t end) {
+        // iterate backwards, so that `points` and `table` can point to the same memory location
+        for (size_t i = end - 1; i + 1 > start; --i) {
+            table[i * 2] = points[i];
+            table[i * 2 + 1].x = beta * points[i].x;
+            table[i * 2 + 1].y = -points[i].y;
+        }
+    };
+    if (static_cast<const void*>(points) != static_cast<const void*>(table)) {
+        parallel_for_range(num_points, expand_points, MINIMUM_PARALLEL_POINT_TABLE_SIZE);
+        return;
+    }
+    // In place, the points [s, n) with s = ceil(n/2) are expanded into [2s, 2n). As 2s >= n, this holds none of the
+    // points still to be read, so they can be expanded in parallel. (With s = floor(n/2) and n odd, 2s = n - 1 would
+    // overwrite the last point before it is read.) Repeating this for [ceil(s/2), s) and so on leaves only the first
+    // point
+    size_t end = num_points;
+    while (end > 1) {
+        const size_t start = (end + 1) / 2;
+        parallel_for_range(
+            end - start,
+            [&](size_t range_start, size_t range_end) { expand_points(start + range_start, start + range_end); },
+            MINIMUM_PARALLEL_POINT_TABLE_SIZE);
+        end = start;
     }
+    expand_points(0, end);
 }
 
 /**
@@ -330,42 +361,33 @@ void add_affine_points(typename Curve::AffineElement* points,
                        const size_t num_points,
                        typename Curve::BaseField* scratch_space)
 {
+    using AffineElement = typename Curve::AffineElement;
     using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
-
-    for (size_t i = 0; i < num_points; i += 2) {
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
 
-    if (batch_inversion_accumulator == 0) {
-        // prefer abort to throw for code that might emit from multiple threads
-        abort_with_message("attempted to invert zero in add_affine_points");
-    } else {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+    // The pair (points[2k], points[2k + 1]) is added into points[k + num_points / 2]. The pairs are consumed in
+    // decreasing order, so no output overwrites a pair that has yet to be read
+    const size_t num_pairs = num_points >> 1;
+    group_elements::BatchAffine<AffineElement>::batch_invert_apply(
+        num_pairs,
+        scratch_space,
+        [&](size_t k) { return points[2 * k + 1].x - points[2 * k].x; }, // x2 - x1
+        [&](size_t k, const Fq& inverse) {
+            // Memory bandwidth is a bit of a bottleneck here.
+            // There's probably a more elegant way of structuring our data so we don't need to do all of this
+            // prefetching
+            __builtin_prefetch(points + 2 * k - 2);
+            __builtin_prefetch(points + 2 * k - 1);
+            __builtin_prefetch(points + k + num_pairs - 1);
+            __builtin_prefetch(scratch_space + k - 1);
+
+            const AffineElement& p1 = points[2 * k];
+            const AffineElement& p2 = points[2 * k + 1];
+            const Fq lambda = (p2.y - p1.y) * inverse;
+            const Fq x3 = lambda.sqr() - p2.x - p1.x;
+            const Fq y3 = lambda * (p1.x - x3) - p1.y;
+            points[k + num_pairs].x = x3;
+            points[k + num_pairs].y = y3;
+        });
 }
 
 template <typename Curve>
@@ -373,65 +395,67 @@ void add_affine_points_with_edge_cases(typename Curve::AffineElement* points,
                                        const size_t num_points,
                                        typename Curve::BaseField* scratch_space)
 {
+    using AffineElement = typename Curve::AffineElement;
     using Fq = typename Curve::BaseField;
-    Fq batch_inversion_accumulator = Fq::one();
 
-    for (size_t i = 0; i < num_points; i += 2) {
-        if (points[i].is_point_at_infinity() || points[i + 1].is_point_at_infinity()) {
-            continue;
-        }
-        if (points[i].x == points[i + 1].x) {
-            if (points[i].y == points[i + 1].y) {
-                // double
-                scratch_space[i >> 1] = points[i].x + points[i].x; // 2x
-                Fq x_squared = points[i].x.sqr();
-                points[i + 1].x = points[i].y + points[i].y;         // 2y
-                points[i + 1].y = x_squared + x_squared + x_squared; // 3x^2
-                points[i + 1].y *= batch_inversion_accumulator;
-                batch_inversion_accumulator *= (points[i + 1].x);
-                continue;
+    // As in add_affine_points, but pairs containing the point at infinity, or two points with the same x coordinate,
+    // are handled separately. Pairs that need no inversion use a denominator of one
+    const size_t num_pairs = num_points >> 1;
+    const auto is_generic_pair = [](const AffineElement& p1, const AffineElement& p2) {
+        return !p1.is_point_at_infinity() && !p2.is_point_at_infinity() && p1.x != p2.x;
+    };
+    const auto is_doubling_pair = [](const AffineElement& p1, const AffineElement& p2) {
+        return !p1.is_point_at_infinity() && !p2.is_point_at_infinity() && p1.x == p2.x && p1.y == p2.y;
+    };
+    group_elements::BatchAffine<AffineElement>::batch_invert_apply(
+        num_pairs,
+        scratch_space,
+        [&](size_t k) {
+            const AffineElement& p1 = points[2 * k];
+            const AffineElement& p2 = points[2 * k + 1];
+            if (is_generic_pair(p1, p2)) {
+                return p2.x - p1.x; // x2 - x1
             }
-            points[i].self_set_infinity();
-            points[i + 1].self_set_infinity();
-            continue;
-        }
-
-        scratch_space[i >> 1] = points[i].x + points[i + 1].x; // x2 + x1
-        points[i + 1].x -= points[i].x;                        // x2 - x1
-        points[i + 1].y -= points[i].y;                        // y2 - y1
-        points[i + 1].y *= batch_inversion_accumulator;        // (y2 - y1)*accumulator_old
-        batch_inversion_accumulator *= (points[i + 1].x);
-    }
-    if (!batch_inversion_accumulator.is_zero()) {
-        batch_inversion_accumulator = batch_inversion_accumulator.invert();
-    }
-    for (size_t i = (num_points)-2; i < num_points; i -= 2) {
-        // Memory bandwidth is a bit of a bottleneck here.
-        // There's probably a more elegant way of structuring our data so we don't need to do all of this
-        // prefetching
-        __builtin_prefetch(points + i - 2);
-        __builtin_prefetch(points + i - 1);
-        __builtin_prefetch(points + ((i + num_points - 2) >> 1));
-        __builtin_prefetch(scratch_space + ((i - 2) >> 1));
-
-        if (points[i].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i + 1];
-            continue;
-        }
-        if (points[i + 1].is_point_at_infinity()) {
-            points[(i + num_points) >> 1] = points[i];
-            continue;
-        }
-
-        points[i + 1].y *= batch_inversion_accumulator; // update accumulator
-        batch_inversion_accumulator *= points[i + 1].x;
-        points[i + 1].x = points[i + 1].y.sqr();
-        points[(i + num_points) >> 1].x = points[i + 1].x - (scratch_space[i >> 1]); // x3 = lambda_squared - x2
-                                                                                     // - x1
-        points[i].x -= points[(i + num_points) >> 1].x;
-        points[i].x *= points[i + 1].y;
-        points[(i + num_points) >> 1].y = points[i].x - points[i].y;
-    }
+            if (is_doubling_pair(p1, p2)) {
+                return p1.y + p1.y; // 2y
+            }
+            return Fq::one();
+        },
+        [&](size_t k, const Fq& inverse) {
+            // Memory bandwidth is a bit of a bottleneck here.
+            // There's probably a more elegant way of structuring our data so we don't need to do all of this
+            // prefetching
+            __builtin_prefetch(points + 2 * k - 2);
+            __builtin_prefetch(points + 2 * k - 1);
+            __builtin_prefetch(points + k + num_pairs - 1);
+            __builtin_prefetch(scratch_space + k - 1);
+
+            const AffineElement& p1 = points[2 * k];
+            const AffineElement& p2 = points[2 * k + 1];
+            AffineElement& result = points[k + num_pairs];
+            if (p1.is_point_at_infinity()) {
+                result = p2;
+                return;
+            }
+            if (p2.is_point_at_infinity()) {
+                result = p1;
+                return;
+            }
+            Fq lambda;
+            if (p1.x != p2.x) {
+                lambda = (p2.y - p1.y) * inverse;
+            } else if (p1.y == p2.y) {
+                const Fq x_squared = p1.x.sqr();
+                lambda = (x_squared + x_squared + x_squared) * inverse;
+            } else {
+                result.self_set_infinity();
+                return;
+            }
+            const Fq x3 = lambda.sqr() - p2.x - p1.x;
+            const Fq y3 = lambda * (p1.x - x3) - p1.y;
+            result.x = x3;
+            result.y = y3;
+        });
 }
 
 /**
@@ -889,6 +913,31 @@ typename Curve::Element pippenger_internal(std::span<const typename Curve::Affin
     return result;
 }
 
+namespace {
+PippengerAlgorithm get_default_pippenger_algorithm()
+{
+    const char* algorithm = std::getenv("BB_PIPPENGER_ALGORITHM");
+    return algorithm != nullptr && std::string(algorithm) == "signed_digit" ? PippengerAlgorithm::SIGNED_DIGIT
+                                                                            : PippengerAlgorithm::WNAF;
+}
+
+std::atomic<PippengerAlgorithm>& pippenger_algorithm()
+{
+    static std::atomic<PippengerAlgorithm> algorithm = get_default_pippenger_algorithm();
+    return algorithm;
+}
+} // namespace
+
+PippengerAlgorithm get_pippenger_algorithm()
+{
+    return pippenger_algorithm().load(std::memory_order_relaxed);
+}
+
+void set_pippenger_algorithm(PippengerAlgorithm algorithm)
+{
+    pippenger_algorithm().store(algorithm, std::memory_order_relaxed);
+}
+
 template <typename Curve>
 typename Curve::Element pippenger(std::span<const typename Curve::ScalarField> scalars,
                                   std::span<const typename Curve::AffineElement> points,
@@ -924,6 +973,10 @@ typename Curve::Element pippenger(std::span<const typename Curve::ScalarField> s
         return exponentiation_results[0];
     }
 
+    if (!handle_edge_cases && get_pippenger_algorithm() == PippengerAlgorithm::SIGNED_DIGIT) {
+        return pippenger_signed_digit<Curve>(scalars, points);
+    }
+
     const auto slice_bits = static_cast<size_t>(numeric::get_msb(static_cast<uint64_t>(num_initial_points)));
     const auto num_slice_points = static_cast<size_t>(1ULL << slice_bits);
 
@@ -955,6 +1008,10 @@ typename Curve::Element pippenger_unsafe_optimized_for_non_dyadic_polys(
     if (scalars.size() <= threshold) {
         return pippenger_unsafe(scalars, points, state);
     }
+    // The signed digit variant needs no padding, but is happy to make use of it
+    if (get_pippenger_algorithm() == PippengerAlgorithm::SIGNED_DIGIT) {
+        return pippenger_signed_digit<Curve>(scalars, points);
+    }
     // We need a padding of scalars.
     ASSERT(numeric::round_up_power_2(scalars.size()) * 2 <= points.size());
     // We do not optimize for the small case at all.
@@ -996,6 +1053,598 @@ typename Curve::Element pippenger_without_endomorphism_basis_points(
     return pippenger(scalars, G_mod, state, false);
 }
 
+/**
+ * @brief The number of signed digit windows needed to recode a scalar of scalar_bits bits
+ * @details The top digit is below 2^{c-1} only if the top window holds at most c - 2 bits of the scalar, as its slice
+ * may absorb a carry from the window below. So the windows must cover scalar_bits + 2 bits.
+ */
+size_t get_num_signed_digit_windows(const size_t digit_bits, const size_t scalar_bits)
+{
+    return (scalar_bits + digit_bits + 1) / digit_bits;
+}
+
+/**
+ * @brief Recode a 128-bit endomorphism scalar into signed digits d_i in [-2^{c-1}, 2^{c-1}), so that
+ * k = \sum_i d_i * 2^{i * c}. Digit i is written to digits[i * stride].
+ * @details A point with digit d is added into bucket |d| - 1, negated if d < 0. So a c-bit window needs 2^{c-1}
+ * buckets, half as many as unsigned digits would.
+ */
+void compute_signed_digits(
+    const uint64_t* scalar, const size_t digit_bits, const size_t num_windows, int16_t* digits, const size_t stride)
+{
+    const uint64_t digit_mask = (1ULL << digit_bits) - 1;
+    const auto half_window = static_cast<int64_t>(1ULL << (digit_bits - 1));
+    int64_t carry = 0;
+    for (size_t window = 0; window < num_windows; ++window) {
+        const size_t lo = window * digit_bits;
+        uint64_t slice = 0;
+        if (lo < 128) {
+            const size_t limb = lo / 64;
+            const size_t shift = lo % 64;
+            slice = scalar[limb] >> shift;
+            if (limb == 0 && shift + digit_bits > 64) {
+                slice |= scalar[1] << (64 - shift);
+            }
+        }
+        int64_t digit = static_cast<int64_t>(slice & digit_mask) + carry;
+        carry = digit >= half_window ? 1 : 0;
+        digit -= carry * 2 * half_window;
+        digits[window * stride] = static_cast<int16_t>(digit);
+    }
+    // The windows must be able to hold the whole scalar, including the final carry
+    ASSERT(carry == 0);
+}
+
+namespace {
+
+size_t get_l2_cache_size()
+{
+    // Used if the cache size cannot be queried
+    constexpr size_t DEFAULT_L2_CACHE_SIZE = 1UL << 20;
+#if !defined(__wasm__) && defined(_SC_LEVEL2_CACHE_SIZE)
+    static const long cache_size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    if (cache_size > 0) {
+        return static_cast<size_t>(cache_size);
+    }
+#endif
+    return DEFAULT_L2_CACHE_SIZE;
+}
+
+/**
+ * @brief The number of ranges of points each window is split into, each of which is evaluated into its own buckets
+ * @details We want about two (window, range) work items per thread, but no range with fewer points than buckets, at
+ * which point reducing the buckets would cost more than filling them.
+ */
+size_t get_num_signed_digit_ranges(const size_t num_points,
+                                   const size_t num_threads,
+                                   const size_t num_windows,
+                                   const size_t num_buckets)
+{
+    const size_t target_ranges = (2 * num_threads + num_windows - 1) / num_windows;
+    return std::max(1UL, std::min(target_ranges, num_points / num_buckets));
+}
+
+/**
+ * @brief Split scalars [start, end) with the endomorphism and recode both halves into signed digits. The digit of point
+ * table entry i in window w is written to digits[w * num_points + i].
+ */
+template <typename Curve>
+void compute_signed_digit_table(std::span<const typename Curve::ScalarField> scalars,
+                                const size_t start,
+                                const size_t end,
+                                const size_t digit_bits,
+                                const size_t num_windows,
+                                int16_t* digits,
+                                const size_t num_points)
+{
+    using Fr = typename Curve::ScalarField;
+    for (size_t i = start; i < end; ++i) {
+        if (scalars[i].is_zero()) {
+            for (size_t window = 0; window < num_windows; ++window) {
+                digits[window * num_points + i * 2] = 0;
+                digits[window * num_points + i * 2 + 1] = 0;
+            }
+            continue;
+        }
+        Fr k = scalars[i].from_montgomery_form();
+        Fr::split_into_endomorphism_scalars(k, k, *(Fr*)&k.data[2]);
+        compute_signed_digits(&k.data[0], digit_bits, num_windows, &digits[i * 2], num_points);
+        compute_signed_digits(&k.data[2], digit_bits, num_windows, &digits[i * 2 + 1], num_points);
+    }
+}
+
+/**
+ * @brief Compute \sum_b (b + 1) * B_b, where bucket B_b is the sum of the points in [start, end) with digit ±(b + 1)
+ * @details Buckets are kept in affine form and points are added into them in batches, so that a single field inversion
+ * is shared by the whole batch (Montgomery's trick). A bucket can only be updated once per batch, so a point whose
+ * bucket is already in the current batch is instead added into a Jacobian overflow bucket, as is a point with the
+ * same x coordinate as its bucket (the doubling and inverse cases). With few buckets collisions are frequent, so
+ * then every point goes into the Jacobian buckets.
+ */
+template <typename Curve>
+typename Curve::Element evaluate_signed_digit_window(const int16_t* digits,
+                                                     const typename Curve::AffineElement* points,
+                                                     const size_t start,
+                                                     const size_t end,
+                                                     const size_t num_buckets)
+{
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fq = typename Curve::BaseField;
+    // With B buckets and batches of size S, a point collides with the current batch with probability ~S / 2B and the
+    // inversion (a few hundred multiplications) is shared by S additions. S ~ sqrt(128 * B) balances the two, and
+    // batching stops paying off below a few hundred buckets.
+    constexpr size_t MIN_BATCHED_BUCKETS = 256;
+    constexpr size_t MAX_BATCH_SIZE = 1024;
+    const auto batch_size =
+        std::min(static_cast<size_t>(std::sqrt(128.0 * static_cast<double>(num_buckets))), MAX_BATCH_SIZE);
+    const bool use_batches = num_buckets >= MIN_BATCHED_BUCKETS;
+
+    std::vector<AffineElement> buckets(use_batches ? num_buckets : 0);
+    std::vector<Element> overflow_buckets(num_buckets);
+    for (auto& bucket : overflow_buckets) {
+        bucket.self_set_infinity();
+    }
+    // 0 if the affine bucket is empty, otherwise the ID of the last batch that updated it (or 1 if none has)
+    std::vector<uint32_t> bucket_batch_ids(use_batches ? num_buckets : 0, 0);
+    uint32_t batch_id = 2;
+
+    std::vector<uint32_t> batch_buckets(use_batches ? batch_size : 0);
+    std::vector<AffineElement> batch_points(use_batches ? batch_size : 0);
+    std::vector<Fq> batch_denominators(use_batches ? batch_size : 0);
+    std::vector<Fq> batch_scratch(use_batches ? batch_size : 0);
+    size_t batch_count = 0;
+
+    const auto evaluate_batch = [&]() {
+        group_elements::BatchAffine<AffineElement>::batch_invert_apply(
+            batch_count,
+            batch_scratch.data(),
+            [&](size_t i) { return batch_denominators[i]; },
+            [&](size_t i, const Fq& denominator_inverse) {
+                AffineElement& bucket = buckets[batch_buckets[i]];
+                const AffineElement& point = batch_points[i];
+                const Fq lambda = (point.y - bucket.y) * denominator_inverse;
+                const Fq x3 = lambda.sqr() - bucket.x - point.x;
+                bucket.y = lambda * (bucket.x - x3) - bucket.y;
+                bucket.x = x3;
+            });
+        batch_count = 0;
+        ++batch_id;
+    };
+
+    for (size_t i = start; i < end; ++i) {
+        const int16_t digit = digits[i];
+        if (digit == 0 || points[i].is_point_at_infinity()) {
+            continue;
+        }
+        const auto bucket_index = static_cast<size_t>(std::abs(digit) - 1);
+        AffineElement point = points[i];
+        if (digit < 0) {
+            point.y = -point.y;
+        }
+        if (!use_batches) {
+            overflow_buckets[bucket_index] += point;
+            continue;
+        }
+        uint32_t& bucket_batch_id = bucket_batch_ids[bucket_index];
+        if (bucket_batch_id == 0) {
+            buckets[bucket_index] = point;
+            bucket_batch_id = 1;
+            continue;
+        }
+        if (bucket_batch_id == batch_id || point.x == buckets[bucket_index].x) {
+            overflow_buckets[bucket_index] += point;
+            continue;
+        }
+        bucket_batch_id = batch_id;
+        batch_buckets[batch_count] = static_cast<uint32_t>(bucket_index);
+        batch_points[batch_count] = point;
+        batch_denominators[batch_count] = point.x - buckets[bucket_index].x;
+        if (++batch_count == batch_size) {
+            evaluate_batch();
+        }
+    }
+    if (batch_count > 0) {
+        evaluate_batch();
+    }
+
+    // \sum_b (b + 1) * B_b, via a running sum from the highest bucket down
+    Element running_sum;
+    Element window_sum;
+    running_sum.self_set_infinity();
+    window_sum.self_set_infinity();
+    for (size_t b = num_buckets - 1; b < num_buckets; --b) {
+        if (use_batches && bucket_batch_ids[b] != 0) {
+            running_sum += buckets[b];
+        }
+        running_sum += overflow_buckets[b];
+        window_sum += running_sum;
+    }
+    return window_sum;
+}
+
+/**
+ * @brief Compute \sum_i k_i * P_i from a table of signed digits of the scalars k_i, using every thread
+ * @details Every window is split into ranges of points. Each (window, range) pair is a work item with its own buckets
+ * (see `evaluate_signed_digit_window`). The work items of a window are then summed, and the windows combined by
+ * doubling.
+ *
+ * @param digits The digit of point i in window w is digits[w * num_points + i]
+ */
+template <typename Curve>
+typename Curve::Element evaluate_signed_digit_table(const int16_t* digits,
+                                                    const typename Curve::AffineElement* points,
+                                                    const size_t num_points,
+                                                    const size_t digit_bits,
+                                                    const size_t num_windows)
+{
+    using Element = typename Curve::Element;
+    const size_t num_buckets = 1UL << (digit_bits - 1);
+    const size_t num_ranges = get_num_signed_digit_ranges(num_points, get_num_cpus(), num_windows, num_buckets);
+
+    std::vector<Element> range_sums(num_windows * num_ranges);
+    parallel_for(range_sums.size(), [&](size_t i) {
+        const size_t window = i / num_ranges;
+        const size_t range = i % num_ranges;
+        range_sums[i] = evaluate_signed_digit_window<Curve>(&digits[window * num_points],
+                                                            points,
+                                                            (num_points * range) / num_ranges,
+                                                            (num_points * (range + 1)) / num_ranges,
+                                                            num_buckets);
+    });
+
+    Element result;
+    result.self_set_infinity();
+    for (size_t window = num_windows - 1; window < num_windows; --window) {
+        for (size_t j = 0; j < digit_bits; ++j) {
+            result.self_dbl();
+        }
+        for (size_t range = 0; range < num_ranges; ++range) {
+            result += range_sums[window * num_ranges + range];
+        }
+    }
+    return result;
+}
+
+} // namespace
+
+/**
+ * @brief Choose the window size of `pippenger_signed_digit` for a number of points (twice the number of scalars), or
+ * more generally for a number of points whose scalars have at most scalar_bits bits
+ * @details Estimates the time taken by each window size, in units of a batched affine addition. Work items of a
+ * (window, range of points) pair are spread over the threads, and each adds its points into buckets and then
+ * reduces them. Windows whose buckets do not fit in the L2 cache are penalised, as then most bucket additions miss it.
+ */
+size_t get_signed_digit_window_bits(const size_t num_points, const size_t num_threads, const size_t scalar_bits)
+{
+    // An affine bucket and its batch ID. The overflow buckets are rarely touched when the buckets are numerous.
+    constexpr size_t BUCKET_BYTES = 68;
+    // Reducing a bucket takes a mixed and a Jacobian addition, ~3 times the cost of a batched affine addition
+    constexpr double REDUCTION_COST = 3;
+    // Buckets spilling out of L2 mostly still hit L3, which is slow next to a cache hit but fast next to an addition
+    constexpr double CACHE_MISS_PENALTY = 1.2;
+    const size_t cache_size = get_l2_cache_size();
+
+    size_t best_bits = 2;
+    double best_cost = std::numeric_limits<double>::max();
+    for (size_t bits = 2; bits <= MAX_SIGNED_DIGIT_BITS; ++bits) {
+        const size_t num_windows = get_num_signed_digit_windows(bits, scalar_bits);
+        const size_t num_buckets = 1UL << (bits - 1);
+        const size_t num_ranges = get_num_signed_digit_ranges(num_points, num_threads, num_windows, num_buckets);
+        const size_t num_items = num_windows * num_ranges;
+        const double item_cost = static_cast<double>(num_points) / static_cast<double>(num_ranges) +
+                                 static_cast<double>(num_buckets) * REDUCTION_COST;
+        // Work items are spread over the threads
+        double cost =
+            item_cost * static_cast<double>(num_items) / static_cast<double>(std::min(num_items, num_threads));
+        if (num_buckets * BUCKET_BYTES > cache_size) {
+            cost *= CACHE_MISS_PENALTY;
+        }
+        if (cost < best_cost) {
+            best_cost = cost;
+            best_bits = bits;
+        }
+    }
+    return best_bits;
+}
+
+/**
+ * @brief Evaluate an MSM on the calling thread only, for use when many independent MSMs are evaluated concurrently.
+ * @details Each scalar is split into two 128-bit halves using the endomorphism, so `points` must be a pippenger point
+ * table (see `generate_pippenger_point_table`) with 2 entries per scalar. The halves are recoded into signed c-bit
+ * digits (see `compute_signed_digits`), which lets us use 2^{c-1} buckets per window. Unlike the wnaf used by
+ * `pippenger`, digits can be zero. Zero digits (and zero scalars) add nothing to the buckets, so sparse inputs are
+ * cheap. No scratch space or point schedule is needed.
+ */
+template <typename Curve>
+typename Curve::Element pippenger_single_threaded(std::span<const typename Curve::ScalarField> scalars,
+                                                  std::span<const typename Curve::AffineElement> points)
+{
+    using Element = typename Curve::Element;
+
+    Element result;
+    result.self_set_infinity();
+    const size_t num_points = scalars.size() * 2;
+    if (num_points == 0) {
+        return result;
+    }
+    ASSERT(num_points <= points.size());
+
+    const size_t digit_bits = get_signed_digit_window_bits(num_points, 1);
+    const size_t num_windows = get_num_signed_digit_windows(digit_bits);
+    const size_t num_buckets = 1UL << (digit_bits - 1);
+    std::vector<int16_t> digits(num_windows * num_points);
+    compute_signed_digit_table<Curve>(scalars, 0, scalars.size(), digit_bits, num_windows, digits.data(), num_points);
+
+    for (size_t window = num_windows - 1; window < num_windows; --window) {
+        for (size_t j = 0; j < digit_bits; ++j) {
+            result.self_dbl();
+        }
+        result += evaluate_signed_digit_window<Curve>(
+            &digits[window * num_points], points.data(), 0, num_points, num_buckets);
+    }
+    return result;
+}
+
+/**
+ * @brief Pippenger with signed digits and batched affine bucket additions, an alternative to the wnaf based
+ * `pippenger` (see `set_pippenger_algorithm`).
+ * @details The scalars are split with the endomorphism and recoded into signed c-bit digits, with c chosen from the
+ * number of points, the number of threads and the cache size (see `get_signed_digit_window_bits`). Rather than
+ * sorting the points by bucket, every window is split into ranges of points. Each (window, range) pair is a work item
+ * with its own buckets, which it fills using batched affine additions and then reduces to a single point. The work
+ * items of a window are then summed, and the windows combined by doubling.
+ *
+ * @param scalars
+ * @param points A pippenger point table, with 2 entries per scalar
+ */
+template <typename Curve>
+typename Curve::Element pippenger_signed_digit(std::span<const typename Curve::ScalarField> scalars,
+                                               std::span<const typename Curve::AffineElement> points)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+
+    Element result;
+    result.self_set_infinity();
+    const size_t num_scalars = scalars.size();
+    const size_t num_points = num_scalars * 2;
+    if (num_scalars == 0) {
+        return result;
+    }
+    ASSERT(num_points <= points.size());
+
+    const size_t digit_bits = get_signed_digit_window_bits(num_points, get_num_cpus());
+    const size_t num_windows = get_num_signed_digit_windows(digit_bits);
+
+    // Left uninitialized, as every digit is written
+    std::unique_ptr<int16_t[]> digits(new int16_t[num_windows * num_points]);
+    parallel_for_range(num_scalars, [&](size_t start, size_t end) {
+        compute_signed_digit_table<Curve>(scalars, start, end, digit_bits, num_windows, digits.get(), num_points);
+    });
+
+    return evaluate_signed_digit_table<Curve>(digits.get(), points.data(), num_points, digit_bits, num_windows);
+}
+
+/**
+ * @brief Evaluate a batch of independent MSMs, e.g. the commitments to a set of polynomials.
+ * @details Calling pippenger once per MSM pays a full thread fan-out (and the wnaf computation and bucket sort) for
+ * each one, which leaves most cores idle when the MSMs are small. Here, MSMs larger than
+ * BATCH_MSM_PARALLEL_THRESHOLD are still evaluated one at a time by the multi-threaded pippenger, as they fill every
+ * core on their own. The remaining MSMs are cut into chunks of roughly equal size, and every chunk of every MSM is
+ * evaluated by `pippenger_single_threaded` in a single parallel_for. The chunk results are then summed per MSM and the
+ * results normalized together.
+ *
+ * @param scalars The scalars of each MSM
+ * @param points A pippenger point table for each MSM, with 2 entries per scalar
+ * @param state Scratch space for the multi-threaded pippenger, must be large enough for the largest MSM
+ * @return The result of each MSM, in order
+ */
+template <typename Curve>
+std::vector<typename Curve::AffineElement> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    std::span<const std::span<const typename Curve::AffineElement>> points,
+    pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    ASSERT(scalars.size() == points.size());
+
+    const size_t num_msms = scalars.size();
+    std::vector<Element> results(num_msms);
+    size_t total_small_scalars = 0;
+    for (size_t i = 0; i < num_msms; ++i) {
+        results[i].self_set_infinity();
+        const size_t num_scalars = scalars[i].size();
+        if (num_scalars <= BATCH_MSM_PARALLEL_THRESHOLD) {
+            total_small_scalars += num_scalars;
+            continue;
+        }
+        // The points of a polynomial commitment are padded to a power of 2, which we can take advantage of
+        if (numeric::round_up_power_2(num_scalars) * 2 <= points[i].size()) {
+            results[i] = pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(scalars[i], points[i], state);
+        } else {
+            results[i] = pippenger_unsafe<Curve>(scalars[i], points[i], state);
+        }
+    }
+
+    if (total_small_scalars > 0) {
+        // Aim for a few chunks per thread so that a thread that finishes early can pick up more work
+        constexpr size_t MIN_CHUNK_SIZE = 1UL << 8;
+        constexpr size_t CHUNKS_PER_THREAD = 4;
+        const size_t target_chunks = get_num_cpus() * CHUNKS_PER_THREAD;
+        const size_t chunk_size = std::max(MIN_CHUNK_SIZE, (total_small_scalars + target_chunks - 1) / target_chunks);
+
+        struct Chunk {
+            size_t msm;
+            size_t start;
+            size_t end;
+        };
+        std::vector<Chunk> chunks;
+        for (size_t i = 0; i < num_msms; ++i) {
+            const size_t num_scalars = scalars[i].size();
+            if (num_scalars > BATCH_MSM_PARALLEL_THRESHOLD) {
+                continue;
+            }
+            // Spread the MSM evenly over its chunks, rather than leaving a small remainder
+            const size_t num_chunks = (num_scalars + chunk_size - 1) / chunk_size;
+            for (size_t j = 0; j < num_chunks; ++j) {
+                chunks.push_back({ i, (num_scalars * j) / num_chunks, (num_scalars * (j + 1)) / num_chunks });
+            }
+        }
+
+        std::vector<Element> chunk_results(chunks.size());
+        parallel_for(chunks.size(), [&](size_t i) {
+            const Chunk& chunk = chunks[i];
+            chunk_results[i] = pippenger_single_threaded<Curve>(
+                scalars[chunk.msm].subspan(chunk.start, chunk.end - chunk.start),
+                points[chunk.msm].subspan(chunk.start * 2));
+        });
+        for (size_t i = 0; i < chunks.size(); ++i) {
+            results[chunks[i].msm] += chunk_results[i];
+        }
+    }
+
+    Element::batch_normalize(results.data(), num_msms);
+    std::vector<typename Curve::AffineElement> affine_results(num_msms);
+    for (size_t i = 0; i < num_msms; ++i) {
+        affine_results[i] = results[i];
+    }
+    return affine_results;
+}
+
+/**
+ * @brief Evaluate an MSM whose scalars are mostly zero, one or small, e.g. a commitment to a selector, a range check
+ * limb or a structured trace block with long runs of zeros.
+ * @details The scalars are classified in a single pass, and each class evaluated by a suitable method:
+ *  - zero: skipped
+ *  - one: the points are summed
+ *  - small, less than 2^64: a signed digit pippenger over the raw points (without the endomorphism), with only as many
+ *    windows as the largest small scalar needs
+ *  - full: copied, along with their points, and evaluated by `pippenger_unsafe`
+ * Copying the full scalars and their points is only worth the memory while they are a minority. So if more than half
+ * of the scalars are full, the MSM is evaluated over all of the scalars as usual instead.
+ *
+ * @param scalars
+ * @param points A pippenger point table, with 2 entries per scalar
+ * @param state Scratch space for pippenger_unsafe
+ */
+template <typename Curve>
+typename Curve::Element pippenger_classified_unsafe(std::span<const typename Curve::ScalarField> scalars,
+                                                    std::span<const typename Curve::AffineElement> points,
+                                                    pippenger_runtime_state<Curve>& state)
+{
+    BB_OP_COUNT_TIME();
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    Element result;
+    result.self_set_infinity();
+    const size_t num_scalars = scalars.size();
+    if (num_scalars == 0) {
+        return result;
+    }
+    ASSERT(num_scalars * 2 <= points.size());
+
+    // The classes of a block of scalars, one block per thread
+    struct ScalarClasses {
+        Element ones_sum;
+        std::vector<size_t> small_indices;
+        std::vector<uint64_t> small_scalars;
+        std::vector<size_t> full_indices;
+        // The bitwise OR of the small scalars, which bounds their size
+        uint64_t small_scalar_bits = 0;
+    };
+    const size_t num_threads = calculate_num_threads(num_scalars);
+    const size_t block_size = (num_scalars + num_threads - 1) / num_threads;
+    std::vector<ScalarClasses> thread_classes(num_threads);
+    parallel_for(num_threads, [&](size_t thread_idx) {
+        ScalarClasses& classes = thread_classes[thread_idx];
+        classes.ones_sum.self_set_infinity();
+        const size_t start = thread_idx * block_size;
+        const size_t end = std::min(num_scalars, (thread_idx + 1) * block_size);
+        for (size_t i = start; i < end; ++i) {
+            if (scalars[i].is_zero()) {
+                continue;
+            }
+            const Fr scalar = scalars[i].from_montgomery_form();
+            if ((scalar.data[1] | scalar.data[2] | scalar.data[3]) != 0) {
+                classes.full_indices.emplace_back(i);
+            } else if (scalar.data[0] == 1) {
+                classes.ones_sum += points[i * 2];
+            } else {
+                classes.small_indices.emplace_back(i);
+                classes.small_scalars.emplace_back(scalar.data[0]);
+                classes.small_scalar_bits |= scalar.data[0];
+            }
+        }
+    });
+
+    // Offsets of each thread's small and full scalars in the compacted inputs
+    std::vector<size_t> small_offsets(num_threads + 1, 0);
+    std::vector<size_t> full_offsets(num_threads + 1, 0);
+    uint64_t small_scalar_bits = 0;
+    for (size_t i = 0; i < num_threads; ++i) {
+        small_offsets[i + 1] = small_offsets[i] + thread_classes[i].small_indices.size();
+        full_offsets[i + 1] = full_offsets[i] + thread_classes[i].full_indices.size();
+        small_scalar_bits |= thread_classes[i].small_scalar_bits;
+    }
+    const size_t num_small = small_offsets[num_threads];
+    const size_t num_full = full_offsets[num_threads];
+
+    if (num_full * 2 > num_scalars) {
+        // The points of a polynomial commitment are padded to a power of 2, which we can take advantage of
+        if (numeric::round_up_power_2(num_scalars) * 2 <= points.size()) {
+            return pippenger_unsafe_optimized_for_non_dyadic_polys<Curve>(scalars, points, state);
+        }
+        return pippenger_unsafe<Curve>(scalars, points, state);
+    }
+
+    for (const auto& classes : thread_classes) {
+        result += classes.ones_sum;
+    }
+
+    if (num_small > 0) {
+        // Small scalars have at least 2 bits, as ones are handled separately
+        const size_t scalar_bits = numeric::get_msb(small_scalar_bits) + 1;
+        const size_t digit_bits = get_signed_digit_window_bits(num_small, get_num_cpus(), scalar_bits);
+        const size_t num_windows = get_num_signed_digit_windows(digit_bits, scalar_bits);
+        std::vector<AffineElement> small_points(num_small);
+        // Left uninitialized, as every digit is written
+        std::unique_ptr<int16_t[]> digits(new int16_t[num_windows * num_small]);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const ScalarClasses& classes = thread_classes[thread_idx];
+            for (size_t i = 0; i < classes.small_indices.size(); ++i) {
+                const size_t idx = small_offsets[thread_idx] + i;
+                const std::array<uint64_t, 2> scalar{ classes.small_scalars[i], 0 };
+                small_points[idx] = points[classes.small_indices[i] * 2];
+                compute_signed_digits(scalar.data(), digit_bits, num_windows, &digits[idx], num_small);
+            }
+        });
+        result += evaluate_signed_digit_table<Curve>(
+            digits.get(), small_points.data(), num_small, digit_bits, num_windows);
+    }
+
+    if (num_full > 0) {
+        std::vector<Fr> full_scalars(num_full);
+        std::vector<AffineElement> full_points(num_full * 2);
+        parallel_for(num_threads, [&](size_t thread_idx) {
+            const ScalarClasses& classes = thread_classes[thread_idx];
+            for (size_t i = 0; i < classes.full_indices.size(); ++i) {
+                const size_t idx = full_offsets[thread_idx] + i;
+                const size_t scalar_idx = classes.full_indices[i];
+                // Keep both the raw point and the precomputed endomorphism point from the point table
+                full_scalars[idx] = scalars[scalar_idx];
+                full_points[idx * 2] = points[scalar_idx * 2];
+                full_points[idx * 2 + 1] = points[scalar_idx * 2 + 1];
+            }
+        });
+        result += pippenger_unsafe<Curve>(full_scalars, full_points, state);
+    }
+    return result;
+}
+
 // Explicit instantiation
 // BN254
 template void generate_pippenger_point_table<curve::BN254>(const curve::BN254::AffineElement* points,
@@ -1051,6 +1700,21 @@ template curve::BN254::Element pippenger_without_endomorphism_basis_points<curve
     std::span<const curve::BN254::AffineElement> points,
     pippenger_runtime_state<curve::BN254>& state);
 
+template curve::BN254::Element pippenger_signed_digit<curve::BN254>(
+    std::span<const curve::BN254::ScalarField> scalars, std::span<const curve::BN254::AffineElement> points);
+
+template curve::BN254::Element pippenger_single_threaded<curve::BN254>(
+    std::span<const curve::BN254::ScalarField> scalars, std::span<const curve::BN254::AffineElement> points);
+
+template std::vector<curve::BN254::AffineElement> pippenger_batch_unsafe<curve::BN254>(
+    std::span<const std::span<const curve::BN254::ScalarField>> scalars,
+    std::span<const std::span<const curve::BN254::AffineElement>> points,
+    pippenger_runtime_state<curve::BN254>& state);
+template curve::BN254::Element pippenger_classified_unsafe<curve::BN254>(
+    std::span<const curve::BN254::ScalarField> scalars,
+    std::span<const curve::BN254::AffineElement> points,
+    pippenger_runtime_state<curve::BN254>& state);
+
 // Grumpkin
 template void generate_pippenger_point_table<curve::Grumpkin>(const curve::Grumpkin::AffineElement* points,
                                                               curve::Grumpkin::AffineElement* table,
@@ -1105,6 +1769,21 @@ template curve::Grumpkin::Element pippenger_without_endomorphism_basis_points<cu
     std::span<const curve::Grumpkin::AffineElement> points,
     pippenger_runtime_state<curve::Grumpkin>& state);
 
+template curve::Grumpkin::Element pippenger_signed_digit<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars, std::span<const curve::Grumpkin::AffineElement> points);
+
+template curve::Grumpkin::Element pippenger_single_threaded<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars, std::span<const curve::Grumpkin::AffineElement> points);
+
+template std::vector<curve::Grumpkin::AffineElement> pippenger_batch_unsafe<curve::Grumpkin>(
+    std::span<const std::span<const curve::Grumpkin::ScalarField>> scalars,
+    std::span<const std::span<const curve::Grumpkin::AffineElement>> points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+template curve::Grumpkin::Element pippenger_classified_unsafe<curve::Grumpkin>(
+    std::span<const curve::Grumpkin::ScalarField> scalars,
+    std::span<const curve::Grumpkin::AffineElement> points,
+    pippenger_runtime_state<curve::Grumpkin>& state);
+
 } // namespace bb::scalar_multiplication
 
 // NOLINTEND(cppcoreguidelines-avoid-c-arrays, google-readability-casting)
@@ -5,6 +5,8 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include <cstddef>
 #include <cstdint>
+#include <span>
+#include <vector>
 
 namespace bb::scalar_multiplication {
 
@@ -174,6 +176,46 @@ typename Curve::Element pippenger_unsafe_optimized_for_non_dyadic_polys(
     std::span<const typename Curve::AffineElement> points,
     pippenger_runtime_state<Curve>& state);
 
+/**
+ * @brief The bucket method used by pippenger for large MSMs. WNAF sorts the points by bucket and adds them with the
+ * affine addition chains above, SIGNED_DIGIT is `pippenger_signed_digit`. The default is WNAF, unless the environment
+ * variable BB_PIPPENGER_ALGORITHM is set to "signed_digit".
+ */
+enum class PippengerAlgorithm { WNAF, SIGNED_DIGIT };
+
+PippengerAlgorithm get_pippenger_algorithm();
+void set_pippenger_algorithm(PippengerAlgorithm algorithm);
+
+// The signed digits are stored as int16_t, which limits the window size
+constexpr size_t MAX_SIGNED_DIGIT_BITS = 16;
+
+size_t get_signed_digit_window_bits(size_t num_points, size_t num_threads, size_t scalar_bits = 128);
+size_t get_num_signed_digit_windows(size_t digit_bits, size_t scalar_bits = 128);
+void compute_signed_digits(
+    const uint64_t* scalar, size_t digit_bits, size_t num_windows, int16_t* digits, size_t stride);
+
+template <typename Curve>
+typename Curve::Element pippenger_signed_digit(std::span<const typename Curve::ScalarField> scalars,
+                                               std::span<const typename Curve::AffineElement> points);
+
+// MSMs below this size are evaluated on a single thread when batched, larger ones use the multi-threaded pippenger
+constexpr size_t BATCH_MSM_PARALLEL_THRESHOLD = 1UL << 14;
+
+template <typename Curve>
+typename Curve::Element pippenger_single_threaded(std::span<const typename Curve::ScalarField> scalars,
+                                                  std::span<const typename Curve::AffineElement> points);
+
+template <typename Curve>
+std::vector<typename Curve::AffineElement> pippenger_batch_unsafe(
+    std::span<const std::span<const typename Curve::ScalarField>> scalars,
+    std::span<const std::span<const typename Curve::AffineElement>> points,
+    pippenger_runtime_state<Curve>& state);
+
+template <typename Curve>
+typename Curve::Element pippenger_classified_unsafe(std::span<const typename Curve::ScalarField> scalars,
+                                                    std::span<const typename Curve::AffineElement> points,
+                                                    pippenger_runtime_state<Curve>& state);
+
 // Explicit instantiation
 // BN254
 
@@ -1,4 +1,6 @@
 #include "barretenberg/ecc/scalar_multiplication/sorted_msm.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include <algorithm>
 #include <execution>
 
@@ -117,8 +119,7 @@ void MsmSorter<Curve>::batch_compute_point_addition_slope_inverses(AdditionSeque
     std::vector<Fq> differences;
     differences.resize(total_num_pairs);
 
-    // Compute and store successive products of differences (x_2 - x_1)
-    Fq accumulator = 1;
+    // Compute and store the differences (x_2 - x_1)
     size_t point_idx = 0;
     size_t pair_idx = 0;
     for (auto& count : sequence_counts) {
@@ -130,26 +131,23 @@ void MsmSorter<Curve>::batch_compute_point_addition_slope_inverses(AdditionSeque
             // It is assumed that the input points are random and thus w/h/p do not share an x-coordinate
             ASSERT(x1 != x2);
 
-            auto diff = x2 - x1;
-            differences[pair_idx] = diff;
-
-            // Store and update the running product of differences at each stage
-            scratch_space[pair_idx++] = accumulator;
-            accumulator *= diff;
+            differences[pair_idx++] = x2 - x1;
         }
         // If number of points in the sequence is odd, we skip the last one since it has no pair
         point_idx += (count & 0x01ULL);
     }
 
-    // Invert the full product of differences
-    Fq inverse = accumulator.invert();
-
-    // Compute the individual point-pair addition denominators 1/(x2 - x1)
-    for (size_t i = 0; i < total_num_pairs; ++i) {
-        size_t idx = total_num_pairs - 1 - i;
-        scratch_space[idx] *= inverse;
-        inverse *= differences[idx];
-    }
+    // Compute the individual point-pair addition denominators 1/(x2 - x1), one batch inversion per thread
+    parallel_for_heuristic(
+        total_num_pairs,
+        [&](size_t start, size_t end, BB_UNUSED size_t chunk_index) {
+            group_elements::BatchAffine<G1>::batch_invert_apply(
+                end - start,
+                scratch_space.data() + start,
+                [&](size_t i) { return differences[start + i]; },
+                [&](size_t i, const Fq& inverse) { scratch_space[start + i] = inverse; });
+        },
+        thread_heuristics::FF_MULTIPLICATION_COST * 3);
 }
 
 /**
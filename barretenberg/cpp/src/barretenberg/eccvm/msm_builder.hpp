@@ -3,6 +3,7 @@
 #include <cstddef>
 
 #include "./eccvm_builder_types.hpp"
+#include "barretenberg/ecc/groups/batch_affine.hpp"
 #include "barretenberg/stdlib_circuit_builders/op_queue/ecc_op_queue.hpp"
 
 namespace bb {
@@ -341,9 +342,8 @@ class ECCVMMSMMBuilder {
         }
 
         // Normalize the points in the point trace
-        parallel_for_range(points_to_normalize.size(), [&](size_t start, size_t end) {
-            Element::batch_normalize(&points_to_normalize[start], end - start);
-        });
+        group_elements::BatchAffine<AffineElement> batch_affine(points_to_normalize.size());
+        batch_affine.normalize(std::span{ points_to_normalize });
 
         // inverse_trace is used to compute the value of the `collision_inverse` column in the ECCVM.
         std::vector<FF> inverse_trace(num_point_adds_and_doubles);
@@ -123,6 +123,9 @@ template <typename FF, typename CommitmentKey_> class ProvingKey_ {
     // folded element by element.
     std::vector<FF> public_inputs;
 
+    // For a structured trace, the [start, end) rows of each block that hold gates. The wires are zero elsewhere.
+    std::vector<std::pair<size_t, size_t>> active_block_ranges;
+
     ProvingKey_() = default;
     ProvingKey_(const size_t circuit_size,
                 const size_t num_public_inputs,
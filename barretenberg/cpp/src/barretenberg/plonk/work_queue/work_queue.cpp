@@ -211,7 +211,7 @@ void work_queue::process_queue()
 
             ASSERT(msm_size <= key->reference_string->get_monomial_size());
 
-            std::span<bb::g1::affine_element> srs_points = key->reference_string->get_monomial_points();
+            std::span<const bb::g1::affine_element> srs_points = key->reference_string->get_monomial_points();
 
             // Run pippenger multi-scalar multiplication.
             auto runtime_state = bb::scalar_multiplication::pippenger_runtime_state<curve::BN254>(msm_size);
@@ -687,6 +687,66 @@ template <class Fr, size_t domain_end, size_t domain_start = 0, size_t skip_coun
     }
 };
 
+/**
+ * @brief Extend a batch of univariates on {0, ..., LENGTH - 1}, stored as a structure of arrays, to univariates on {0,
+ * ..., EXTENDED_LENGTH - 1}
+ *
+ * @details values[j][i] is the value of the i-th univariate at j. This is the layout in which sumcheck reads the edges
+ * of all columns of the prover polynomials at once, see SumcheckProverRound::extend_edges. Linear univariates are
+ * extended by adding their slopes, without any multiplications, and longer ones as in Univariate::extend_to. Extending
+ * one univariate at a time gives a chain of dependent additions, whereas here the inner loops run over the batch, so
+ * consecutive operations are independent, and no temporary univariates are created.
+ *
+ * @param results results[i] is set to the extension of the i-th univariate, e.g. the get_all() of a container of
+ * Univariate<Fr, EXTENDED_LENGTH>
+ */
+template <size_t EXTENDED_LENGTH, typename Fr, size_t LENGTH, size_t BATCH_SIZE, typename Results>
+void extend_batch(const std::array<std::array<Fr, BATCH_SIZE>, LENGTH>& values, Results&& results)
+{
+    static_assert(LENGTH >= 2 && EXTENDED_LENGTH >= LENGTH);
+    for (size_t j = 0; j < LENGTH; j++) {
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            results[i].evaluations[j] = values[j][i];
+        }
+    }
+    if constexpr (LENGTH == 2) {
+        std::array<Fr, BATCH_SIZE> slopes;
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            slopes[i] = values[1][i] - values[0][i];
+        }
+        for (size_t k = LENGTH; k < EXTENDED_LENGTH; k++) {
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                results[i].evaluations[k] = results[i].evaluations[k - 1] + slopes[i];
+            }
+        }
+    } else if constexpr (LENGTH <= 4) {
+        // The closed forms used by extend_to for short univariates need fewer multiplications than the barycentric
+        // formula
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            Univariate<Fr, LENGTH> univariate;
+            for (size_t j = 0; j < LENGTH; j++) {
+                univariate.evaluations[j] = values[j][i];
+            }
+            results[i] = univariate.template extend_to<EXTENDED_LENGTH>();
+        }
+    } else {
+        using Data = BarycentricData<Fr, LENGTH, EXTENDED_LENGTH>;
+        std::array<Fr, BATCH_SIZE> sums;
+        for (size_t k = LENGTH; k < EXTENDED_LENGTH; k++) {
+            sums.fill(Fr(0));
+            for (size_t j = 0; j < LENGTH; j++) {
+                const Fr& weight = Data::precomputed_denominator_inverses[LENGTH * k + j];
+                for (size_t i = 0; i < BATCH_SIZE; i++) {
+                    sums[i] += values[j][i] * weight;
+                }
+            }
+            for (size_t i = 0; i < BATCH_SIZE; i++) {
+                results[i].evaluations[k] = sums[i] * Data::full_numerator_values[k];
+            }
+        }
+    }
+}
+
 /**
  * @brief Create a sub-array of `elements` at the indices given in the template pack `Is`, converting them
  * to the new type T.
@@ -150,3 +150,31 @@ TYPED_TEST(UnivariateTest, EvaluationCustomDomain)
         EXPECT_EQ(poly.evaluate(fr(2)), fr(294330751));
     }();
 }
+
+TYPED_TEST(UnivariateTest, ExtendBatchMatchesExtendTo)
+{
+    // cover the linear, closed-form and barycentric extensions
+    auto check = []<size_t LENGTH>() {
+        constexpr size_t BATCH_SIZE = 5;
+        constexpr size_t EXTENDED_LENGTH = 9;
+        std::array<std::array<fr, BATCH_SIZE>, LENGTH> values;
+        for (auto& row : values) {
+            for (auto& value : row) {
+                value = fr::random_element();
+            }
+        }
+        std::array<Univariate<fr, EXTENDED_LENGTH>, BATCH_SIZE> results;
+        extend_batch<EXTENDED_LENGTH>(values, results);
+
+        for (size_t i = 0; i < BATCH_SIZE; i++) {
+            Univariate<fr, LENGTH> univariate;
+            for (size_t j = 0; j < LENGTH; j++) {
+                univariate.evaluations[j] = values[j][i];
+            }
+            EXPECT_EQ(results[i], univariate.template extend_to<EXTENDED_LENGTH>());
+        }
+    };
+    check.template operator()<2>();
+    check.template operator()<3>();
+    check.template operator()<6>();
+}
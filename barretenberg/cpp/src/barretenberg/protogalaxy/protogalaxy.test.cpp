@@ -226,6 +226,51 @@ template <typename Flavor> class ProtogalaxyTests : public testing::Test {
         EXPECT_EQ(perturbator[0], target_sum);
     }
 
+    /**
+     * @brief Check that the perturbator computed chunk by chunk from the rows is the same as the one computed from the
+     * evaluations of all rows.
+     *
+     */
+    static void test_streamed_perturbator()
+    {
+        using RelationSeparator = typename Flavor::RelationSeparator;
+        // large enough to be split into several chunks
+        const size_t log_size(10);
+        const size_t size(1 << log_size);
+        ProverPolynomials full_polynomials;
+        for (auto& poly : full_polynomials.get_all()) {
+            poly = bb::Polynomial<FF>::random(size);
+        }
+
+        auto relation_parameters = bb::RelationParameters<FF>::get_random();
+        RelationSeparator alphas;
+        for (auto& alpha : alphas) {
+            alpha = FF::random_element();
+        }
+        std::vector<FF> betas(CONST_PG_LOG_N);
+        for (auto& beta : betas) {
+            beta = FF::random_element();
+        }
+        auto deltas = compute_round_challenge_pows(CONST_PG_LOG_N, FF::random_element());
+
+        auto full_honk_evals = Fun::compute_row_evaluations(full_polynomials, alphas, relation_parameters);
+        auto expected_perturbator = Fun::construct_perturbator_coefficients(
+            std::span{ betas.data(), log_size }, std::span{ deltas.data(), log_size }, full_honk_evals);
+
+        auto accumulator = std::make_shared<DeciderProvingKey>();
+        accumulator->proving_key.polynomials = std::move(full_polynomials);
+        accumulator->proving_key.log_circuit_size = log_size;
+        accumulator->gate_challenges = betas;
+        accumulator->relation_parameters = relation_parameters;
+        accumulator->alphas = alphas;
+        auto perturbator = Fun::compute_perturbator(accumulator, deltas);
+
+        EXPECT_EQ(perturbator.size(), CONST_PG_LOG_N + 1);
+        for (size_t i = 0; i < perturbator.size(); i++) {
+            EXPECT_EQ(perturbator[i], i < expected_perturbator.size() ? expected_perturbator[i] : FF(0));
+        }
+    }
+
     /**
      * @brief Manually compute the expected evaluations of the combiner quotient, given evaluations of the combiner
      * and check them against the evaluations returned by the function.
@@ -580,6 +625,11 @@ TYPED_TEST(ProtogalaxyTests, PerturbatorPolynomial)
     TestFixture::test_pertubator_polynomial();
 }
 
+TYPED_TEST(ProtogalaxyTests, StreamedPerturbator)
+{
+    TestFixture::test_streamed_perturbator();
+}
+
 TYPED_TEST(ProtogalaxyTests, CombinerQuotient)
 {
     TestFixture::test_combiner_quotient();
@@ -126,6 +126,8 @@ FoldingResult<typename DeciderProvingKeys::Flavor> ProtogalaxyProver_<DeciderPro
 
     FoldingResult<Flavor> result{ .accumulator = keys[0], .proof = std::move(transcript->proof_data) };
     result.accumulator->is_accumulator = true;
+    // The folded wires are nonzero wherever those of any of the keys are, not just in the blocks of the first key
+    result.accumulator->proving_key.active_block_ranges.clear();
 
     // Compute the next target sum (for its own use; verifier must compute its own values)
     auto [vanishing_polynomial_at_challenge, lagranges] =
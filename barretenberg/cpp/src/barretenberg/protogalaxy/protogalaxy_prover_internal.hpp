@@ -4,6 +4,7 @@
 #include "barretenberg/common/thread.hpp"
 #include "barretenberg/protogalaxy/prover_verifier_shared.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/relation_profiler.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/ultra_honk/oink_prover.hpp"
@@ -55,6 +56,9 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
 
     static constexpr size_t NUM_SUBRELATIONS = DeciderPKs::NUM_SUBRELATIONS;
 
+    // The rows of a chunk in compute_perturbator are evaluated into a buffer of at most 2^MAX_LOG_CHUNK_SIZE elements
+    static constexpr size_t MAX_LOG_CHUNK_SIZE = 12;
+
     /**
      * @brief A scale subrelations evaluations by challenges ('alphas') and part of the linearly dependent relation
      * evaluation(s).
@@ -92,6 +96,18 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return linearly_independent_contribution;
     }
 
+    /**
+     * @brief The challenges by which the subrelation evaluations are scaled: 1 for the first subrelation and the alphas
+     * for the others
+     */
+    static std::array<FF, NUM_SUBRELATIONS> get_subrelation_challenges(const RelationSeparator& alphas)
+    {
+        std::array<FF, NUM_SUBRELATIONS> challenges;
+        challenges[0] = 1;
+        std::copy(alphas.begin(), alphas.end(), challenges.begin() + 1);
+        return challenges;
+    }
+
     /**
      * @brief Compute the values of the aggregated relation evaluations at each row in the execution trace, representing
      * f_i(ω) in the Protogalaxy paper, given the evaluations of all the prover polynomials and \vec{α} (the batching
@@ -103,6 +119,9 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
      * over each row. At the end of the function, the linearly dependent contribution is accumulated at index 0
      * representing the sum f_0(ω) + α_j*g(ω) where f_0 represents the full honk evaluation at row 0, g(ω) is the
      * linearly dependent subrelation and α_j is its corresponding batching challenge.
+     *
+     * The prover does not call this: \ref compute_perturbator "compute_perturbator" streams the row evaluations into
+     * the perturbator instead of storing them.
      */
     static std::vector<FF> compute_row_evaluations(const ProverPolynomials& polynomials,
                                                    const RelationSeparator& alphas_,
@@ -115,12 +134,7 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         const size_t polynomial_size = polynomials.get_polynomial_size();
         std::vector<FF> aggregated_relation_evaluations(polynomial_size);
 
-        const std::array<FF, NUM_SUBRELATIONS> alphas = [&alphas_]() {
-            std::array<FF, NUM_SUBRELATIONS> tmp;
-            tmp[0] = 1;
-            std::copy(alphas_.begin(), alphas_.end(), tmp.begin() + 1);
-            return tmp;
-        }();
+        const std::array<FF, NUM_SUBRELATIONS> alphas = get_subrelation_challenges(alphas_);
 
         const std::vector<FF> linearly_dependent_contribution_accumulators = parallel_for_heuristic(
             polynomial_size,
@@ -199,23 +213,95 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
         return construct_coefficients_tree(betas, deltas, first_level_coeffs);
     }
 
+    /**
+     * @brief Serial version of \ref construct_perturbator_coefficients "construct_perturbator_coefficients", for the
+     * subtree of a chunk of rows. Returns the coefficients of its root, a polynomial of degree betas.size().
+     *
+     * @details The nodes of a level are stored contiguously in a single buffer: level l has leaves.size() / 2^l nodes
+     * of l + 1 coefficients each, which fits in leaves.size() elements, so two buffers suffice for the whole subtree.
+     */
+    static std::vector<FF> construct_subtree_coefficients(std::span<const FF> betas,
+                                                          std::span<const FF> deltas,
+                                                          std::span<const FF> leaves)
+    {
+        ASSERT(leaves.size() == (size_t(1) << betas.size()));
+        std::vector<FF> level_coeffs(leaves.begin(), leaves.end());
+        std::vector<FF> parent_coeffs(leaves.size());
+        for (size_t level = 0; level < betas.size(); level++) {
+            // the children have `degree` coefficients and their parents degree + 1
+            const size_t degree = level + 1;
+            const size_t num_parents = leaves.size() >> degree;
+            for (size_t parent = 0; parent < num_parents; parent++) {
+                const size_t left = 2 * parent * degree;
+                const size_t right = left + degree;
+                const size_t node = parent * (degree + 1);
+                std::copy_n(level_coeffs.begin() + static_cast<std::ptrdiff_t>(left),
+                            degree,
+                            parent_coeffs.begin() + static_cast<std::ptrdiff_t>(node));
+                parent_coeffs[node + degree] = 0;
+                for (size_t d = 0; d < degree; d++) {
+                    parent_coeffs[node + d] += level_coeffs[right + d] * betas[level];
+                    parent_coeffs[node + d + 1] += level_coeffs[right + d] * deltas[level];
+                }
+            }
+            std::swap(level_coeffs, parent_coeffs);
+        }
+        level_coeffs.resize(betas.size() + 1);
+        return level_coeffs;
+    }
+
     /**
      * @brief Construct the power perturbator polynomial F(X) in coefficient form from the accumulator
+     *
+     * @details Rather than storing the relation evaluations of all rows (see \ref compute_row_evaluations
+     * "compute_row_evaluations") and then building the tree of \ref construct_perturbator_coefficients
+     * "construct_perturbator_coefficients" over them, the rows are split into chunks of 2^log_chunk_size consecutive
+     * rows, each of which is a subtree. A thread evaluates the rows of a chunk into a small buffer, which stays in
+     * cache, and folds them into the root of the subtree right away. Only the roots of the chunks are kept, and the
+     * tree is completed from them. The linearly dependent contribution belongs to the leaf of row 0, whose weight in
+     * F(X) is 1, so it is added to the constant coefficient at the end.
      */
     static Polynomial<FF> compute_perturbator(const std::shared_ptr<const DeciderPK>& accumulator,
                                               const std::vector<FF>& deltas)
     {
         BB_OP_COUNT_TIME();
-        auto full_honk_evaluations = compute_row_evaluations(
-            accumulator->proving_key.polynomials, accumulator->alphas, accumulator->relation_parameters);
+        const ProverPolynomials& polynomials = accumulator->proving_key.polynomials;
+        const std::array<FF, NUM_SUBRELATIONS> alphas = get_subrelation_challenges(accumulator->alphas);
         const auto betas = accumulator->gate_challenges;
         ASSERT(betas.size() == deltas.size());
         const size_t log_circuit_size = accumulator->proving_key.log_circuit_size;
+        ASSERT(log_circuit_size > 0);
+
+        // Use a few chunks per thread for load balancing
+        const size_t log_min_num_chunks = numeric::get_msb(get_num_cpus_pow2()) + 2;
+        size_t log_chunk_size = log_circuit_size > log_min_num_chunks ? log_circuit_size - log_min_num_chunks : 1;
+        log_chunk_size = std::min({ log_chunk_size, MAX_LOG_CHUNK_SIZE, log_circuit_size });
+        const size_t chunk_size = size_t(1) << log_chunk_size;
+        const size_t num_chunks = size_t(1) << (log_circuit_size - log_chunk_size);
+
+        // Only the first log_circuit_size-many betas/deltas are used
+        const std::span<const FF> betas_span{ betas.data(), log_circuit_size };
+        const std::span<const FF> deltas_span{ deltas.data(), log_circuit_size };
+
+        std::vector<std::vector<FF>> chunk_coeffs(num_chunks);
+        std::vector<FF> linearly_dependent_contributions(num_chunks, FF(0));
+        parallel_for(num_chunks, [&](size_t chunk_idx) {
+            std::vector<FF> row_evaluations(chunk_size);
+            for (size_t i = 0; i < chunk_size; i++) {
+                const AllValues row = polynomials.get_row(chunk_idx * chunk_size + i);
+                // Evaluate all subrelations on the given row. Separator is 1 since we are not summing across rows here.
+                const RelationEvaluations evals =
+                    RelationUtils::accumulate_relation_evaluations(row, accumulator->relation_parameters, FF(1));
+                row_evaluations[i] =
+                    process_subrelation_evaluations(evals, alphas, linearly_dependent_contributions[chunk_idx]);
+            }
+            chunk_coeffs[chunk_idx] = construct_subtree_coefficients(
+                betas_span.first(log_chunk_size), deltas_span.first(log_chunk_size), row_evaluations);
+        });
 
-        // Compute the perturbator using only the first log_circuit_size-many betas/deltas
-        std::vector<FF> perturbator = construct_perturbator_coefficients(std::span{ betas.data(), log_circuit_size },
-                                                                         std::span{ deltas.data(), log_circuit_size },
-                                                                         full_honk_evaluations);
+        std::vector<FF> perturbator =
+            construct_coefficients_tree(betas_span, deltas_span, chunk_coeffs, log_chunk_size);
+        perturbator[0] += sum(linearly_dependent_contributions);
 
         // Populate the remaining coefficients with zeros to reach the required constant size
         for (size_t idx = log_circuit_size; idx < CONST_PG_LOG_N; ++idx) {
@@ -271,20 +357,25 @@ template <class DeciderProvingKeys_> class ProtogalaxyProverInternal {
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
 
-        //  Check if the relation is skippable to speed up accumulation
-        if constexpr (!isSkippable<Relation, decltype(extended_univariates)>) {
-            // If not, accumulate normally
-            Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
-                                 extended_univariates,
-                                 relation_parameters,
-                                 scaling_factor);
-        } else {
-            // If so, only compute the contribution if the relation is active
-            if (!Relation::skip(extended_univariates)) {
+        {
+            BB_PROFILE_RELATION("protogalaxy", Relation);
+            //  Check if the relation is skippable to speed up accumulation
+            if constexpr (!isSkippable<Relation, decltype(extended_univariates)>) {
+                // If not, accumulate normally
                 Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
                                      extended_univariates,
                                      relation_parameters,
                                      scaling_factor);
+            } else {
+                // If so, only compute the contribution if the relation is active
+                if (!Relation::skip(extended_univariates)) {
+                    Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                         extended_univariates,
+                                         relation_parameters,
+                                         scaling_factor);
+                } else {
+                    BB_PROFILE_RELATION_SKIPPED();
+                }
             }
         }
 
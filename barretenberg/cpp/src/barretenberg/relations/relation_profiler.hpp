@@ -0,0 +1,327 @@
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cxxabi.h>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <typeinfo>
+#include <vector>
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+#include <x86intrin.h>
+#endif
+
+namespace bb {
+
+/**
+ * @brief Per-relation and per-subrelation cycle counters for the relation evaluation loops of the provers
+ *
+ * @details Compiled in with -DBB_PROFILE_RELATIONS (see the relation-profile preset), and free otherwise. The sumcheck
+ * and Protogalaxy provers wrap the evaluation of each relation on each edge in BB_PROFILE_RELATION, which counts the
+ * calls, the calls skipped through Relation::skip, and the cycles spent (read from the TSC on x86, nanoseconds
+ * elsewhere). Subrelations are computed together in Relation::accumulate, with shared intermediate values, so their
+ * cost can only be measured by the relations themselves: a relation wraps the code of a subrelation in
+ * BB_PROFILE_SUBRELATION(idx) to get its own counter. The cycles of the shared code are only counted for the relation.
+ *
+ * Each thread writes to its own counters. The counters of all threads are summed by to_json, which, like reset, must
+ * not be called while a prover is running.
+ */
+class RelationProfiler {
+  public:
+#ifdef BB_PROFILE_RELATIONS
+    static constexpr bool ENABLED = true;
+#else
+    static constexpr bool ENABLED = false;
+#endif
+
+    struct Counter {
+        uint64_t calls = 0;
+        uint64_t skipped = 0;
+        uint64_t cycles = 0;
+    };
+
+    // Compile-time string, to key the counters of a relation by the loop that evaluates it
+    template <size_t N> struct Label {
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        constexpr Label(const char (&str)[N])
+        {
+            for (size_t i = 0; i < N; ++i) {
+                value[i] = str[i];
+            }
+        }
+        // NOLINTNEXTLINE(cppcoreguidelines-avoid-c-arrays)
+        char value[N];
+    };
+
+    static constexpr size_t NO_RELATION = static_cast<size_t>(-1);
+
+    static uint64_t read_cycle_counter()
+    {
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386) || defined(_M_IX86)
+        return __rdtsc();
+#else
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                         std::chrono::steady_clock::now().time_since_epoch())
+                                         .count());
+#endif
+    }
+
+    /**
+     * @brief The index of the counter of a relation evaluated in a given context. The counters of its subrelations
+     * follow it
+     */
+    template <Label Context, typename Relation> static size_t get_counter_index()
+    {
+        static const size_t index = register_relation(
+            Context.value, get_relation_name<Relation>(), Relation::SUBRELATION_PARTIAL_LENGTHS.size());
+        return index;
+    }
+
+    /**
+     * @brief The index of the counter of a subrelation of the relation being profiled on this thread, or NO_RELATION
+     */
+    static size_t get_subrelation_counter_index(const size_t subrelation_idx)
+    {
+        const size_t relation_index = current_relation();
+        return relation_index == NO_RELATION ? NO_RELATION : relation_index + 1 + subrelation_idx;
+    }
+
+    /**
+     * @brief Count the cycles from construction to destruction, and a call, in a counter of the current thread
+     */
+    class Scope {
+      public:
+        Scope(const size_t counter_index, const bool is_relation = false)
+            : counter_index(counter_index)
+            , previous_relation(current_relation())
+            , is_relation(is_relation)
+            , start(read_cycle_counter())
+        {
+            if (is_relation) {
+                current_relation() = counter_index;
+            }
+        }
+        Scope(const Scope&) = delete;
+        Scope(Scope&&) = delete;
+        Scope& operator=(const Scope&) = delete;
+        Scope& operator=(Scope&&) = delete;
+        ~Scope()
+        {
+            const uint64_t end = read_cycle_counter();
+            if (counter_index != NO_RELATION) {
+                Counter& counter = get_thread_counter(counter_index);
+                counter.calls++;
+                counter.cycles += end - start;
+            }
+            if (is_relation) {
+                current_relation() = previous_relation;
+            }
+        }
+
+      private:
+        size_t counter_index;
+        size_t previous_relation;
+        bool is_relation;
+        uint64_t start;
+    };
+
+    /**
+     * @brief Record that the relation being profiled on this thread was skipped
+     */
+    static void count_skip()
+    {
+        if (current_relation() != NO_RELATION) {
+            get_thread_counter(current_relation()).skipped++;
+        }
+    }
+
+    /**
+     * @brief Zero the counters of all threads
+     */
+    static void reset()
+    {
+        Registry& registry = get_registry();
+        std::unique_lock<std::mutex> lock(registry.mutex);
+        for (auto& counters : registry.thread_counters) {
+            for (auto& counter : *counters) {
+                counter = Counter();
+            }
+        }
+    }
+
+    /**
+     * @brief The counters summed over threads, as
+     * { context: { relation: { calls, skipped, cycles, subrelations: [ { calls, cycles }, ... ] } } }. Relations that
+     * were never evaluated are left out, and so are the subrelations of a relation that does not profile them.
+     */
+    static std::string to_json()
+    {
+        Registry& registry = get_registry();
+        std::unique_lock<std::mutex> lock(registry.mutex);
+        std::vector<Counter> totals(registry.num_counters);
+        for (const auto& counters : registry.thread_counters) {
+            for (size_t i = 0; i < counters->size(); i++) {
+                add_counter(totals[i], (*counters)[i]);
+            }
+        }
+
+        // Relations of different Flavors may share a name, e.g. the ones instantiated on different fields
+        std::map<std::string, std::map<std::string, std::vector<Counter>>> totals_by_name;
+        for (const auto& entry : registry.entries) {
+            if (totals[entry.counter_index].calls == 0) {
+                continue;
+            }
+            auto& relation_totals = totals_by_name[entry.context][entry.relation];
+            relation_totals.resize(std::max(relation_totals.size(), 1 + entry.num_subrelations));
+            for (size_t i = 0; i < 1 + entry.num_subrelations; i++) {
+                add_counter(relation_totals[i], totals[entry.counter_index + i]);
+            }
+        }
+
+        std::stringstream json;
+        std::string context_separator;
+        json << "{";
+        for (const auto& [context, relations] : totals_by_name) {
+            json << context_separator << "\"" << context << "\":{";
+            context_separator = ",";
+            std::string relation_separator;
+            for (const auto& [relation, relation_totals] : relations) {
+                json << relation_separator << "\"" << relation << "\":{\"calls\":" << relation_totals[0].calls
+                     << ",\"skipped\":" << relation_totals[0].skipped << ",\"cycles\":" << relation_totals[0].cycles;
+                relation_separator = ",";
+                const bool has_subrelations = std::any_of(relation_totals.begin() + 1,
+                                                          relation_totals.end(),
+                                                          [](const Counter& counter) { return counter.calls > 0; });
+                if (has_subrelations) {
+                    json << ",\"subrelations\":[";
+                    for (size_t i = 1; i < relation_totals.size(); i++) {
+                        json << (i == 1 ? "" : ",") << "{\"calls\":" << relation_totals[i].calls
+                             << ",\"cycles\":" << relation_totals[i].cycles << "}";
+                    }
+                    json << "]";
+                }
+                json << "}";
+            }
+            json << "}";
+        }
+        json << "}";
+        return json.str();
+    }
+
+    /**
+     * @brief A readable name for a relation: its NAME if it has one (as the AVM relations do), or the name of the
+     * class otherwise, e.g. DeltaRangeConstraintRelation for Relation<DeltaRangeConstraintRelationImpl<fr>>
+     */
+    template <typename Relation> static std::string get_relation_name()
+    {
+        if constexpr (requires { Relation::NAME; }) {
+            return std::string(Relation::NAME);
+        } else {
+            int status = 0;
+            char* demangled = abi::__cxa_demangle(typeid(Relation).name(), nullptr, nullptr, &status);
+            std::string name = status == 0 ? std::string(demangled) : std::string(typeid(Relation).name());
+            // NOLINTNEXTLINE(cppcoreguidelines-no-malloc)
+            std::free(demangled);
+
+            // Unwrap Relation<...> and drop the namespace, template arguments and Impl suffix
+            const std::string wrapper = "Relation<";
+            if (name.starts_with("bb::" + wrapper)) {
+                name = name.substr(wrapper.size() + 4);
+            }
+            name = name.substr(0, name.find('<'));
+            name = name.substr(name.rfind(':') == std::string::npos ? 0 : name.rfind(':') + 1);
+            if (name.ends_with("Impl")) {
+                name = name.substr(0, name.size() - 4);
+            }
+            return name;
+        }
+    }
+
+  private:
+    struct Entry {
+        std::string context;
+        std::string relation;
+        size_t num_subrelations;
+        size_t counter_index;
+    };
+
+    struct Registry {
+        std::mutex mutex;
+        std::vector<Entry> entries;
+        size_t num_counters = 0;
+        std::vector<std::shared_ptr<std::vector<Counter>>> thread_counters;
+    };
+
+    static void add_counter(Counter& total, const Counter& counter)
+    {
+        total.calls += counter.calls;
+        total.skipped += counter.skipped;
+        total.cycles += counter.cycles;
+    }
+
+    static Registry& get_registry()
+    {
+        static Registry registry;
+        return registry;
+    }
+
+    static size_t register_relation(const char* context, const std::string& relation, const size_t num_subrelations)
+    {
+        Registry& registry = get_registry();
+        std::unique_lock<std::mutex> lock(registry.mutex);
+        const size_t counter_index = registry.num_counters;
+        registry.entries.push_back({ context, relation, num_subrelations, counter_index });
+        registry.num_counters += 1 + num_subrelations;
+        return counter_index;
+    }
+
+    static size_t& current_relation()
+    {
+        thread_local size_t relation_index = NO_RELATION;
+        return relation_index;
+    }
+
+    static Counter& get_thread_counter(const size_t counter_index)
+    {
+        thread_local std::shared_ptr<std::vector<Counter>> counters;
+        if (counters == nullptr || counter_index >= counters->size()) {
+            Registry& registry = get_registry();
+            std::unique_lock<std::mutex> lock(registry.mutex);
+            if (counters == nullptr) {
+                counters = std::make_shared<std::vector<Counter>>();
+                registry.thread_counters.push_back(counters);
+            }
+            counters->resize(registry.num_counters);
+        }
+        return (*counters)[counter_index];
+    }
+};
+
+} // namespace bb
+
+#ifdef BB_PROFILE_RELATIONS
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_RELATION(context, Relation)                                                                         \
+    bb::RelationProfiler::Scope bb_relation_profile_scope(                                                             \
+        bb::RelationProfiler::get_counter_index<context, Relation>(), true)
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_RELATION_SKIPPED() bb::RelationProfiler::count_skip()
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_SUBRELATION(subrelation_idx)                                                                        \
+    bb::RelationProfiler::Scope bb_subrelation_profile_scope(                                                          \
+        bb::RelationProfiler::get_subrelation_counter_index(subrelation_idx))
+#else
+// require a semicolon to appease formatters
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_RELATION(context, Relation) (void)0
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_RELATION_SKIPPED() (void)0
+// NOLINTNEXTLINE(cppcoreguidelines-macro-usage)
+#define BB_PROFILE_SUBRELATION(subrelation_idx) (void)0
+#endif
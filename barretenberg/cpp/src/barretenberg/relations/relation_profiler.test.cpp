@@ -0,0 +1,43 @@
+#include "relation_profiler.hpp"
+#include "barretenberg/common/thread.hpp"
+#include "barretenberg/ecc/curves/bn254/fr.hpp"
+#include "barretenberg/relations/delta_range_constraint_relation.hpp"
+#include "barretenberg/relations/ultra_arithmetic_relation.hpp"
+#include <gtest/gtest.h>
+
+using namespace bb;
+
+TEST(RelationProfiler, RelationNames)
+{
+    EXPECT_EQ(RelationProfiler::get_relation_name<DeltaRangeConstraintRelation<fr>>(), "DeltaRangeConstraintRelation");
+    EXPECT_EQ(RelationProfiler::get_relation_name<UltraArithmeticRelation<fr>>(), "UltraArithmeticRelation");
+}
+
+TEST(RelationProfiler, CountersAreSummedOverThreads)
+{
+    using Relation = DeltaRangeConstraintRelation<fr>;
+    RelationProfiler::reset();
+
+    // Profile one call, one skipped call and one subrelation on each thread
+    const size_t num_threads = 4;
+    parallel_for(num_threads, [&](BB_UNUSED size_t thread_idx) {
+        {
+            RelationProfiler::Scope relation_scope(RelationProfiler::get_counter_index<"test", Relation>(), true);
+            RelationProfiler::Scope subrelation_scope(RelationProfiler::get_subrelation_counter_index(2));
+        }
+        {
+            RelationProfiler::Scope relation_scope(RelationProfiler::get_counter_index<"test", Relation>(), true);
+            RelationProfiler::count_skip();
+        }
+    });
+    // Subrelations are ignored outside of a relation
+    { RelationProfiler::Scope subrelation_scope(RelationProfiler::get_subrelation_counter_index(0)); }
+
+    const std::string json = RelationProfiler::to_json();
+    EXPECT_NE(json.find("\"test\":{\"DeltaRangeConstraintRelation\":{\"calls\":8,\"skipped\":4,"), std::string::npos);
+    EXPECT_NE(json.find("\"subrelations\":[{\"calls\":0,\"cycles\":0},{\"calls\":0,\"cycles\":0},{\"calls\":4,"),
+              std::string::npos);
+
+    RelationProfiler::reset();
+    EXPECT_EQ(RelationProfiler::to_json().find("\"test\""), std::string::npos);
+}
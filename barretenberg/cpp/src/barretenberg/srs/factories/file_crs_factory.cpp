@@ -6,6 +6,7 @@
 #include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
+#include "mapped_prover_crs.hpp"
 
 namespace bb::srs::factories {
 
@@ -57,9 +58,21 @@ template <typename Curve>
 std::shared_ptr<bb::srs::factories::ProverCrs<Curve>> FileCrsFactory<Curve>::get_prover_crs(size_t degree)
 {
     if (prover_degree_ < degree || !prover_crs_) {
-        prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+        // Prefer a precomputed point table, which saves reading the transcript and computing the table
+        if (auto mapped_crs = MappedProverCrs<Curve>::map(path_ + "/" + get_point_table_filename<Curve>(), degree)) {
+            prover_crs_ = mapped_crs;
+            prover_degree_ = mapped_crs->get_monomial_size();
+            return prover_crs_;
+        }
+        if (prover_crs_) {
+            // Only read the points that the current CRS lacks
+            prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_, *prover_crs_);
+            vinfo("Extending ", Curve::name, " prover CRS from file to size ", degree);
+        } else {
+            prover_crs_ = std::make_shared<FileProverCrs<Curve>>(degree, path_);
+            vinfo("Initializing ", Curve::name, " prover CRS from file of size ", degree);
+        }
         prover_degree_ = degree;
-        vinfo("Initializing ", Curve::name, " prover CRS from file of size ", degree);
     }
     return prover_crs_;
 }
@@ -5,6 +5,7 @@
 #include "barretenberg/ecc/scalar_multiplication/point_table.hpp"
 #include "barretenberg/ecc/scalar_multiplication/scalar_multiplication.hpp"
 #include "crs_factory.hpp"
+#include <algorithm>
 #include <cstddef>
 #include <utility>
 
@@ -12,6 +13,9 @@ namespace bb::srs::factories {
 
 /**
  * Create reference strings given a path to a directory of transcript files.
+ *
+ * If the directory also holds a point table file (see write_point_table) with enough points, the prover CRS maps it
+ * instead of reading the transcript.
  */
 template <typename Curve> class FileCrsFactory : public CrsFactory<Curve> {
   public:
@@ -54,7 +58,33 @@ template <typename Curve> class FileProverCrs : public ProverCrs<Curve> {
         scalar_multiplication::generate_pippenger_point_table<Curve>(monomials_.get(), monomials_.get(), num_points);
     };
 
-    std::span<typename Curve::AffineElement> get_monomial_points() { return { monomials_.get(), num_points * 2 }; }
+    /**
+     * @brief Construct a prover CRS that extends a smaller one
+     * @details The point table of the first prefix->get_monomial_size() points is copied from prefix, so only the
+     * remaining SRS elements are read from the transcript and expanded into the point table.
+     *
+     * @param num_points
+     * @param path
+     * @param prefix A prover CRS of the same SRS with at most num_points points
+     */
+    FileProverCrs(const size_t num_points, std::string const& path, ProverCrs<Curve>& prefix)
+        : num_points(num_points)
+    {
+        const size_t num_prefix_points = std::min(prefix.get_monomial_size(), num_points);
+        monomials_ = scalar_multiplication::point_table_alloc<typename Curve::AffineElement>(num_points);
+        std::copy_n(prefix.get_monomial_points().data(), num_prefix_points * 2, monomials_.get());
+
+        // Read the remaining points to where their point table starts, and expand them in place
+        auto* suffix_table = monomials_.get() + num_prefix_points * 2;
+        srs::IO<Curve>::read_transcript_g1(suffix_table, num_points, path, num_prefix_points);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(
+            suffix_table, suffix_table, num_points - num_prefix_points);
+    };
+
+    std::span<const typename Curve::AffineElement> get_monomial_points()
+    {
+        return { monomials_.get(), num_points * 2 };
+    }
 
     [[nodiscard]] size_t get_monomial_size() const { return num_points; }
 
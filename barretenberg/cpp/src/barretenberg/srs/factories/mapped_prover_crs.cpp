@@ -0,0 +1,122 @@
+#include "mapped_prover_crs.hpp"
+#include "barretenberg/common/assert.hpp"
+#include "barretenberg/common/log.hpp"
+#include "barretenberg/common/throw_or_abort.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#ifndef __wasm__
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace bb::srs::factories {
+
+namespace {
+constexpr char POINT_TABLE_MAGIC[8] = { 'B', 'B', 'P', 'T', 'A', 'B', 'L', 'E' };
+constexpr uint32_t POINT_TABLE_VERSION = 1;
+
+template <typename Curve> PointTableHeader make_point_table_header(size_t num_points)
+{
+    PointTableHeader header{};
+    std::memcpy(header.magic, POINT_TABLE_MAGIC, sizeof(POINT_TABLE_MAGIC));
+    header.version = POINT_TABLE_VERSION;
+    header.element_size = sizeof(typename Curve::AffineElement);
+    header.num_points = num_points;
+    std::strncpy(header.curve_name, Curve::name, sizeof(header.curve_name) - 1);
+    return header;
+}
+} // namespace
+
+template <typename Curve>
+std::shared_ptr<MappedProverCrs<Curve>> MappedProverCrs<Curve>::map(std::string const& filename,
+                                                                    size_t min_num_points)
+{
+#ifndef __wasm__
+    const int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return nullptr;
+    }
+    // Check the header against the file before mapping it
+    struct stat st;
+    PointTableHeader header;
+    if (fstat(fd, &st) != 0 || st.st_size < static_cast<off_t>(POINT_TABLE_HEADER_SIZE) ||
+        pread(fd, &header, sizeof(header), 0) != static_cast<ssize_t>(sizeof(header))) {
+        close(fd);
+        return nullptr;
+    }
+    const auto file_size = static_cast<size_t>(st.st_size);
+    // Compare the size of the table to the number of points by division, as num_points may be anything
+    const size_t table_size = file_size - POINT_TABLE_HEADER_SIZE;
+    const PointTableHeader expected = make_point_table_header<Curve>(header.num_points);
+    if (std::memcmp(&header, &expected, sizeof(header)) != 0 || table_size % (2 * sizeof(AffineElement)) != 0 ||
+        table_size / (2 * sizeof(AffineElement)) != header.num_points || header.num_points < min_num_points) {
+        close(fd);
+        return nullptr;
+    }
+
+    // The mapping stays valid once the file is closed
+    void* mapping = mmap(nullptr, file_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (mapping == MAP_FAILED) {
+        return nullptr;
+    }
+
+    char* table_start = static_cast<char*>(mapping) + POINT_TABLE_HEADER_SIZE;
+    const size_t needed_bytes = min_num_points * 2 * sizeof(AffineElement);
+#ifdef MADV_HUGEPAGE
+    // Only a hint: huge pages of a file mapping depend on the filesystem and kernel configuration
+    madvise(table_start, needed_bytes, MADV_HUGEPAGE);
+#endif
+    // Read ahead the part of the table that will be used, rather than faulting it in a page at a time
+    madvise(table_start, needed_bytes, MADV_WILLNEED);
+
+    std::shared_ptr<const AffineElement[]> point_table(reinterpret_cast<const AffineElement*>(table_start),
+                                                       [mapping, file_size](const AffineElement*) {
+                                                           munmap(mapping, file_size);
+                                                       });
+    vinfo("Mapped ", Curve::name, " prover CRS of size ", header.num_points, " from ", filename);
+    return std::make_shared<MappedProverCrs>(std::move(point_table), header.num_points);
+#else
+    static_cast<void>(filename);
+    static_cast<void>(min_num_points);
+    return nullptr;
+#endif
+}
+
+template <typename Curve>
+void write_point_table(std::string const& filename, std::span<const typename Curve::AffineElement> point_table)
+{
+    ASSERT(point_table.size() % 2 == 0);
+    const PointTableHeader header = make_point_table_header<Curve>(point_table.size() / 2);
+    std::vector<char> header_page(POINT_TABLE_HEADER_SIZE, 0);
+    std::memcpy(header_page.data(), &header, sizeof(header));
+
+    const std::string tmp_filename = filename + ".tmp";
+    std::ofstream file(tmp_filename, std::ofstream::binary);
+    file.write(header_page.data(), static_cast<std::streamsize>(header_page.size()));
+    file.write(reinterpret_cast<const char*>(point_table.data()),
+               static_cast<std::streamsize>(point_table.size_bytes()));
+    file.close();
+    if (!file) {
+        throw_or_abort(format("Failed to write point table file ", tmp_filename));
+    }
+    if (std::rename(tmp_filename.c_str(), filename.c_str()) != 0) {
+        throw_or_abort(format("Failed to rename ", tmp_filename, " to ", filename));
+    }
+}
+
+template class MappedProverCrs<curve::BN254>;
+template class MappedProverCrs<curve::Grumpkin>;
+template void write_point_table<curve::BN254>(std::string const& filename,
+                                              std::span<const curve::BN254::AffineElement> point_table);
+template void write_point_table<curve::Grumpkin>(std::string const& filename,
+                                                 std::span<const curve::Grumpkin::AffineElement> point_table);
+
+} // namespace bb::srs::factories
@@ -0,0 +1,99 @@
+#pragma once
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "crs_factory.hpp"
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+
+namespace bb::srs::factories {
+
+/**
+ * @brief The header of a point table file, which holds a pippenger point table as laid out in memory
+ *
+ * @details A point table file has the following structure:
+ *
+ * 0000 | "BBPTABLE"         | Magic
+ * 0008 | XX XX XX XX        | Format version
+ * 000C | XX XX XX XX        | sizeof(AffineElement)
+ * 0010 | XX XX XX XX XX ... | The number of SRS points (num_points)
+ * 0018 | XX XX ...          | The curve name, zero padded to 16 bytes
+ *        00 ...             | Zero padding up to POINT_TABLE_HEADER_SIZE
+ * 1000 | XX XX ...          | The point table: 2 * num_points affine elements, in their in-memory representation,
+ *                             with the raw SRS points at even indices and their endomorphism points at odd indices
+ *
+ * The header takes a whole page so that the point table is page aligned when the file is mapped. As the point table
+ * is stored in its in-memory (Montgomery) form, a file is only meant for use on the machine that wrote it.
+ */
+struct PointTableHeader {
+    char magic[8];
+    uint32_t version;
+    uint32_t element_size;
+    uint64_t num_points;
+    char curve_name[16];
+};
+
+static constexpr size_t POINT_TABLE_HEADER_SIZE = 4096;
+
+/**
+ * @brief The name of the point table file of a curve in a CRS directory. bb write_point_table writes it, and
+ * FileCrsFactory and bb map it
+ */
+template <typename Curve> constexpr const char* get_point_table_filename()
+{
+    if constexpr (std::same_as<Curve, curve::BN254>) {
+        return "bn254_point_table.dat";
+    } else {
+        static_assert(std::same_as<Curve, curve::Grumpkin>);
+        return "grumpkin_point_table.dat";
+    }
+}
+
+/**
+ * @brief A prover CRS backed by a read-only mapping of a point table file
+ * @details Loading the CRS costs no computation, and the mapped pages are shared with every other process that maps
+ * the same file, so concurrent provers hold a single copy of the point table in memory.
+ * @warning The monomial points are read-only; writing to them is a segfault.
+ */
+template <typename Curve> class MappedProverCrs : public ProverCrs<Curve> {
+    using AffineElement = typename Curve::AffineElement;
+
+  public:
+    MappedProverCrs(std::shared_ptr<const AffineElement[]> point_table, size_t num_points)
+        : num_points(num_points)
+        , monomials_(std::move(point_table))
+    {}
+
+    /**
+     * @brief Map the point table file at filename
+     *
+     * @param filename
+     * @param min_num_points The least number of SRS points needed
+     * @return The CRS, or nullptr if the file does not exist, is not a valid point table for this curve, or has too
+     * few points
+     */
+    static std::shared_ptr<MappedProverCrs> map(std::string const& filename, size_t min_num_points);
+
+    std::span<const AffineElement> get_monomial_points() override { return { monomials_.get(), num_points * 2 }; }
+
+    size_t get_monomial_size() const override { return num_points; }
+
+  private:
+    size_t num_points;
+    std::shared_ptr<const AffineElement[]> monomials_;
+};
+
+/**
+ * @brief Write a pippenger point table to a point table file, to be loaded with MappedProverCrs::map
+ * @details The file is written under a temporary name and then renamed, so a process never maps a partial file.
+ *
+ * @param filename
+ * @param point_table 2 * num_points elements, as produced by generate_pippenger_point_table
+ */
+template <typename Curve>
+void write_point_table(std::string const& filename, std::span<const typename Curve::AffineElement> point_table);
+
+} // namespace bb::srs::factories
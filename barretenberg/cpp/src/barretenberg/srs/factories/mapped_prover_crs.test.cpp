@@ -0,0 +1,102 @@
+#include "mapped_prover_crs.hpp"
+#include "barretenberg/ecc/curves/bn254/bn254.hpp"
+#include "barretenberg/ecc/curves/grumpkin/grumpkin.hpp"
+#include "file_crs_factory.hpp"
+#include <cstdio>
+#include <cstddef>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+
+using namespace bb;
+using namespace bb::srs::factories;
+using namespace bb::curve;
+
+namespace {
+// Write the point table of a file CRS to a point table file, map it, and check that the points agree
+template <typename Curve> void check_mapped_point_table(std::string const& crs_path)
+{
+    using AffineElement = typename Curve::AffineElement;
+    const size_t num_points = 1024;
+    const std::string filename = "mapped_prover_crs_test_" + std::string(Curve::name) + ".dat";
+    FileProverCrs<Curve> file_crs(num_points, crs_path);
+    write_point_table<Curve>(filename, file_crs.get_monomial_points());
+
+    // A table with at least as many points as needed maps, and keeps its full size
+    auto mapped_crs = MappedProverCrs<Curve>::map(filename, num_points / 2);
+    ASSERT_NE(mapped_crs, nullptr);
+    EXPECT_EQ(mapped_crs->get_monomial_size(), num_points);
+    EXPECT_EQ(memcmp(mapped_crs->get_monomial_points().data(),
+                     file_crs.get_monomial_points().data(),
+                     sizeof(AffineElement) * num_points * 2),
+              0);
+
+    // A table with too few points, or whose size does not match its header, or with a corrupted header, does not map
+    EXPECT_EQ(MappedProverCrs<Curve>::map(filename, num_points + 1), nullptr);
+    {
+        std::ofstream file(filename, std::ios::binary | std::ios::app);
+        file.write("X", 1);
+    }
+    EXPECT_EQ(MappedProverCrs<Curve>::map(filename, num_points), nullptr);
+    std::filesystem::resize_file(filename, POINT_TABLE_HEADER_SIZE + (num_points - 1) * 2 * sizeof(AffineElement));
+    EXPECT_EQ(MappedProverCrs<Curve>::map(filename, 1), nullptr);
+    {
+        // a number of points for which the size of the table overflows
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        file.seekp(offsetof(PointTableHeader, num_points));
+        const uint64_t huge_num_points = (1ULL << 63) + num_points - 1;
+        file.write(reinterpret_cast<const char*>(&huge_num_points), sizeof(huge_num_points));
+    }
+    EXPECT_EQ(MappedProverCrs<Curve>::map(filename, 1), nullptr);
+    write_point_table<Curve>(filename, file_crs.get_monomial_points());
+    EXPECT_NE(MappedProverCrs<Curve>::map(filename, num_points), nullptr);
+    {
+        std::fstream file(filename, std::ios::binary | std::ios::in | std::ios::out);
+        file.write("XX", 2);
+    }
+    EXPECT_EQ(MappedProverCrs<Curve>::map(filename, num_points), nullptr);
+    std::remove(filename.c_str());
+    EXPECT_EQ(MappedProverCrs<Curve>::map(filename, 1), nullptr);
+}
+} // namespace
+
+TEST(reference_string, mapped_bn254_point_table)
+{
+    check_mapped_point_table<BN254>("../srs_db/ignition");
+}
+
+TEST(reference_string, mapped_grumpkin_point_table)
+{
+    check_mapped_point_table<Grumpkin>("../srs_db/grumpkin");
+}
+
+// A point table of one curve is not mapped as a point table of another
+TEST(reference_string, mapped_point_table_curve_mismatch)
+{
+    const size_t num_points = 16;
+    const std::string filename = "mapped_prover_crs_test_mismatch.dat";
+    FileProverCrs<Grumpkin> file_crs(num_points, "../srs_db/grumpkin");
+    write_point_table<Grumpkin>(filename, file_crs.get_monomial_points());
+
+    EXPECT_NE(MappedProverCrs<Grumpkin>::map(filename, num_points), nullptr);
+    EXPECT_EQ(MappedProverCrs<BN254>::map(filename, num_points), nullptr);
+    std::remove(filename.c_str());
+}
+
+// FileCrsFactory maps the point table that bb write_point_table writes to a CRS directory
+TEST(reference_string, file_crs_factory_maps_point_table)
+{
+    const size_t num_points = 16;
+    const std::string crs_path = "mapped_prover_crs_test_dir";
+    std::filesystem::create_directory(crs_path);
+    FileProverCrs<Grumpkin> file_crs(num_points, "../srs_db/grumpkin");
+    write_point_table<Grumpkin>(crs_path + "/" + get_point_table_filename<Grumpkin>(), file_crs.get_monomial_points());
+
+    // The directory holds no transcript, so the CRS can only come from the point table
+    FileCrsFactory<Grumpkin> factory(crs_path, num_points);
+    auto prover_crs = factory.get_prover_crs(num_points);
+    EXPECT_NE(std::dynamic_pointer_cast<MappedProverCrs<Grumpkin>>(prover_crs), nullptr);
+    EXPECT_EQ(prover_crs->get_monomial_size(), num_points);
+    std::filesystem::remove_all(crs_path);
+}
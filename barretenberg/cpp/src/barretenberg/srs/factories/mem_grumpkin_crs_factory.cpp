@@ -18,12 +18,20 @@ class MemVerifierCrs : public VerifierCrs<Grumpkin> {
   public:
     MemVerifierCrs(std::vector<Grumpkin::AffineElement> const& points)
         : num_points(points.size())
-        , monomials_(scalar_multiplication::point_table_alloc<Grumpkin::AffineElement>(points.size()))
     {
-        std::copy(points.begin(), points.end(), monomials_.get());
-        scalar_multiplication::generate_pippenger_point_table<Grumpkin>(monomials_.get(), monomials_.get(), num_points);
+        auto point_table = scalar_multiplication::point_table_alloc<Grumpkin::AffineElement>(num_points);
+        std::copy(points.begin(), points.end(), point_table.get());
+        scalar_multiplication::generate_pippenger_point_table<Grumpkin>(
+            point_table.get(), point_table.get(), num_points);
+        monomials_ = std::move(point_table);
     }
 
+    // Share the point table of a prover CRS
+    MemVerifierCrs(std::shared_ptr<ProverCrs<Grumpkin>> const& prover_crs)
+        : num_points(prover_crs->get_monomial_size())
+        , monomials_(prover_crs, prover_crs->get_monomial_points().data())
+    {}
+
     virtual ~MemVerifierCrs() = default;
     std::span<const Grumpkin::AffineElement> get_monomial_points() const override
     {
@@ -34,7 +42,7 @@ class MemVerifierCrs : public VerifierCrs<Grumpkin> {
 
   private:
     size_t num_points;
-    std::shared_ptr<Grumpkin::AffineElement[]> monomials_;
+    std::shared_ptr<const Grumpkin::AffineElement[]> monomials_;
 };
 
 } // namespace
@@ -51,6 +59,11 @@ MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::vector<Grumpkin::AffineElement
           prover_crs_->get_monomial_size());
 }
 
+MemGrumpkinCrsFactory::MemGrumpkinCrsFactory(std::shared_ptr<ProverCrs<Grumpkin>> prover_crs)
+    : prover_crs_(std::move(prover_crs))
+    , verifier_crs_(std::make_shared<MemVerifierCrs>(prover_crs_))
+{}
+
 std::shared_ptr<bb::srs::factories::ProverCrs<Grumpkin>> MemGrumpkinCrsFactory::get_prover_crs(size_t degree)
 {
     if (prover_crs_->get_monomial_size() < degree) {
@@ -41,6 +41,19 @@ void init_grumpkin_crs_factory(std::string crs_path)
     grumpkin_crs_factory = std::make_shared<factories::FileCrsFactory<curve::Grumpkin>>(crs_path);
 }
 
+// Initializes the crs using an existing prover crs
+void init_crs_factory_from_prover_crs(std::shared_ptr<factories::ProverCrs<curve::BN254>> prover_crs,
+                                      g2::affine_element const g2_point)
+{
+    crs_factory = std::make_shared<factories::MemBn254CrsFactory>(std::move(prover_crs), g2_point);
+}
+
+// Initializes the crs using an existing prover crs
+void init_grumpkin_crs_factory_from_prover_crs(std::shared_ptr<factories::ProverCrs<curve::Grumpkin>> prover_crs)
+{
+    grumpkin_crs_factory = std::make_shared<factories::MemGrumpkinCrsFactory>(std::move(prover_crs));
+}
+
 std::shared_ptr<factories::CrsFactory<curve::BN254>> get_bn254_crs_factory()
 {
     if (!crs_factory) {
@@ -1,11 +1,13 @@
 #pragma once
 #include "../ecc/curves/bn254/bn254.hpp"
 #include "../ecc/curves/grumpkin/grumpkin.hpp"
+#include "barretenberg/common/thread.hpp"
 #include <concepts>
 #include <cstdint>
 #include <fstream>
 #include <string>
 #include <sys/stat.h>
+#include <vector>
 
 namespace bb::srs {
 /**
@@ -125,10 +127,10 @@ template <typename Curve> class IO {
 
         std::ifstream file;
         file.open(filename, std::ifstream::binary);
-        file.seekg((int)offset);
+        file.seekg(static_cast<std::streamoff>(offset));
 
         // Read the desired size, but return the actual size read
-        file.read(buffer, (int)size);
+        file.read(buffer, static_cast<std::streamsize>(size));
         if (!file) {
             ptrdiff_t read = file.gcount();
             throw_or_abort(
@@ -281,41 +283,71 @@ template <typename Curve> class IO {
         byteswap<>(elements, buffer_size);
     }
 
-    static void read_transcript_g1(AffineElement* monomials, size_t degree, std::string const& dir)
+    /**
+     * @brief Read G1 points [start_index, degree) of the transcript into monomials[0, degree - start_index)
+     * @details The manifests are read first, to find where each point lies in the transcript files. The points are
+     * then read and converted to Montgomery form a chunk at a time, with the chunks spread over the threads, so that
+     * loading a large SRS is not bound by a single thread.
+     */
+    static void read_transcript_g1(AffineElement* monomials,
+                                   size_t degree,
+                                   std::string const& dir,
+                                   size_t start_index = 0)
     {
+        // A contiguous run of points in a transcript file
+        struct Segment {
+            std::string path;
+            size_t file_offset;
+            size_t monomial_index;
+            size_t num_points;
+        };
+        // Each chunk is read as a single request, of a size that a disk serves efficiently
+        constexpr size_t POINTS_PER_CHUNK = 1UL << 16;
+
         size_t num = 0;
-        size_t num_read = 0;
+        size_t num_seen = 0;
         std::string path = get_transcript_path(dir, num);
 
         if (!is_file_exist(path)) {
             throw_or_abort(format("File path for transcript g1 ", path, " is invalid."));
         }
 
-        while (num_read < degree) {
+        std::vector<Segment> chunks;
+        while (num_seen < degree && is_file_exist(path)) {
             Manifest manifest;
             read_manifest(path, manifest);
 
-            auto offset = sizeof(Manifest);
-            const size_t num_to_read = std::min((size_t)manifest.num_g1_points, degree - num_read);
-            const size_t g1_buffer_size = sizeof(Fq) * 2 * num_to_read;
-
-            char* buffer = (char*)&monomials[num_read];
-            size_t size = 0;
-
-            // We must pass the size actually read to the second call, not the desired
-            // g1_buffer_size as the file may have been smaller than this.
-            read_file_into_buffer(buffer, size, path, offset, g1_buffer_size);
-            srs::IO<Curve>::byteswap(&monomials[num_read], size);
+            // The points of this file that lie in [start_index, degree)
+            const size_t file_start = std::max(start_index, num_seen);
+            const size_t file_end = std::min(degree, num_seen + static_cast<size_t>(manifest.num_g1_points));
+            // Check the file size up front, as a failed read on a worker thread could not be reported
+            const size_t file_size_needed = sizeof(Manifest) + sizeof(Fq) * 2 * (file_end - num_seen);
+            if (file_start < file_end && get_file_size(path) < file_size_needed) {
+                throw_or_abort(format("Transcript file ",
+                                      path,
+                                      " has ",
+                                      get_file_size(path),
+                                      " bytes but ",
+                                      file_size_needed,
+                                      " are required."));
+            }
+            for (size_t chunk_start = file_start; chunk_start < file_end; chunk_start += POINTS_PER_CHUNK) {
+                const size_t chunk_end = std::min(file_end, chunk_start + POINTS_PER_CHUNK);
+                chunks.push_back({ path,
+                                   sizeof(Manifest) + sizeof(Fq) * 2 * (chunk_start - num_seen),
+                                   chunk_start - start_index,
+                                   chunk_end - chunk_start });
+            }
 
-            num_read += num_to_read;
+            num_seen += manifest.num_g1_points;
             path = get_transcript_path(dir, ++num);
         }
 
-        const bool monomial_srs_condition = num_read < degree;
+        const bool monomial_srs_condition = num_seen < degree;
         if (monomial_srs_condition) {
             throw_or_abort(
                 format("Only read ",
-                       num_read,
+                       num_seen,
                        " points from ",
                        path,
                        ", but require ",
@@ -326,6 +358,17 @@ template <typename Curve> class IO {
                        " `grumpkin_srs_gen` (but be careful, as this suggests you've "
                        "just changed a circuit to exceed a new 'power of two' boundary)."));
         }
+
+        parallel_for(chunks.size(), [&](size_t i) {
+            const Segment& chunk = chunks[i];
+            char* buffer = (char*)&monomials[chunk.monomial_index];
+            size_t size = 0;
+
+            // We must pass the size actually read to the second call, not the desired
+            // buffer size as the file may have been smaller than this.
+            read_file_into_buffer(buffer, size, chunk.path, chunk.file_offset, sizeof(Fq) * 2 * chunk.num_points);
+            srs::IO<Curve>::byteswap(&monomials[chunk.monomial_index], size);
+        });
     }
 
     static void read_transcript_g2(auto& g2_x, std::string const& dir)
@@ -2,7 +2,9 @@
 #include "barretenberg/common/mem.hpp"
 #include "barretenberg/ecc/curves/bn254/fq12.hpp"
 #include "barretenberg/ecc/curves/bn254/pairing.hpp"
+#include "factories/file_crs_factory.hpp"
 #include <gtest/gtest.h>
+#include <vector>
 
 using namespace bb;
 
@@ -30,3 +32,33 @@ TEST(io, read_transcript_loads_well_formed_srs)
     }
     aligned_free(monomials);
 }
+
+TEST(io, read_transcript_g1_from_start_index)
+{
+    const size_t degree = 5000;
+    const size_t start_index = 3000;
+    std::vector<g1::affine_element> monomials(degree);
+    std::vector<g1::affine_element> suffix(degree - start_index);
+    srs::IO<curve::BN254>::read_transcript_g1(monomials.data(), degree, "../srs_db/ignition");
+    srs::IO<curve::BN254>::read_transcript_g1(suffix.data(), degree, "../srs_db/ignition", start_index);
+
+    for (size_t i = start_index; i < degree; ++i) {
+        EXPECT_EQ(monomials[i], suffix[i - start_index]);
+    }
+}
+
+// A prover CRS extended from a smaller one holds the same point table as one read in full
+TEST(io, file_prover_crs_extends_smaller_crs)
+{
+    const size_t num_points = 5000;
+    srs::factories::FileProverCrs<curve::BN254> full_crs(num_points, "../srs_db/ignition");
+    srs::factories::FileProverCrs<curve::BN254> prefix_crs(num_points / 3, "../srs_db/ignition");
+    srs::factories::FileProverCrs<curve::BN254> extended_crs(num_points, "../srs_db/ignition", prefix_crs);
+
+    auto full_points = full_crs.get_monomial_points();
+    auto extended_points = extended_crs.get_monomial_points();
+    ASSERT_EQ(full_points.size(), extended_points.size());
+    for (size_t i = 0; i < full_points.size(); ++i) {
+        EXPECT_EQ(full_points[i], extended_points[i]);
+    }
+}
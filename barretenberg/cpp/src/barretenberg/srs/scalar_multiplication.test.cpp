@@ -70,7 +70,8 @@ TYPED_TEST(ScalarMultiplicationTests, ReduceBucketsSimple)
         TestFixture::read_transcript_g2(TestFixture::SRS_PATH);
     }
     auto crs = srs::factories::FileProverCrs<Curve>(num_points / 2, TestFixture::SRS_PATH);
-    std::span<AffineElement> monomials = crs.get_monomial_points();
+    // a copy, as the runtime state takes mutable points
+    std::vector<AffineElement> monomials(crs.get_monomial_points().begin(), crs.get_monomial_points().end());
 
     std::vector<uint64_t> point_schedule(bb::scalar_multiplication::point_table_size(num_points / 2));
     std::array<bool, num_points> bucket_empty_status;
@@ -1058,3 +1059,108 @@ TYPED_TEST(ScalarMultiplicationTests, PippengerMulByZero)
 
     EXPECT_EQ(result.is_point_at_infinity(), true);
 }
+
+TYPED_TEST(ScalarMultiplicationTests, PippengerSignedDigit)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+    using Fr = typename Curve::ScalarField;
+
+    constexpr size_t num_points = 8192;
+
+    std::vector<Fr> scalars(num_points);
+    auto points = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+
+    // Mix in scalars that exercise the edge cases of the recoding and the bucket additions: zero, the largest scalar
+    // and runs of equal scalars, which all land in the same buckets
+    for (size_t i = 0; i < num_points; ++i) {
+        scalars[i] = Fr::random_element();
+        points.get()[i] = AffineElement(Element::random_element());
+    }
+    for (size_t i = 0; i < 256; ++i) {
+        scalars[i * 4] = Fr::zero();
+        scalars[i * 4 + 1] = -Fr::one();
+        scalars[i * 4 + 2] = Fr::one();
+    }
+
+    Element expected;
+    expected.self_set_infinity();
+    for (size_t i = 0; i < num_points; ++i) {
+        expected += points.get()[i] * scalars[i];
+    }
+    expected = expected.normalize();
+    scalar_multiplication::generate_pippenger_point_table<Curve>(points.get(), points.get(), num_points);
+    std::span<const AffineElement> point_table(points.get(), num_points * 2);
+
+    Element result = scalar_multiplication::pippenger_signed_digit<Curve>(scalars, point_table);
+    EXPECT_EQ(result.normalize(), expected);
+
+    Element single_threaded_result = scalar_multiplication::pippenger_single_threaded<Curve>(scalars, point_table);
+    EXPECT_EQ(single_threaded_result.normalize(), expected);
+
+    // The signed digit variant can also be selected for the existing entry points
+    scalar_multiplication::pippenger_runtime_state<Curve> state(num_points);
+    scalar_multiplication::set_pippenger_algorithm(scalar_multiplication::PippengerAlgorithm::SIGNED_DIGIT);
+    Element selected_result = scalar_multiplication::pippenger_unsafe<Curve>(scalars, point_table, state);
+    scalar_multiplication::set_pippenger_algorithm(scalar_multiplication::PippengerAlgorithm::WNAF);
+    EXPECT_EQ(selected_result.normalize(), expected);
+}
+
+TEST(ScalarMultiplication, SignedDigitsReconstructScalar)
+{
+    // Scalars of every bit length up to 128: all ones, which carry out of every window, and random ones
+    std::vector<std::pair<uint256_t, size_t>> scalars;
+    for (size_t scalar_bits = 1; scalar_bits <= 128; ++scalar_bits) {
+        const uint256_t mask = (uint256_t(1) << scalar_bits) - 1;
+        scalars.emplace_back(mask, scalar_bits);
+        scalars.emplace_back((engine.get_random_uint256() & mask) | (uint256_t(1) << (scalar_bits - 1)), scalar_bits);
+    }
+
+    for (size_t digit_bits = 2; digit_bits <= scalar_multiplication::MAX_SIGNED_DIGIT_BITS; ++digit_bits) {
+        const auto half_window = static_cast<int64_t>(1ULL << (digit_bits - 1));
+        for (const auto& [scalar, scalar_bits] : scalars) {
+            const size_t num_windows = scalar_multiplication::get_num_signed_digit_windows(digit_bits, scalar_bits);
+            std::vector<int16_t> digits(num_windows);
+            scalar_multiplication::compute_signed_digits(&scalar.data[0], digit_bits, num_windows, digits.data(), 1);
+
+            uint256_t positive = 0;
+            uint256_t negative = 0;
+            for (size_t window = 0; window < num_windows; ++window) {
+                const int64_t digit = digits[window];
+                EXPECT_GE(digit, -half_window);
+                EXPECT_LT(digit, half_window);
+                if (digit >= 0) {
+                    positive += uint256_t(static_cast<uint64_t>(digit)) << (window * digit_bits);
+                } else {
+                    negative += uint256_t(static_cast<uint64_t>(-digit)) << (window * digit_bits);
+                }
+            }
+            EXPECT_EQ(positive - negative, scalar) << "digit_bits = " << digit_bits << ", scalar = " << scalar;
+        }
+    }
+}
+
+TYPED_TEST(ScalarMultiplicationTests, PointTableInPlace)
+{
+    using Curve = TypeParam;
+    using Element = typename Curve::Element;
+    using AffineElement = typename Curve::AffineElement;
+
+    // odd sizes, large enough to be expanded by several threads, halve into odd ranges
+    for (const size_t num_points : { 1UL, 2UL, 3UL, 5UL, 8193UL, 12289UL }) {
+        std::vector<AffineElement> points(num_points);
+        for (auto& point : points) {
+            point = AffineElement(Element::random_element());
+        }
+        std::vector<AffineElement> expected(num_points * 2);
+        scalar_multiplication::generate_pippenger_point_table<Curve>(points.data(), expected.data(), num_points);
+
+        auto table = scalar_multiplication::point_table_alloc<AffineElement>(num_points);
+        std::copy(points.begin(), points.end(), table.get());
+        scalar_multiplication::generate_pippenger_point_table<Curve>(table.get(), table.get(), num_points);
+        for (size_t i = 0; i < num_points * 2; ++i) {
+            EXPECT_EQ(table.get()[i], expected[i]) << "num_points = " << num_points << ", i = " << i;
+        }
+    }
+}
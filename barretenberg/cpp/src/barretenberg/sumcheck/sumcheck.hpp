@@ -169,13 +169,21 @@ template <typename Flavor> class SumcheckProver {
     * TODO(#224)(Cody): might want to just do C-style multidimensional array? for guaranteed adjacency?
     */
     PartiallyEvaluatedMultivariates partially_evaluated_polynomials;
+    /**
+     * @brief The number of initial rounds computed directly from the prover polynomials, see \ref
+     * bb::SumcheckProver::FoldedPolynomials "FoldedPolynomials". If nonzero, the book-keeping table is only allocated
+     * after these rounds, with \f$ n / 2^k \f$ rows instead of \f$ n/2 \f$.
+     */
+    const size_t num_fused_rounds;
     // prover instantiates sumcheck with circuit size and a prover transcript
-    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript)
+    SumcheckProver(size_t multivariate_n, const std::shared_ptr<Transcript>& transcript, size_t num_fused_rounds = 0)
         : multivariate_n(multivariate_n)
         , multivariate_d(numeric::get_msb(multivariate_n))
         , transcript(transcript)
         , round(multivariate_n)
-        , partially_evaluated_polynomials(multivariate_n){};
+        , partially_evaluated_polynomials(num_fused_rounds == 0 ? PartiallyEvaluatedMultivariates(multivariate_n)
+                                                                : PartiallyEvaluatedMultivariates())
+        , num_fused_rounds(std::min(num_fused_rounds, multivariate_d)){};
 
     /**
      * @brief Compute round univariate, place it in transcript, compute challenge, partially evaluate. Repeat
@@ -199,16 +207,19 @@ template <typename Flavor> class SumcheckProver {
         };
 
         bb::GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+        // Find the rows on which all prover polynomials vanish, so that every round can skip them
+        round.compute_active_row_ranges(full_polynomials, relation_parameters);
 
         std::vector<FF> multivariate_challenge;
         multivariate_challenge.reserve(multivariate_d);
-        size_t round_idx = 0;
-        // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
-        // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has ZK,
-        // compute_univariate also takes into account the zk_sumcheck_data.
-        auto round_univariate = round.compute_univariate(
-            round_idx, full_polynomials, relation_parameters, gate_separators, alpha, zk_sumcheck_data);
-        {
+        SumcheckRoundUnivariate round_univariate;
+        if (num_fused_rounds == 0) {
+            size_t round_idx = 0;
+            // In the first round, we compute the first univariate polynomial and populate the book-keeping table of
+            // #partially_evaluated_polynomials, which has \f$ n/2 \f$ rows and \f$ N \f$ columns. When the Flavor has
+            // ZK, compute_univariate also takes into account the zk_sumcheck_data.
+            round_univariate = round.compute_univariate(
+                round_idx, full_polynomials, relation_parameters, gate_separators, alpha, zk_sumcheck_data);
 
 #ifdef TRACY_MEMORY
             ZoneScopedN("rest of sumcheck round 1");
@@ -228,8 +239,31 @@ template <typename Flavor> class SumcheckProver {
             round.round_size = round.round_size >> 1; // TODO(#224)(Cody): Maybe partially_evaluate should do this and
                                                       // release memory?        // All but final round
                                                       // We operate on partially_evaluated_polynomials in place.
+        } else {
+            // The first rounds read the prover polynomials, folded on the fly at the challenges drawn so far. The
+            // book-keeping table is only populated once all of these challenges are known.
+            std::vector<FF> fold_weights{ FF(1) };
+            for (size_t round_idx = 0; round_idx < num_fused_rounds; round_idx++) {
+
+#ifdef TRACY_MEMORY
+                ZoneScopedN("fused sumcheck round");
+#endif
+                FoldedPolynomials folded_polynomials(full_polynomials, fold_weights);
+                round_univariate = round.compute_univariate(
+                    round_idx, folded_polynomials, relation_parameters, gate_separators, alpha, zk_sumcheck_data);
+                transcript->send_to_verifier("Sumcheck:univariate_" + std::to_string(round_idx), round_univariate);
+                FF round_challenge = transcript->template get_challenge<FF>("Sumcheck:u_" + std::to_string(round_idx));
+                multivariate_challenge.emplace_back(round_challenge);
+                fold_weights = FoldedPolynomials::extend_weights(fold_weights, round_challenge);
+                if constexpr (Flavor::HasZK) {
+                    update_zk_sumcheck_data(zk_sumcheck_data, round_challenge, round_idx);
+                };
+                gate_separators.partially_evaluate(round_challenge);
+                round.round_size = round.round_size >> 1;
+            }
+            fold_into_partially_evaluated_polynomials(full_polynomials, fold_weights);
         }
-        for (size_t round_idx = 1; round_idx < multivariate_d; round_idx++) {
+        for (size_t round_idx = std::max(num_fused_rounds, size_t{ 1 }); round_idx < multivariate_d; round_idx++) {
 
 #ifdef TRACY_MEMORY
             ZoneScopedN("sumcheck loop");
@@ -351,6 +385,101 @@ template <typename Flavor> class SumcheckProver {
         });
     };
 
+    /**
+     * @brief A read-only view of the prover polynomials partially evaluated at the challenges \f$ u_0, \ldots, u_{r-1}
+     * \f$, whose entries are computed on demand instead of being stored.
+     * @details Row \f$ \ell \f$ of column \f$ j \f$ is
+     * \f{align}{ P_j(u_0,\ldots, u_{r-1}, \vec \ell) = \sum_{t=0}^{2^r - 1} w_t \cdot
+     * \texttt{full_polynomials}_{2^r \ell + t, j}, \f}
+     * where \f$ w_t = \prod_{s < r} (1 - u_s)^{1 - t_s} u_s^{t_s} \f$ for the binary digits \f$ t_s \f$ of \f$ t \f$.
+     * Reading a row costs \f$ 2^r \f$ multiplications per column, so it only pays off for the first few rounds. It
+     * provides the accessors used by \ref bb::SumcheckProverRound::extend_edges "extend_edges".
+     */
+    class FoldedPolynomials {
+      public:
+        using Polynomial = typename Flavor::Polynomial;
+
+        struct Column {
+            const Polynomial* polynomial;
+            std::span<const FF> weights;
+
+            FF operator[](size_t row) const
+            {
+                const size_t start = row * weights.size();
+                // Rows outside the memory backing the polynomial are zero
+                if (start >= polynomial->end_index() || start + weights.size() <= polynomial->start_index()) {
+                    return FF(0);
+                }
+                FF result(0);
+                for (size_t t = 0; t < weights.size(); ++t) {
+                    result += weights[t] * (*polynomial)[start + t];
+                }
+                return result;
+            }
+        };
+
+        FoldedPolynomials(ProverPolynomials& full_polynomials, std::span<const FF> weights)
+            : all(make_columns(full_polynomials.get_all(), weights))
+        {
+            if constexpr (Flavor::HasZK) {
+                witnesses = make_columns(full_polynomials.get_all_witnesses(), weights);
+                non_witnesses = make_columns(full_polynomials.get_non_witnesses(), weights);
+            }
+        }
+
+        std::vector<Column>& get_all() { return all; }
+        std::vector<Column>& get_all_witnesses() { return witnesses; }
+        std::vector<Column>& get_non_witnesses() { return non_witnesses; }
+
+        /**
+         * @brief The weights for the challenges \f$ u_0, \ldots, u_r \f$, given the weights for \f$ u_0, \ldots,
+         * u_{r-1} \f$
+         */
+        static std::vector<FF> extend_weights(const std::vector<FF>& weights, const FF& round_challenge)
+        {
+            std::vector<FF> extended(weights.size() * 2);
+            for (size_t t = 0; t < weights.size(); ++t) {
+                extended[t] = weights[t] * (FF(1) - round_challenge);
+                extended[weights.size() + t] = weights[t] * round_challenge;
+            }
+            return extended;
+        }
+
+      private:
+        std::vector<Column> all;
+        std::vector<Column> witnesses;
+        std::vector<Column> non_witnesses;
+
+        static std::vector<Column> make_columns(auto polynomials, std::span<const FF> weights)
+        {
+            std::vector<Column> columns;
+            columns.reserve(polynomials.size());
+            for (auto& polynomial : polynomials) {
+                columns.push_back({ &polynomial, weights });
+            }
+            return columns;
+        }
+    };
+
+    /**
+     * @brief Allocate the book-keeping table after the fused rounds and populate it with the evaluations of the
+     * prover polynomials at the challenges drawn so far.
+     * @param weights The weights of \ref bb::SumcheckProver::FoldedPolynomials "FoldedPolynomials" for these challenges
+     */
+    void fold_into_partially_evaluated_polynomials(ProverPolynomials& full_polynomials, std::span<const FF> weights)
+    {
+        // The constructor allocates half the given number of rows
+        partially_evaluated_polynomials = PartiallyEvaluatedMultivariates(round.round_size * 2);
+        FoldedPolynomials folded_polynomials(full_polynomials, weights);
+        auto pep_view = partially_evaluated_polynomials.get_all();
+        auto& folded_view = folded_polynomials.get_all();
+        parallel_for(folded_view.size(), [&](size_t j) {
+            for (size_t i = 0; i < round.round_size; i++) {
+                pep_view[j].at(i) = folded_view[j][i];
+            }
+        });
+    }
+
     /**
     * @brief This method takes the book-keeping table containing partially evaluated prover polynomials and creates a
     * vector containing the evaluations of all prover polynomials at the point \f$ (u_0, \ldots, u_{d-1} )\f$.
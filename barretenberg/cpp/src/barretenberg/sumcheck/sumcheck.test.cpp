@@ -161,6 +161,44 @@ template <typename Flavor> class SumcheckTests : public ::testing::Test {
         }
     }
 
+    // Computing the first rounds from the prover polynomials must not change the proof
+    void test_fused_rounds()
+    {
+        const size_t multivariate_d(4);
+        const size_t multivariate_n(1 << multivariate_d);
+
+        // Include polynomials that don't span the whole hypercube
+        std::vector<Polynomial<FF>> random_polynomials(NUM_POLYNOMIALS);
+        for (size_t i = 0; i < NUM_POLYNOMIALS; ++i) {
+            const size_t start_index = i % 3 == 0 ? 5 : 0;
+            const size_t end_index = i % 3 == 1 ? 11 : multivariate_n;
+            random_polynomials[i] = Polynomial<FF>::random(end_index - start_index, multivariate_n, start_index);
+        }
+        auto full_polynomials = construct_ultra_full_polynomials(random_polynomials);
+
+        auto prove = [&](size_t num_fused_rounds) {
+            auto transcript = Flavor::Transcript::prover_init_empty();
+            auto sumcheck = SumcheckProver<Flavor>(multivariate_n, transcript, num_fused_rounds);
+            RelationSeparator alpha;
+            for (size_t idx = 0; idx < alpha.size(); idx++) {
+                alpha[idx] = transcript->template get_challenge<FF>("Sumcheck:alpha_" + std::to_string(idx));
+            }
+            std::vector<FF> gate_challenges(multivariate_d);
+            for (size_t idx = 0; idx < gate_challenges.size(); idx++) {
+                gate_challenges[idx] =
+                    transcript->template get_challenge<FF>("Sumcheck:gate_challenge_" + std::to_string(idx));
+            }
+            RelationParameters<FF> relation_parameters{ .beta = FF(3), .gamma = FF(5), .public_input_delta = FF(7) };
+            sumcheck.prove(full_polynomials, relation_parameters, alpha, gate_challenges);
+            return transcript->proof_data;
+        };
+
+        const auto expected_proof = prove(0);
+        for (size_t num_fused_rounds = 1; num_fused_rounds <= multivariate_d + 1; ++num_fused_rounds) {
+            EXPECT_EQ(prove(num_fused_rounds), expected_proof);
+        }
+    }
+
     // TODO(#225): make the inputs to this test more interesting, e.g. non-trivial permutations
     void test_prover_verifier_flow()
     {
@@ -345,6 +383,12 @@ TYPED_TEST(SumcheckTests, Prover)
 {
     this->test_prover();
 }
+// Computing the first rounds without the book-keeping table gives the same proof
+TYPED_TEST(SumcheckTests, FusedRounds)
+{
+    SKIP_IF_ZK();
+    this->test_fused_rounds();
+}
 // Tests the prover-verifier flow
 TYPED_TEST(SumcheckTests, ProverAndVerifierSimple)
 {
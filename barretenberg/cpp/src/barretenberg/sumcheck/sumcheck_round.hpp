@@ -3,6 +3,7 @@
 #include "barretenberg/flavor/flavor.hpp"
 #include "barretenberg/polynomials/gate_separator.hpp"
 #include "barretenberg/relations/relation_parameters.hpp"
+#include "barretenberg/relations/relation_profiler.hpp"
 #include "barretenberg/relations/relation_types.hpp"
 #include "barretenberg/relations/utils.hpp"
 #include "barretenberg/stdlib/primitives/bool/bool.hpp"
@@ -62,6 +63,13 @@ template <typename Flavor> class SumcheckProverRound {
     static constexpr size_t BATCHED_RELATION_PARTIAL_LENGTH = Flavor::BATCHED_RELATION_PARTIAL_LENGTH;
     using SumcheckRoundUnivariate = bb::Univariate<FF, BATCHED_RELATION_PARTIAL_LENGTH>;
     SumcheckTupleOfTuplesOfUnivariates univariate_accumulators;
+    /**
+     * @brief Sorted disjoint ranges [start, end) of rows of the prover polynomials outside of which every polynomial
+     * vanishes, see \ref compute_active_row_ranges "compute_active_row_ranges". Empty if all rows are active.
+     */
+    std::vector<std::pair<size_t, size_t>> active_row_ranges;
+    // Inactive stretches shorter than this many edges are kept in the active ranges, to bound their number
+    static constexpr size_t MIN_SKIPPED_EDGES = 1 << 4;
     // Prover constructor
     SumcheckProverRound(size_t initial_round_size)
         : round_size(initial_round_size)
@@ -110,29 +118,130 @@ template <typename Flavor> class SumcheckProverRound {
     {
 
         if constexpr (!Flavor::HasZK) {
-            for (auto [extended_edge, multivariate] : zip_view(extended_edges.get_all(), multivariates.get_all())) {
-                bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-                extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
-            }
+            extend_edge_batch(extended_edges.get_all(), multivariates.get_all(), edge_idx);
         } else {
             // extend edges of witness polynomials and add correcting terms
-            for (auto [extended_edge, multivariate, masking_univariate] :
-                 zip_view(extended_edges.get_all_witnesses(),
-                          multivariates.get_all_witnesses(),
-                          zk_sumcheck_data.value().masking_terms_evaluations)) {
-                bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-                extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
+            extend_edge_batch(extended_edges.get_all_witnesses(), multivariates.get_all_witnesses(), edge_idx);
+            for (auto [extended_edge, masking_univariate] :
+                 zip_view(extended_edges.get_all_witnesses(), zk_sumcheck_data.value().masking_terms_evaluations)) {
                 extended_edge += masking_univariate;
             };
             // extend edges of public polynomials
-            for (auto [extended_edge, multivariate] :
-                 zip_view(extended_edges.get_non_witnesses(), multivariates.get_non_witnesses())) {
-                bb::Univariate<FF, 2> edge({ multivariate[edge_idx], multivariate[edge_idx + 1] });
-                extended_edge = edge.template extend_to<MAX_PARTIAL_RELATION_LENGTH>();
-            };
+            extend_edge_batch(extended_edges.get_non_witnesses(), multivariates.get_non_witnesses(), edge_idx);
         };
     }
 
+    /**
+     * @brief Extend the edges at edge_idx of a set of multivariates at once, see \ref bb::extend_batch "extend_batch".
+     * The evaluations are gathered column by column, so the extension runs over all columns in its inner loops.
+     */
+    template <typename ExtendedEdge, size_t NUM_COLUMNS, typename Multivariates>
+    static void extend_edge_batch(RefArray<ExtendedEdge, NUM_COLUMNS> extended_edges,
+                                  Multivariates&& multivariates,
+                                  const size_t edge_idx)
+    {
+        ASSERT(multivariates.size() == NUM_COLUMNS);
+        std::array<std::array<FF, NUM_COLUMNS>, 2> edges;
+        for (size_t i = 0; i < NUM_COLUMNS; i++) {
+            edges[0][i] = multivariates[i][edge_idx];
+            edges[1][i] = multivariates[i][edge_idx + 1];
+        }
+        extend_batch<MAX_PARTIAL_RELATION_LENGTH>(edges, extended_edges);
+    }
+
+    /**
+     * @brief Find the rows of the prover polynomials on which at least one of them is nonzero, so that
+     * \ref compute_univariate "compute_univariate" can skip the edges on which all of them vanish.
+     *
+     * @details Structured traces leave most of the rows of the prover polynomials zero: blocks are padded to fixed
+     * sizes, and the polynomials of small circuits are embedded in a large hypercube. An edge whose evaluations are all
+     * zero contributes \f$ F(0,\ldots,0) \f$ to every subrelation, so it can be skipped if and only if every
+     * subrelation vanishes at zero, which we check by evaluating the relations once on a zero edge. Partial evaluation
+     * maps zero rows to zero rows, so the ranges also bound the active rows of the later rounds.
+     *
+     * Must be called before the first round. For ZK Flavors, the masking terms make every edge active, so nothing is
+     * skipped.
+     */
+    template <typename ProverPolynomials>
+    void compute_active_row_ranges(ProverPolynomials& polynomials,
+                                   const bb::RelationParameters<FF>& relation_parameters)
+    {
+        active_row_ranges.clear();
+        if constexpr (Flavor::HasZK) {
+            return;
+        }
+        if (!relations_vanish_at_zero(relation_parameters)) {
+            return;
+        }
+
+        // Mark the edges of the first round. Most active rows have a nonzero value in one of the first columns, so
+        // checking the columns of an edge in turn costs much less than scanning the full table
+        const size_t num_edges = round_size / 2;
+        std::vector<uint8_t> edge_is_active(num_edges, 0);
+        auto columns = polynomials.get_all();
+        parallel_for_heuristic(
+            num_edges,
+            [&](size_t edge) {
+                for (auto& column : columns) {
+                    if (!column[2 * edge].is_zero() || !column[2 * edge + 1].is_zero()) {
+                        edge_is_active[edge] = 1;
+                        return;
+                    }
+                }
+            },
+            thread_heuristics::FF_COPY_COST * 2 * columns.size());
+
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        for (size_t edge = 0; edge < num_edges; edge++) {
+            if (edge_is_active[edge] == 0) {
+                continue;
+            }
+            if (!edge_ranges.empty() && edge - edge_ranges.back().second < MIN_SKIPPED_EDGES) {
+                edge_ranges.back().second = edge + 1;
+            } else {
+                edge_ranges.emplace_back(edge, edge + 1);
+            }
+        }
+        // If there is nothing to skip, keep the plain loop over all edges
+        if (edge_ranges.size() == 1 && edge_ranges[0].first == 0 && edge_ranges[0].second == num_edges) {
+            return;
+        }
+        for (const auto& [start, end] : edge_ranges) {
+            active_row_ranges.emplace_back(2 * start, 2 * end);
+        }
+        // An all-zero table still needs one range, so that it can be told apart from a fully active one
+        if (active_row_ranges.empty()) {
+            active_row_ranges.emplace_back(0, 0);
+        }
+    }
+
+    /**
+     * @brief The ranges of edges of Round \f$ i \f$ that contain an active row. An edge of Round \f$ i \f$ covers
+     * rows \f$ [\ell \cdot 2^{i+1}, (\ell + 1) \cdot 2^{i+1}) \f$ of the prover polynomials.
+     */
+    std::vector<std::pair<size_t, size_t>> get_active_edge_ranges(const size_t round_idx) const
+    {
+        std::vector<std::pair<size_t, size_t>> edge_ranges;
+        if (active_row_ranges.empty()) {
+            edge_ranges.emplace_back(0, round_size / 2);
+            return edge_ranges;
+        }
+        const size_t log_rows_per_edge = round_idx + 1;
+        for (const auto& [start, end] : active_row_ranges) {
+            if (start == end) {
+                continue;
+            }
+            const size_t edge_start = start >> log_rows_per_edge;
+            const size_t edge_end = ((end - 1) >> log_rows_per_edge) + 1;
+            if (!edge_ranges.empty() && edge_start <= edge_ranges.back().second) {
+                edge_ranges.back().second = std::max(edge_ranges.back().second, edge_end);
+            } else {
+                edge_ranges.emplace_back(edge_start, edge_end);
+            }
+        }
+        return edge_ranges;
+    }
+
     /**
      * @brief Return the evaluations of the univariate round polynomials \f$ \tilde{S}_{i} (X_{i}) \f$  at \f$ X_{i } =
      0,\ldots, D \f$. Most likely, \f$ D \f$ is around  \f$ 12 \f$. At the
@@ -170,13 +279,19 @@ template <typename Flavor> class SumcheckProverRound {
 #endif
         BB_OP_COUNT_TIME();
 
+        // Edges on which all polynomials vanish contribute nothing, see compute_active_row_ranges
+        const auto edge_ranges = get_active_edge_ranges(round_idx);
+        size_t num_active_edges = 0;
+        for (const auto& [start, end] : edge_ranges) {
+            num_active_edges += end - start;
+        }
+
         // Determine number of threads for multithreading.
         // Note: Multithreading is "on" for every round but we reduce the number of threads from the max available based
         // on a specified minimum number of iterations per thread. This eventually leads to the use of a single thread.
-        // For now we use a power of 2 number of threads simply to ensure the round size is evenly divided.
+        // The active edges are divided evenly between the threads, wherever they are in the hypercube.
         size_t min_iterations_per_thread = 1 << 6; // min number of iterations for which we'll spin up a unique thread
-        size_t num_threads = bb::calculate_num_threads_pow2(round_size, min_iterations_per_thread);
-        size_t iterations_per_thread = round_size / num_threads; // actual iterations per thread
+        size_t num_threads = bb::calculate_num_threads(2 * num_active_edges, min_iterations_per_thread);
 
         // Construct univariate accumulator containers; one per thread
         std::vector<SumcheckTupleOfTuplesOfUnivariates> thread_univariate_accumulators(num_threads);
@@ -190,24 +305,35 @@ template <typename Flavor> class SumcheckProverRound {
 
         // Accumulate the contribution from each sub-relation accross each edge of the hyper-cube
         parallel_for(num_threads, [&](size_t thread_idx) {
-            size_t start = thread_idx * iterations_per_thread;
-            size_t end = (thread_idx + 1) * iterations_per_thread;
-
-            for (size_t edge_idx = start; edge_idx < end; edge_idx += 2) {
-                if constexpr (!Flavor::HasZK) {
-                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
-                } else {
-                    extend_edges(extended_edges[thread_idx], polynomials, edge_idx, zk_sumcheck_data);
+            // This thread processes the active edges with indices in [start, end), counted across all ranges
+            const size_t start = (thread_idx * num_active_edges) / num_threads;
+            const size_t end = ((thread_idx + 1) * num_active_edges) / num_threads;
+
+            size_t range_offset = 0;
+            for (const auto& [range_start, range_end] : edge_ranges) {
+                const size_t first_edge = range_start + std::max(start, range_offset) - range_offset;
+                range_offset += range_end - range_start;
+                const size_t last_edge = range_end - range_offset + std::min(end, range_offset);
+                for (size_t edge = first_edge; edge < last_edge; edge++) {
+                    const size_t edge_idx = 2 * edge;
+                    if constexpr (!Flavor::HasZK) {
+                        extend_edges(extended_edges[thread_idx], polynomials, edge_idx);
+                    } else {
+                        extend_edges(extended_edges[thread_idx], polynomials, edge_idx, zk_sumcheck_data);
+                    }
+                    // Compute the \f$ \ell \f$-th edge's univariate contribution,
+                    // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for
+                    // \f$ \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$
+                    // (\ell_{i+1},\ldots, \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is
+                    // \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot \beta_{d-1}^{\ell_{d-1}}\f$.
+                    accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
+                                                    extended_edges[thread_idx],
+                                                    relation_parameters,
+                                                    gate_sparators[edge * gate_sparators.periodicity]);
+                }
+                if (range_offset >= end) {
+                    break;
                 }
-                // Compute the \f$ \ell \f$-th edge's univariate contribution,
-                // scale it by the corresponding \f$ pow_{\beta} \f$ contribution and add it to the accumulators for \f$
-                // \tilde{S}^i(X_i) \f$. If \f$ \ell \f$'s binary representation is given by \f$ (\ell_{i+1},\ldots,
-                // \ell_{d-1})\f$, the \f$ pow_{\beta}\f$-contribution is \f$\beta_{i+1}^{\ell_{i+1}} \cdot \ldots \cdot
-                // \beta_{d-1}^{\ell_{d-1}}\f$.
-                accumulate_relation_univariates(thread_univariate_accumulators[thread_idx],
-                                                extended_edges[thread_idx],
-                                                relation_parameters,
-                                                gate_sparators[(edge_idx >> 1) * gate_sparators.periodicity]);
             }
         });
 
@@ -366,18 +492,25 @@ template <typename Flavor> class SumcheckProverRound {
                                          const FF& scaling_factor)
     {
         using Relation = std::tuple_element_t<relation_idx, Relations>;
-        // Check if the relation is skippable to speed up accumulation
-        if constexpr (!isSkippable<Relation, decltype(extended_edges)>) {
-            // If not, accumulate normally
-            Relation::accumulate(
-                std::get<relation_idx>(univariate_accumulators), extended_edges, relation_parameters, scaling_factor);
-        } else {
-            // If so, only compute the contribution if the relation is active
-            if (!Relation::skip(extended_edges)) {
+        {
+            BB_PROFILE_RELATION("sumcheck", Relation);
+            // Check if the relation is skippable to speed up accumulation
+            if constexpr (!isSkippable<Relation, decltype(extended_edges)>) {
+                // If not, accumulate normally
                 Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
                                      extended_edges,
                                      relation_parameters,
                                      scaling_factor);
+            } else {
+                // If so, only compute the contribution if the relation is active
+                if (!Relation::skip(extended_edges)) {
+                    Relation::accumulate(std::get<relation_idx>(univariate_accumulators),
+                                         extended_edges,
+                                         relation_parameters,
+                                         scaling_factor);
+                } else {
+                    BB_PROFILE_RELATION_SKIPPED();
+                }
             }
         }
         // Repeat for the next relation.
@@ -386,6 +519,25 @@ template <typename Flavor> class SumcheckProverRound {
                 univariate_accumulators, extended_edges, relation_parameters, scaling_factor);
         }
     }
+
+    /**
+     * @brief Check that every subrelation vanishes when all the prover polynomials are zero
+     */
+    bool relations_vanish_at_zero(const bb::RelationParameters<FF>& relation_parameters)
+    {
+        ExtendedEdges zero_edges;
+        for (auto& extended_edge : zero_edges.get_all()) {
+            extended_edge = std::remove_reference_t<decltype(extended_edge)>::zero();
+        }
+        SumcheckTupleOfTuplesOfUnivariates accumulators;
+        Utils::zero_univariates(accumulators);
+        accumulate_relation_univariates(accumulators, zero_edges, relation_parameters, FF(1));
+
+        bool vanish = true;
+        auto check_zero = [&]<size_t, size_t, typename Element>(Element& element) { vanish &= element.is_zero(); };
+        Utils::apply_to_tuple_of_tuples(accumulators, check_zero);
+        return vanish;
+    }
 };
 
 /*!\brief Implementation of the Sumcheck Verifier Round
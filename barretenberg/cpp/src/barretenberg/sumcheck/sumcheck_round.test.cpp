@@ -131,3 +131,67 @@ TEST(SumcheckRound, AddTuplesOfTuplesOfUnivariates)
     EXPECT_EQ(std::get<0>(std::get<1>(tuple_of_tuples_1)), expected_sum_2);
     EXPECT_EQ(std::get<1>(std::get<1>(tuple_of_tuples_1)), expected_sum_3);
 }
+
+/**
+ * @brief Check that skipping the edges on which all polynomials vanish does not change the round univariates
+ *
+ */
+TEST(SumcheckRound, SkipInactiveEdges)
+{
+    using Flavor = UltraFlavor;
+    using FF = typename Flavor::FF;
+    using RelationSeparator = typename Flavor::RelationSeparator;
+    const size_t multivariate_d = 8;
+    const size_t multivariate_n = 1 << multivariate_d;
+
+    // Polynomials with random values on two blocks of rows, and zero elsewhere
+    const std::vector<std::pair<size_t, size_t>> blocks{ { 16, 40 }, { 130, 132 } };
+    Flavor::ProverPolynomials full_polynomials;
+    for (auto& poly : full_polynomials.get_all()) {
+        poly = Polynomial<FF>(blocks.back().second - blocks.front().first, multivariate_n, blocks.front().first);
+        for (const auto& [start, end] : blocks) {
+            for (size_t i = start; i < end; i++) {
+                poly.at(i) = FF::random_element();
+            }
+        }
+    }
+
+    auto relation_parameters = RelationParameters<FF>::get_random();
+    RelationSeparator alpha;
+    for (auto& alpha_i : alpha) {
+        alpha_i = FF::random_element();
+    }
+    std::vector<FF> gate_challenges(multivariate_d);
+    for (auto& gate_challenge : gate_challenges) {
+        gate_challenge = FF::random_element();
+    }
+    GateSeparatorPolynomial<FF> gate_separators(gate_challenges, multivariate_d);
+
+    SumcheckProverRound<Flavor> sparse_round(multivariate_n);
+    SumcheckProverRound<Flavor> dense_round(multivariate_n);
+    sparse_round.compute_active_row_ranges(full_polynomials, relation_parameters);
+    EXPECT_EQ(sparse_round.active_row_ranges, blocks);
+
+    auto sparse_univariate =
+        sparse_round.compute_univariate(0, full_polynomials, relation_parameters, gate_separators, alpha);
+    auto dense_univariate =
+        dense_round.compute_univariate(0, full_polynomials, relation_parameters, gate_separators, alpha);
+    EXPECT_EQ(sparse_univariate, dense_univariate);
+
+    // In the second round, the active rows are folded into rows [8, 20) and [65, 66)
+    const FF round_challenge = FF::random_element();
+    Flavor::PartiallyEvaluatedMultivariates partially_evaluated_polynomials(multivariate_n);
+    for (auto [poly, full_poly] : zip_view(partially_evaluated_polynomials.get_all(), full_polynomials.get_all())) {
+        for (size_t i = 0; i < multivariate_n / 2; i++) {
+            poly.at(i) = full_poly[2 * i] + round_challenge * (full_poly[2 * i + 1] - full_poly[2 * i]);
+        }
+    }
+    gate_separators.partially_evaluate(round_challenge);
+    sparse_round.round_size = dense_round.round_size = multivariate_n / 2;
+
+    sparse_univariate = sparse_round.compute_univariate(
+        1, partially_evaluated_polynomials, relation_parameters, gate_separators, alpha);
+    dense_univariate =
+        dense_round.compute_univariate(1, partially_evaluated_polynomials, relation_parameters, gate_separators, alpha);
+    EXPECT_EQ(sparse_univariate, dense_univariate);
+}
@@ -29,7 +29,7 @@ template <IsUltraFlavor Flavor> void DeciderProver_<Flavor>::execute_relation_ch
 {
     using Sumcheck = SumcheckProver<Flavor>;
     size_t polynomial_size = proving_key->proving_key.circuit_size;
-    auto sumcheck = Sumcheck(polynomial_size, transcript);
+    auto sumcheck = Sumcheck(polynomial_size, transcript, num_fused_sumcheck_rounds);
     {
 
 #ifdef TRACY_MEMORY
@@ -46,6 +46,10 @@ template <IsUltraFlavor Flavor> class DeciderProver_ {
 
     SumcheckOutput<Flavor> sumcheck_output;
 
+    // Number of initial sumcheck rounds computed without the book-keeping table, trading some time for peak memory
+    // (see SumcheckProver::FoldedPolynomials)
+    size_t num_fused_sumcheck_rounds = 0;
+
     std::shared_ptr<CommitmentKey> commitment_key;
 
   private:
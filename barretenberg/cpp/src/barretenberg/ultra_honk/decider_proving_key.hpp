@@ -246,6 +246,16 @@ template <IsHonkFlavor Flavor> class DeciderProvingKey_ {
         // Construct and add to proving key the wire, selector and copy constraint polynomials
         Trace::populate(circuit, proving_key, is_structured);
 
+        // Record the populated rows of each block, outside of which the wires of a structured trace are zero
+        if (is_structured) {
+            for (auto& block : circuit.blocks.get()) {
+                if (block.size() > 0) {
+                    proving_key.active_block_ranges.emplace_back(block.trace_offset,
+                                                                 block.trace_offset + block.size());
+                }
+            }
+        }
+
 #ifdef TRACY_MEMORY
         ZoneScopedN("constructing prover instance after trace populate");
 #endif
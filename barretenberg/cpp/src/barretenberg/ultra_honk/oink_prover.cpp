@@ -94,9 +94,9 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
     // We only commit to the fourth wire polynomial after adding memory recordss
     {
         BB_OP_COUNT_TIME_NAME("COMMIT::wires");
-        witness_commitments.w_l = commitment_key->commit(proving_key->proving_key.polynomials.w_l);
-        witness_commitments.w_r = commitment_key->commit(proving_key->proving_key.polynomials.w_r);
-        witness_commitments.w_o = commitment_key->commit(proving_key->proving_key.polynomials.w_o);
+        witness_commitments.w_l = commit_to_wire(proving_key->proving_key.polynomials.w_l);
+        witness_commitments.w_r = commit_to_wire(proving_key->proving_key.polynomials.w_r);
+        witness_commitments.w_o = commit_to_wire(proving_key->proving_key.polynomials.w_o);
     }
 
     auto wire_comms = witness_commitments.get_wires();
@@ -107,14 +107,21 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_wire_commitment
 
     if constexpr (IsGoblinFlavor<Flavor>) {
 
-        // Commit to Goblin ECC op wires
-        for (auto [commitment, polynomial, label] : zip_view(witness_commitments.get_ecc_op_wires(),
-                                                             proving_key->proving_key.polynomials.get_ecc_op_wires(),
-                                                             commitment_labels.get_ecc_op_wires())) {
-            {
-                BB_OP_COUNT_TIME_NAME("COMMIT::ecc_op_wires");
-                commitment = commitment_key->commit(polynomial);
+        // Commit to Goblin ECC op wires. These are only as long as the op queue, so are committed to together.
+        {
+            BB_OP_COUNT_TIME_NAME("COMMIT::ecc_op_wires");
+            std::vector<PolynomialSpan<const FF>> ecc_op_wires;
+            for (auto& polynomial : proving_key->proving_key.polynomials.get_ecc_op_wires()) {
+                ecc_op_wires.push_back(polynomial);
+            }
+            auto ecc_op_wire_commitments = commitment_key->batch_commit(ecc_op_wires);
+            for (auto [commitment, ecc_op_wire_commitment] :
+                 zip_view(witness_commitments.get_ecc_op_wires(), ecc_op_wire_commitments)) {
+                commitment = ecc_op_wire_commitment;
             }
+        }
+        for (auto [commitment, label] :
+             zip_view(witness_commitments.get_ecc_op_wires(), commitment_labels.get_ecc_op_wires())) {
             transcript->send_to_verifier(domain_separator + label, commitment);
         }
 
@@ -151,14 +158,15 @@ template <IsUltraFlavor Flavor> void OinkProver<Flavor>::execute_sorted_list_acc
     // Commit to lookup argument polynomials and the finalized (i.e. with memory records) fourth wire polynomial
     {
         BB_OP_COUNT_TIME_NAME("COMMIT::lookup_counts_tags");
+        // The read counts are small and the read tags are 0 or 1
         witness_commitments.lookup_read_counts =
-            commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_counts);
+            commitment_key->commit_classified(proving_key->proving_key.polynomials.lookup_read_counts);
         witness_commitments.lookup_read_tags =
-            commitment_key->commit(proving_key->proving_key.polynomials.lookup_read_tags);
+            commitment_key->commit_classified(proving_key->proving_key.polynomials.lookup_read_tags);
     }
     {
         BB_OP_COUNT_TIME_NAME("COMMIT::wires");
-        witness_commitments.w_4 = commitment_key->commit(proving_key->proving_key.polynomials.w_4);
+        witness_commitments.w_4 = commit_to_wire(proving_key->proving_key.polynomials.w_4);
     }
 
     transcript->send_to_verifier(domain_separator + commitment_labels.lookup_read_counts,
@@ -234,6 +242,21 @@ template <IsUltraFlavor Flavor> typename Flavor::RelationSeparator OinkProver<Fl
     return alphas;
 }
 
+/**
+ * @brief Commit to a wire polynomial, skipping the padding of each block if the trace is structured
+ * @details Otherwise, wires often hold small values (e.g. range constraint limbs), which commit_classified takes
+ * advantage of.
+ */
+template <IsUltraFlavor Flavor>
+typename Flavor::Commitment OinkProver<Flavor>::commit_to_wire(const typename Flavor::Polynomial& wire)
+{
+    const auto& active_block_ranges = proving_key->proving_key.active_block_ranges;
+    if (!active_block_ranges.empty()) {
+        return commitment_key->commit_structured(wire, active_block_ranges);
+    }
+    return commitment_key->commit_classified(wire);
+}
+
 template class OinkProver<UltraFlavor>;
 template class OinkProver<UltraKeccakFlavor>;
 template class OinkProver<MegaFlavor>;
@@ -65,5 +65,8 @@ template <IsUltraFlavor Flavor> class OinkProver {
     void execute_log_derivative_inverse_round();
     void execute_grand_product_computation_round();
     RelationSeparator generate_alphas_round();
+
+  private:
+    typename Flavor::Commitment commit_to_wire(const typename Flavor::Polynomial& wire);
 };
 } // namespace bb
\ No newline at end of file
@@ -62,8 +62,14 @@ void AvmProver::execute_wire_commitments_round()
     // logderivative phase)
     auto wire_polys = prover_polynomials.get_wires();
     auto labels = commitment_labels.get_wires();
+    std::vector<PolynomialSpan<const FF>> wire_spans;
+    wire_spans.reserve(wire_polys.size());
+    for (auto& poly : wire_polys) {
+        wire_spans.push_back(poly);
+    }
+    auto wire_commitments = commitment_key->batch_commit_sparse(wire_spans);
     for (size_t idx = 0; idx < wire_polys.size(); ++idx) {
-        transcript->send_to_verifier(labels[idx], commitment_key->commit_sparse(wire_polys[idx]));
+        transcript->send_to_verifier(labels[idx], wire_commitments[idx]);
     }
 }
 
@@ -91,8 +97,15 @@ void AvmProver::execute_log_derivative_inverse_round()
 void AvmProver::execute_log_derivative_inverse_commitments_round()
 {
     // Commit to all logderivative inverse polynomials
-    for (auto [commitment, key_poly] : zip_view(witness_commitments.get_derived(), key->get_derived())) {
-        commitment = commitment_key->commit(key_poly);
+    auto derived_polys = key->get_derived();
+    std::vector<PolynomialSpan<const FF>> derived_spans;
+    derived_spans.reserve(derived_polys.size());
+    for (auto& poly : derived_polys) {
+        derived_spans.push_back(poly);
+    }
+    auto derived_commitments = commitment_key->batch_commit(derived_spans);
+    for (auto [commitment, derived_commitment] : zip_view(witness_commitments.get_derived(), derived_commitments)) {
+        commitment = derived_commitment;
     }
 
     // Send all commitments to the verifier
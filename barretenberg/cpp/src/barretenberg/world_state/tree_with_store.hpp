@@ -8,6 +8,7 @@ template <typename Tree> struct TreeWithStore {
     using TreeType = Tree;
     std::unique_ptr<Tree> tree;
     std::unique_ptr<typename Tree::StoreType> store;
+    // Only owned by the canonical fork, other forks share the canonical fork's persisted store
     std::unique_ptr<typename Tree::StoreType::PersistedStoreType> persisted_store;
 
     TreeWithStore(std::unique_ptr<Tree> t,
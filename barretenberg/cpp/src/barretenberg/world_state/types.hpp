@@ -19,6 +19,10 @@ enum MerkleTreeId {
 using TreeStateReference = std::pair<bb::fr, bb::crypto::merkle_tree::index_t>;
 using StateReference = std::unordered_map<MerkleTreeId, TreeStateReference>;
 
+using ForkId = uint64_t;
+// The fork that is synced with the chain, all other forks are created from it
+const ForkId CANONICAL_FORK_ID = 0;
+
 struct WorldStateRevision {
     struct FinalisedBlock {
         uint32_t block;
@@ -30,9 +34,17 @@ struct WorldStateRevision {
 
     using Revision = std::variant<WorldStateRevision::FinalisedBlock, WorldStateRevision::CurrentState>;
     Revision inner;
-
-    static WorldStateRevision committed() { return { CurrentState{ false } }; }
-    static WorldStateRevision uncommitted() { return { CurrentState{ true } }; }
+    // The fork to be read. A fork reads the committed state as of its creation
+    ForkId forkId{ CANONICAL_FORK_ID };
+
+    static WorldStateRevision committed(ForkId fork_id = CANONICAL_FORK_ID)
+    {
+        return { CurrentState{ false }, fork_id };
+    }
+    static WorldStateRevision uncommitted(ForkId fork_id = CANONICAL_FORK_ID)
+    {
+        return { CurrentState{ true }, fork_id };
+    }
     static WorldStateRevision finalised_block(uint32_t block_number) { return { FinalisedBlock{ block_number } }; }
 };
 } // namespace bb::world_state
@@ -8,6 +8,7 @@
 #include "barretenberg/crypto/merkle_tree/signal.hpp"
 #include "barretenberg/world_state/tree_with_store.hpp"
 #include "barretenberg/world_state/types.hpp"
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
@@ -19,95 +20,128 @@
 namespace bb::world_state {
 
 const uint WORLD_STATE_MAX_DB_COUNT = 16;
+const uint WORLD_STATE_MAX_FORK_COUNT = 128;
+const index_t INDEXED_TREE_INITIAL_SIZE = 128;
 
 using namespace bb::crypto::merkle_tree;
 
-WorldState::WorldState(uint threads, const std::string& data_dir, uint map_size_kb)
-    : _workers(threads)
+WorldState::WorldState(uint threads,
+                       const std::string& data_dir,
+                       uint map_size_kb,
+                       uint64_t historic_blocks_to_retain)
+    : _historic_blocks_to_retain(historic_blocks_to_retain)
+    , _workers(threads)
 {
-    _lmdb_env = std::make_unique<LMDBEnvironment>(data_dir, map_size_kb, WORLD_STATE_MAX_DB_COUNT, threads);
+    // Each fork holds a reader for its snapshot
+    _lmdb_env = std::make_unique<LMDBEnvironment>(
+        data_dir, map_size_kb, WORLD_STATE_MAX_DB_COUNT, threads + WORLD_STATE_MAX_FORK_COUNT);
+    _canonical_fork = std::make_shared<Fork>();
+    _canonical_fork->_forkId = CANONICAL_FORK_ID;
+    _canonical_fork->_commitCount = _commit_count;
+    auto& trees = _canonical_fork->_trees;
 
     {
         const auto* name = "nullifier_tree";
         auto lmdb_store = std::make_unique<LMDBStore>(*_lmdb_env, name, false, false, integer_key_cmp);
-        auto store = std::make_unique<NullifierStore>(name, NULLIFIER_TREE_HEIGHT, *lmdb_store);
-        auto tree = std::make_unique<NullifierTree>(*store, _workers, 128);
-        _trees.insert(
+        auto store = std::make_unique<NullifierStore>(
+            name, NULLIFIER_TREE_HEIGHT, *lmdb_store, _historic_blocks_to_retain);
+        auto tree = std::make_unique<NullifierTree>(*store, _workers, INDEXED_TREE_INITIAL_SIZE);
+        trees.insert(
             { MerkleTreeId::NULLIFIER_TREE, TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
     }
 
     {
         const auto* name = "note_hash_tree";
         auto lmdb_store = std::make_unique<LMDBStore>(*_lmdb_env, name, false, false, integer_key_cmp);
-        auto store = std::make_unique<FrStore>(name, NOTE_HASH_TREE_HEIGHT, *lmdb_store);
+        auto store =
+            std::make_unique<FrStore>(name, NOTE_HASH_TREE_HEIGHT, *lmdb_store, _historic_blocks_to_retain);
         auto tree = std::make_unique<FrTree>(*store, this->_workers);
-        _trees.insert(
+        trees.insert(
             { MerkleTreeId::NOTE_HASH_TREE, TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
     }
 
     {
         const auto* name = "public_data_tree";
         auto lmdb_store = std::make_unique<LMDBStore>(*_lmdb_env, name, false, false, integer_key_cmp);
-        auto store = std::make_unique<PublicDataStore>(name, PUBLIC_DATA_TREE_HEIGHT, *lmdb_store);
-        auto tree = std::make_unique<PublicDataTree>(*store, this->_workers, 128);
-        _trees.insert({ MerkleTreeId::PUBLIC_DATA_TREE,
-                        TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
+        auto store = std::make_unique<PublicDataStore>(
+            name, PUBLIC_DATA_TREE_HEIGHT, *lmdb_store, _historic_blocks_to_retain);
+        auto tree = std::make_unique<PublicDataTree>(*store, this->_workers, INDEXED_TREE_INITIAL_SIZE);
+        trees.insert({ MerkleTreeId::PUBLIC_DATA_TREE,
+                       TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
     }
 
     {
         const auto* name = "message_tree";
         auto lmdb_store = std::make_unique<LMDBStore>(*_lmdb_env, name, false, false, integer_key_cmp);
-        auto store = std::make_unique<FrStore>(name, L1_TO_L2_MSG_TREE_HEIGHT, *lmdb_store);
+        auto store =
+            std::make_unique<FrStore>(name, L1_TO_L2_MSG_TREE_HEIGHT, *lmdb_store, _historic_blocks_to_retain);
         auto tree = std::make_unique<FrTree>(*store, this->_workers);
-        _trees.insert({ MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
-                        TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
+        trees.insert({ MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                       TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
     }
 
     {
         const auto* name = "archive_tree";
         auto lmdb_store = std::make_unique<LMDBStore>(*_lmdb_env, name, false, false, integer_key_cmp);
-        auto store = std::make_unique<FrStore>(name, ARCHIVE_TREE_HEIGHT, *lmdb_store);
+        auto store = std::make_unique<FrStore>(name, ARCHIVE_TREE_HEIGHT, *lmdb_store, _historic_blocks_to_retain);
         auto tree = std::make_unique<FrTree>(*store, this->_workers);
-        _trees.insert(
+        trees.insert(
             { MerkleTreeId::ARCHIVE, TreeWithStore(std::move(tree), std::move(store), std::move(lmdb_store)) });
     }
 }
 
 TreeMetaResponse WorldState::get_tree_info(WorldStateRevision revision, MerkleTreeId tree_id) const
 {
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
     return std::visit(
         [=](auto&& wrapper) {
             Signal signal(1);
-            TreeMetaResponse response;
+            TypedResponse<TreeMetaResponse> response;
 
             auto callback = [&](const TypedResponse<TreeMetaResponse>& meta) {
-                response = meta.inner;
+                response = meta;
                 signal.signal_level(0);
             };
 
-            wrapper.tree->get_meta_data(include_uncommitted(revision), callback);
+            if (auto block = historic_block(revision)) {
+                wrapper.tree->get_meta_data_at_block(block.value(), callback);
+            } else {
+                wrapper.tree->get_meta_data(include_uncommitted(revision), callback);
+            }
             signal.wait_for_level(0);
 
-            return response;
+            if (!response.success) {
+                throw std::runtime_error(response.message);
+            }
+            return response.inner;
         },
-        _trees.at(tree_id));
+        fork->_trees.at(tree_id));
 }
 
 StateReference WorldState::get_state_reference(WorldStateRevision revision) const
 {
-    Signal signal(static_cast<uint32_t>(_trees.size()));
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+    Signal signal(static_cast<uint32_t>(fork->_trees.size()));
     StateReference state_reference;
 
     bool uncommitted = include_uncommitted(revision);
+    std::optional<index_t> block = historic_block(revision);
 
-    for (const auto& [id, tree] : _trees) {
+    for (const auto& [id, tree] : fork->_trees) {
         auto callback = [&](const TypedResponse<TreeMetaResponse>& meta) {
             std::lock_guard<std::mutex> lock(state_ref_mutex);
             state_reference.insert({ id, { meta.inner.root, meta.inner.size } });
             signal.signal_decrement();
         };
-        std::visit([&callback, uncommitted](auto&& wrapper) { wrapper.tree->get_meta_data(uncommitted, callback); },
-                   tree);
+        std::visit(
+            [&callback, uncommitted, block](auto&& wrapper) {
+                if (block.has_value()) {
+                    wrapper.tree->get_meta_data_at_block(block.value(), callback);
+                } else {
+                    wrapper.tree->get_meta_data(uncommitted, callback);
+                }
+            },
+            tree);
     }
 
     signal.wait_for_level(0);
@@ -119,27 +153,76 @@ fr_sibling_path WorldState::get_sibling_path(WorldStateRevision revision,
                                              index_t leaf_index) const
 {
     bool uncommited = include_uncommitted(revision);
+    std::optional<index_t> block = historic_block(revision);
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
     return std::visit(
-        [leaf_index, uncommited](auto&& wrapper) {
+        [leaf_index, uncommited, block](auto&& wrapper) {
             Signal signal(1);
             fr_sibling_path path;
+            bool success = true;
+            std::string error_msg;
 
-            auto callback = [&signal, &path](const TypedResponse<GetSiblingPathResponse>& response) {
+            auto callback = [&](const TypedResponse<GetSiblingPathResponse>& response) {
+                success = response.success;
+                error_msg = response.message;
                 path = response.inner.path;
                 signal.signal_level(0);
             };
 
-            wrapper.tree->get_sibling_path(leaf_index, callback, uncommited);
+            if (block.has_value()) {
+                wrapper.tree->get_sibling_path_at_block(leaf_index, block.value(), callback);
+            } else {
+                wrapper.tree->get_sibling_path(leaf_index, callback, uncommited);
+            }
             signal.wait_for_level(0);
 
+            if (!success) {
+                throw std::runtime_error(error_msg);
+            }
+
             return path;
         },
-        _trees.at(tree_id));
+        fork->_trees.at(tree_id));
 }
 
-void WorldState::update_public_data(const PublicDataLeafValue& new_value)
+std::vector<fr_sibling_path> WorldState::get_sibling_paths(WorldStateRevision revision,
+                                                           MerkleTreeId tree_id,
+                                                           const std::vector<index_t>& leaf_indices) const
 {
-    if (const auto* wrapper = std::get_if<TreeWithStore<PublicDataTree>>(&_trees.at(MerkleTreeId::PUBLIC_DATA_TREE))) {
+    bool uncommited = include_uncommitted(revision);
+    std::optional<index_t> block = historic_block(revision);
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+    return std::visit(
+        [&leaf_indices, uncommited, block](auto&& wrapper) {
+            Signal signal(1);
+            TypedResponse<GetSiblingPathsResponse> response;
+
+            auto callback = [&](const TypedResponse<GetSiblingPathsResponse>& paths) {
+                response = paths;
+                signal.signal_level(0);
+            };
+
+            if (block.has_value()) {
+                wrapper.tree->get_sibling_paths_at_block(leaf_indices, block.value(), callback);
+            } else {
+                wrapper.tree->get_sibling_paths(leaf_indices, uncommited, callback);
+            }
+            signal.wait_for_level(0);
+
+            if (!response.success) {
+                throw std::runtime_error(response.message);
+            }
+
+            return response.inner.paths;
+        },
+        fork->_trees.at(tree_id));
+}
+
+void WorldState::update_public_data(const PublicDataLeafValue& new_value, ForkId fork_id)
+{
+    Fork::SharedPtr fork = retrieve_fork(fork_id);
+    if (const auto* wrapper =
+            std::get_if<TreeWithStore<PublicDataTree>>(&fork->_trees.at(MerkleTreeId::PUBLIC_DATA_TREE))) {
         Signal signal;
         wrapper->tree->add_or_update_value(new_value, [&signal](const auto&) { signal.signal_level(0); });
         signal.wait_for_level();
@@ -150,26 +233,182 @@ void WorldState::update_public_data(const PublicDataLeafValue& new_value)
 
 void WorldState::commit()
 {
-    // TODO (alexg) should this lock _all_ the trees until they are all committed?
-    // otherwise another request could come in to modify one of the trees
-    // or reads would give inconsistent results
-    Signal signal(static_cast<uint32_t>(_trees.size()));
-    for (auto& [id, tree] : _trees) {
+    std::lock_guard<std::mutex> lock(_commit_mutex);
+    commit_trees(*_canonical_fork);
+    ++_commit_count;
+}
+
+void WorldState::rollback()
+{
+    rollback_trees(*_canonical_fork);
+}
+
+ForkId WorldState::create_fork()
+{
+    auto check_fork_count = [this]() {
+        if (_forks.size() >= WORLD_STATE_MAX_FORK_COUNT) {
+            throw std::runtime_error("Unable to create a fork, the maximum of " +
+                                     std::to_string(WORLD_STATE_MAX_FORK_COUNT) + " forks already exist");
+        }
+    };
+    ForkId fork_id = CANONICAL_FORK_ID;
+    {
+        std::lock_guard<std::mutex> lock(_forks_mutex);
+        check_fork_count();
+        fork_id = _next_fork_id++;
+    }
+    Fork::SharedPtr fork = create_new_fork(fork_id);
+    {
+        // Forks created concurrently may have reached the limit in the meantime
+        std::lock_guard<std::mutex> lock(_forks_mutex);
+        check_fork_count();
+        _forks[fork_id] = fork;
+    }
+    return fork_id;
+}
+
+void WorldState::delete_fork(ForkId fork_id)
+{
+    if (fork_id == CANONICAL_FORK_ID) {
+        throw std::runtime_error("Unable to delete the canonical fork");
+    }
+    // The fork is destroyed once any in-flight operations release their references to it
+    std::lock_guard<std::mutex> lock(_forks_mutex);
+    if (_forks.erase(fork_id) == 0) {
+        throw std::runtime_error("Fork " + std::to_string(fork_id) + " not found");
+    }
+}
+
+void WorldState::commit_fork(ForkId fork_id)
+{
+    if (fork_id == CANONICAL_FORK_ID) {
+        commit();
+        return;
+    }
+    Fork::SharedPtr fork = retrieve_fork(fork_id);
+    {
+        std::lock_guard<std::mutex> lock(_commit_mutex);
+        if (fork->_commitCount != _commit_count) {
+            throw std::runtime_error("Fork " + std::to_string(fork_id) +
+                                     " is not based on the latest committed state");
+        }
+        commit_trees(*fork);
+        ++_commit_count;
+        // The canonical state's uncommitted changes were made on top of the previous block
+        rollback_trees(*_canonical_fork);
+    }
+    delete_fork(fork_id);
+}
+
+Fork::SharedPtr WorldState::retrieve_fork(ForkId fork_id) const
+{
+    if (fork_id == CANONICAL_FORK_ID) {
+        return _canonical_fork;
+    }
+    std::lock_guard<std::mutex> lock(_forks_mutex);
+    auto it = _forks.find(fork_id);
+    if (it == _forks.end()) {
+        throw std::runtime_error("Fork " + std::to_string(fork_id) + " not found");
+    }
+    return it->second;
+}
+
+Fork::SharedPtr WorldState::create_new_fork(ForkId fork_id)
+{
+    // Hold the commit lock so that the fork's trees are all based on the same committed state
+    std::lock_guard<std::mutex> lock(_commit_mutex);
+    auto fork = std::make_shared<Fork>();
+    fork->_forkId = fork_id;
+    fork->_commitCount = _commit_count;
+    // All of the fork's stores read through a single snapshot. The persisted stores share an environment, so it can be
+    // taken through any one of them
+    fork->_snapshot = std::visit([](auto&& wrapper) { return wrapper.persisted_store->create_read_transaction(); },
+                                 _canonical_fork->_trees.begin()->second);
+    for (const auto& [id, canonical] : _canonical_fork->_trees) {
+        std::visit(
+            [&](auto&& wrapper) {
+                using TreeType = typename std::decay_t<decltype(wrapper)>::TreeType;
+                using StoreType = typename TreeType::StoreType;
+                // The fork's store shares the canonical persisted store, so only needs to read its meta data. It also
+                // shares the canonical store's cache of committed nodes, which bounds the memory used by all forks
+                auto store = std::make_unique<StoreType>(wrapper.store->get_name(),
+                                                         wrapper.store->get_depth(),
+                                                         *wrapper.persisted_store,
+                                                         _historic_blocks_to_retain,
+                                                         fork->_snapshot.get(),
+                                                         wrapper.store->get_committed_node_cache());
+                std::unique_ptr<TreeType> tree;
+                if constexpr (std::is_same_v<TreeType, FrTree>) {
+                    tree = std::make_unique<TreeType>(*store, _workers);
+                } else {
+                    tree = std::make_unique<TreeType>(*store, _workers, INDEXED_TREE_INITIAL_SIZE);
+                }
+                fork->_trees.insert({ id, TreeWithStore<TreeType>(std::move(tree), std::move(store), nullptr) });
+            },
+            canonical);
+    }
+    return fork;
+}
+
+void WorldState::commit_trees(Fork& fork)
+{
+    // The commits of the trees are prepared concurrently and then all written in a single write transaction, so the
+    // persisted trees are always at the same block. No tree's state is modified until that transaction has been
+    // committed, so if any part of the commit fails every tree retains its uncommitted state
+    std::vector<std::function<void(LMDBWriteTransaction&)>> writes(fork._trees.size());
+    std::vector<std::function<void()>> completions(fork._trees.size());
+    Signal signal(static_cast<uint32_t>(fork._trees.size()));
+    std::mutex error_mutex;
+    std::string error_msg;
+    size_t i = 0;
+    for (auto& [id, tree] : fork._trees) {
         std::visit(
-            [&signal](auto&& wrapper) { wrapper.tree->commit([&](const Response&) { signal.signal_decrement(); }); },
+            [&, i](auto&& wrapper) {
+                auto* store = wrapper.store.get();
+                _workers.enqueue([&, i, store]() {
+                    try {
+                        std::shared_ptr commit = store->prepare_commit(_workers);
+                        writes[i] = [store, commit](LMDBWriteTransaction& tx) { store->write_commit(*commit, tx); };
+                        completions[i] = [store, commit]() { store->complete_commit(*commit); };
+                    } catch (std::exception& e) {
+                        std::lock_guard<std::mutex> lock(error_mutex);
+                        error_msg = e.what();
+                    }
+                    signal.signal_decrement();
+                });
+            },
             tree);
+        ++i;
     }
 
     signal.wait_for_level(0);
+
+    if (!error_msg.empty()) {
+        throw std::runtime_error(error_msg);
+    }
+
+    LMDBWriteTransaction::Ptr tx = create_write_transaction();
+    try {
+        for (auto& write : writes) {
+            write(*tx);
+        }
+        tx->commit();
+    } catch (std::exception& e) {
+        tx->try_abort();
+        throw;
+    }
+    for (auto& complete : completions) {
+        complete();
+    }
 }
 
-void WorldState::rollback()
+void WorldState::rollback_trees(Fork& fork)
 {
     // TODO (alexg) should this lock _all_ the trees until they are all committed?
     // otherwise another request could come in to modify one of the trees
     // or reads would give inconsistent results
-    Signal signal(static_cast<uint32_t>(_trees.size()));
-    for (auto& [id, tree] : _trees) {
+    Signal signal(static_cast<uint32_t>(fork._trees.size()));
+    for (auto& [id, tree] : fork._trees) {
         std::visit(
             [&signal](auto&& wrapper) {
                 wrapper.tree->rollback([&signal](const Response&) { signal.signal_decrement(); });
@@ -179,6 +418,23 @@ void WorldState::rollback()
     signal.wait_for_level();
 }
 
+StateReference WorldState::apply_block(fr block_hash,
+                                       const std::vector<bb::fr>& notes,
+                                       const std::vector<bb::fr>& l1_to_l2_messages,
+                                       const std::vector<NullifierLeafValue>& nullifiers,
+                                       const std::vector<std::vector<PublicDataLeafValue>>& public_writes)
+{
+    rollback();
+    try {
+        apply_side_effects(*_canonical_fork, block_hash, notes, l1_to_l2_messages, nullifiers, public_writes);
+        commit();
+    } catch (std::exception&) {
+        rollback();
+        throw;
+    }
+    return get_state_reference(WorldStateRevision::committed());
+}
+
 bool WorldState::sync_block(StateReference& block_state_ref,
                             fr block_hash,
                             const std::vector<bb::fr>& notes,
@@ -194,38 +450,71 @@ bool WorldState::sync_block(StateReference& block_state_ref,
     }
 
     rollback();
+    apply_side_effects(*_canonical_fork, block_hash, notes, l1_to_l2_messages, nullifiers, public_writes);
+
+    current_state = get_state_reference(WorldStateRevision::uncommitted());
+    if (block_state_matches_world_state(block_state_ref, current_state)) {
+        commit();
+        return false;
+    }
+
+    // Don't leave the side effects of a block that doesn't match its state reference to be committed later
+    rollback();
+    throw std::runtime_error("Block state does not match world state");
+}
 
+void WorldState::apply_side_effects(Fork& fork,
+                                    fr block_hash,
+                                    const std::vector<bb::fr>& notes,
+                                    const std::vector<bb::fr>& l1_to_l2_messages,
+                                    const std::vector<NullifierLeafValue>& nullifiers,
+                                    const std::vector<std::vector<PublicDataLeafValue>>& public_writes)
+{
     // the public data tree gets updated once per batch and every other gets one update
-    Signal signal(static_cast<uint32_t>(_trees.size()));
-    auto decr = [&signal](const auto&) { signal.signal_decrement(); };
+    auto& trees = fork._trees;
+    Signal signal(static_cast<uint32_t>(trees.size()));
+    std::mutex error_mutex;
+    std::string error_msg;
+    auto decr = [&](const auto& response) {
+        if (!response.success) {
+            std::lock_guard<std::mutex> lock(error_mutex);
+            error_msg = response.message;
+        }
+        signal.signal_decrement();
+    };
 
     {
-        auto& wrapper = std::get<TreeWithStore<NullifierTree>>(_trees.at(MerkleTreeId::NULLIFIER_TREE));
+        auto& wrapper = std::get<TreeWithStore<NullifierTree>>(trees.at(MerkleTreeId::NULLIFIER_TREE));
         wrapper.tree->add_or_update_values(nullifiers, 0, decr);
     }
 
     {
-        auto& wrapper = std::get<TreeWithStore<FrTree>>(_trees.at(MerkleTreeId::NOTE_HASH_TREE));
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(trees.at(MerkleTreeId::NOTE_HASH_TREE));
         wrapper.tree->add_values(notes, decr);
     }
 
     {
-        auto& wrapper = std::get<TreeWithStore<FrTree>>(_trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(trees.at(MerkleTreeId::L1_TO_L2_MESSAGE_TREE));
         wrapper.tree->add_values(l1_to_l2_messages, decr);
     }
 
     {
-        auto& wrapper = std::get<TreeWithStore<FrTree>>(_trees.at(MerkleTreeId::ARCHIVE));
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(trees.at(MerkleTreeId::ARCHIVE));
         wrapper.tree->add_value(block_hash, decr);
     }
 
     {
-        auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(_trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
+        auto& wrapper = std::get<TreeWithStore<PublicDataTree>>(trees.at(MerkleTreeId::PUBLIC_DATA_TREE));
         for (const auto& batch : public_writes) {
             Signal batch_signal(1);
             // TODO (alexg) should trees serialize writes internally or should we do it here?
-            wrapper.tree->add_or_update_values(
-                batch, 0, [&batch_signal](const auto&) { batch_signal.signal_level(0); });
+            wrapper.tree->add_or_update_values(batch, 0, [&](const auto& response) {
+                if (!response.success) {
+                    std::lock_guard<std::mutex> lock(error_mutex);
+                    error_msg = response.message;
+                }
+                batch_signal.signal_level(0);
+            });
             batch_signal.wait_for_level(0);
         }
 
@@ -234,21 +523,16 @@ bool WorldState::sync_block(StateReference& block_state_ref,
 
     signal.wait_for_level();
 
-    current_state = get_state_reference(WorldStateRevision::uncommitted());
-    if (block_state_matches_world_state(block_state_ref, current_state)) {
-        commit();
-        return false;
+    if (!error_msg.empty()) {
+        throw std::runtime_error(error_msg);
     }
-
-    // TODO (alexg) should we rollback here?
-    // Potentiall not since all the changes exist only in-memory and this error will cause the process to die
-    throw std::runtime_error("Block state does not match world state");
 }
 
 std::pair<bool, index_t> WorldState::find_low_leaf_index(const WorldStateRevision revision,
                                                          MerkleTreeId tree_id,
                                                          fr leaf_key) const
 {
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
     Signal signal;
     std::pair<bool, index_t> low_leaf_info;
     auto callback = [&signal, &low_leaf_info](const TypedResponse<std::pair<bool, index_t>>& response) {
@@ -256,10 +540,19 @@ std::pair<bool, index_t> WorldState::find_low_leaf_index(const WorldStateRevisio
         signal.signal_level();
     };
 
-    if (const auto* wrapper = std::get_if<TreeWithStore<NullifierTree>>(&_trees.at(tree_id))) {
-        wrapper->tree->find_low_leaf(leaf_key, include_uncommitted(revision), callback);
-    } else if (const auto* wrapper = std::get_if<TreeWithStore<PublicDataTree>>(&_trees.at(tree_id))) {
-        wrapper->tree->find_low_leaf(leaf_key, include_uncommitted(revision), callback);
+    std::optional<index_t> block = historic_block(revision);
+    auto find = [&](const auto* wrapper) {
+        if (block.has_value()) {
+            wrapper->tree->find_low_leaf_at_block(leaf_key, block.value(), callback);
+        } else {
+            wrapper->tree->find_low_leaf(leaf_key, include_uncommitted(revision), callback);
+        }
+    };
+
+    if (const auto* wrapper = std::get_if<TreeWithStore<NullifierTree>>(&fork->_trees.at(tree_id))) {
+        find(wrapper);
+    } else if (const auto* wrapper = std::get_if<TreeWithStore<PublicDataTree>>(&fork->_trees.at(tree_id))) {
+        find(wrapper);
     } else {
         throw std::runtime_error("Invalid tree type for find_low_leaf");
     }
@@ -268,9 +561,61 @@ std::pair<bool, index_t> WorldState::find_low_leaf_index(const WorldStateRevisio
     return low_leaf_info;
 }
 
+std::vector<std::pair<bool, index_t>> WorldState::find_low_leaf_indices(const WorldStateRevision revision,
+                                                                        MerkleTreeId tree_id,
+                                                                        const std::vector<fr>& leaf_keys) const
+{
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
+    Signal signal;
+    TypedResponse<FindLowLeavesResponse> response;
+    auto callback = [&signal, &response](const TypedResponse<FindLowLeavesResponse>& resp) {
+        response = resp;
+        signal.signal_level();
+    };
+
+    std::optional<index_t> block = historic_block(revision);
+    auto find = [&](const auto* wrapper) {
+        if (block.has_value()) {
+            wrapper->tree->find_low_leaves_at_block(leaf_keys, block.value(), callback);
+        } else {
+            wrapper->tree->find_low_leaves(leaf_keys, include_uncommitted(revision), callback);
+        }
+    };
+
+    if (const auto* wrapper = std::get_if<TreeWithStore<NullifierTree>>(&fork->_trees.at(tree_id))) {
+        find(wrapper);
+    } else if (const auto* wrapper = std::get_if<TreeWithStore<PublicDataTree>>(&fork->_trees.at(tree_id))) {
+        find(wrapper);
+    } else {
+        throw std::runtime_error("Invalid tree type for find_low_leaf");
+    }
+
+    signal.wait_for_level();
+    if (!response.success) {
+        throw std::runtime_error(response.message);
+    }
+    return response.inner.low_leaves;
+}
+
+LMDBWriteTransaction::Ptr WorldState::create_write_transaction() const
+{
+    // A write transaction can write to any of the environment's databases, the one it is created against is arbitrary
+    return std::visit([](auto&& wrapper) { return wrapper.persisted_store->create_write_transaction(); },
+                      _canonical_fork->_trees.at(MerkleTreeId::ARCHIVE));
+}
+
 bool WorldState::include_uncommitted(WorldStateRevision rev)
 {
-    return std::get<WorldStateRevision::CurrentState>(rev.inner).uncommitted;
+    const auto* current = std::get_if<WorldStateRevision::CurrentState>(&rev.inner);
+    return current != nullptr && current->uncommitted;
+}
+
+std::optional<index_t> WorldState::historic_block(WorldStateRevision rev)
+{
+    if (const auto* finalised = std::get_if<WorldStateRevision::FinalisedBlock>(&rev.inner)) {
+        return finalised->block;
+    }
+    return std::nullopt;
 }
 
 bool WorldState::block_state_matches_world_state(const StateReference& block_state_ref,
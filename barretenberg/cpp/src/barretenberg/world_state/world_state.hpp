@@ -19,6 +19,8 @@
 #include <algorithm>
 #include <exception>
 #include <iterator>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <stdexcept>
 #include <type_traits>
@@ -44,6 +46,22 @@ using PublicDataTree = crypto::merkle_tree::IndexedTree<PublicDataStore, HashPol
 
 using Tree = std::variant<TreeWithStore<FrTree>, TreeWithStore<NullifierTree>, TreeWithStore<PublicDataTree>>;
 
+/**
+ * @brief A full set of trees on top of the committed world state. Each fork has its own uncommitted state.
+ * Other than the canonical fork, a fork reads the committed state through a snapshot taken when it was created, so is
+ * unaffected by any subsequent commits. The snapshot holds a read transaction, so the database can't reclaim the space
+ * of anything committed since until the fork is deleted.
+ */
+struct Fork {
+    using SharedPtr = std::shared_ptr<Fork>;
+    ForkId _forkId;
+    // The number of commits made to the world state at the point the fork was created
+    uint64_t _commitCount;
+    // Declared before the trees so that it outlives their stores
+    crypto::merkle_tree::LMDBReadTransaction::Ptr _snapshot;
+    std::unordered_map<MerkleTreeId, Tree> _trees;
+};
+
 template <typename LeafValueType> struct BatchInsertionResult {
     std::vector<crypto::merkle_tree::LowLeafWitnessData<LeafValueType>> low_leaf_witness_data;
     std::vector<std::pair<LeafValueType, size_t>> sorted_leaves;
@@ -58,9 +76,15 @@ const uint PUBLIC_DATA_TREE_HEIGHT = 40;
 const uint L1_TO_L2_MSG_TREE_HEIGHT = 16;
 const uint ARCHIVE_TREE_HEIGHT = 16;
 
+// The number of blocks of history retained by default, allowing queries against WorldStateRevision::FinalisedBlock
+const uint64_t DEFAULT_HISTORIC_BLOCKS_TO_RETAIN = 64;
+
 class WorldState {
   public:
-    WorldState(uint threads, const std::string& data_dir, uint map_size_kb);
+    WorldState(uint threads,
+               const std::string& data_dir,
+               uint map_size_kb,
+               uint64_t historic_blocks_to_retain = DEFAULT_HISTORIC_BLOCKS_TO_RETAIN);
 
     /**
      * @brief Get tree metadata for a particular tree
@@ -91,6 +115,18 @@ class WorldState {
                                                           MerkleTreeId tree_id,
                                                           index_t leaf_index) const;
 
+    /**
+     * @brief Get the sibling paths for a set of leaves in a tree
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_indices The indices of the leaves
+     * @return std::vector<crypto::merkle_tree::fr_sibling_path> The sibling paths, in the order of the indices
+     */
+    std::vector<crypto::merkle_tree::fr_sibling_path> get_sibling_paths(WorldStateRevision revision,
+                                                                        MerkleTreeId tree_id,
+                                                                        const std::vector<index_t>& leaf_indices) const;
+
     /**
      * @brief Get the leaf preimage object
      *
@@ -128,6 +164,18 @@ class WorldState {
      */
     std::pair<bool, index_t> find_low_leaf_index(WorldStateRevision revision, MerkleTreeId tree_id, fr leaf_key) const;
 
+    /**
+     * @brief Finds the low leaf for each of a set of keys, see find_low_leaf_index
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaf_keys The leaves to find the predecessors of
+     * @return std::vector<std::pair<bool, index_t>> The low leaf of each key, in the order of the keys
+     */
+    std::vector<std::pair<bool, index_t>> find_low_leaf_indices(WorldStateRevision revision,
+                                                                MerkleTreeId tree_id,
+                                                                const std::vector<fr>& leaf_keys) const;
+
     /**
      * @brief Finds the index of a leaf in a tree
      *
@@ -143,14 +191,29 @@ class WorldState {
                                            const T& leaf,
                                            index_t start_index = 0) const;
 
+    /**
+     * @brief Finds the index of each of a set of leaves in a tree
+     *
+     * @param revision The revision to query
+     * @param tree_id The ID of the tree
+     * @param leaves The leaves to find
+     * @return std::vector<std::optional<index_t>> The index of each leaf, in the order of the leaves
+     */
+    template <typename T>
+    std::vector<std::optional<index_t>> find_leaf_indices(WorldStateRevision revision,
+                                                          MerkleTreeId tree_id,
+                                                          const std::vector<T>& leaves) const;
+
     /**
      * @brief Appends a set of leaves to an existing Merkle Tree.
      *
      * @tparam T The type of the leaves.
      * @param tree_id The ID of the Merkle Tree.
      * @param leaves The leaves to append.
+     * @param fork_id The fork to modify
      */
-    template <typename T> void append_leaves(MerkleTreeId tree_id, const std::vector<T>& leaves);
+    template <typename T>
+    void append_leaves(MerkleTreeId tree_id, const std::vector<T>& leaves, ForkId fork_id = CANONICAL_FORK_ID);
 
     /**
      * @brief Batch inserts a set of leaves into an indexed Merkle Tree.
@@ -158,19 +221,23 @@ class WorldState {
      * @tparam T The type of the leaves.
      * @param tree_id The ID of the Merkle Tree.
      * @param leaves The leaves to insert.
+     * @param fork_id The fork to modify
      * @return BatchInsertionResult<T>
      */
     template <typename T>
     BatchInsertionResult<T> batch_insert_indexed_leaves(MerkleTreeId tree_id,
                                                         const std::vector<T>& leaves,
-                                                        uint32_t subtree_depth);
+                                                        uint32_t subtree_depth,
+                                                        ForkId fork_id = CANONICAL_FORK_ID);
 
     /**
      * @brief Updates a leaf in an existing Merkle Tree.
      *
      * @param new_value The new value of the leaf.
+     * @param fork_id The fork to modify
      */
-    void update_public_data(const crypto::merkle_tree::PublicDataLeafValue& new_value);
+    void update_public_data(const crypto::merkle_tree::PublicDataLeafValue& new_value,
+                            ForkId fork_id = CANONICAL_FORK_ID);
 
     /**
      * @brief Commits the current state of the world state.
@@ -182,6 +249,44 @@ class WorldState {
      */
     void rollback();
 
+    /**
+     * @brief Creates a fork of the world state on top of the latest committed state. The fork can be modified and
+     * queried independently of, and concurrently with, the canonical state and any other fork. Its view of the
+     * committed state is unaffected by later commits. Throws if the maximum number of forks already exist.
+     *
+     * @return ForkId The ID of the new fork
+     */
+    ForkId create_fork();
+
+    /**
+     * @brief Deletes a fork, discarding any uncommitted changes made to it.
+     *
+     * @param fork_id The fork to delete
+     */
+    void delete_fork(ForkId fork_id);
+
+    /**
+     * @brief Commits the uncommitted state of a fork as the next block and deletes the fork. Only possible if nothing
+     * has been committed since the fork was created. Any uncommitted changes made to the canonical state are rolled
+     * back, as they no longer build on the latest committed state.
+     *
+     * @param fork_id The fork to commit
+     */
+    void commit_fork(ForkId fork_id);
+
+    /**
+     * @brief Applies all of the side effects of a block to the canonical state and commits them as the next block.
+     * Any uncommitted changes are discarded first. The trees are updated concurrently and committed in a single
+     * transaction.
+     *
+     * @return StateReference The committed state after applying the block
+     */
+    StateReference apply_block(fr block_hash,
+                               const std::vector<bb::fr>& notes,
+                               const std::vector<bb::fr>& l1_to_l2_messages,
+                               const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
+                               const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes);
+
     /**
      * @brief Synchronizes the world state with a new block.
      *
@@ -196,14 +301,36 @@ class WorldState {
 
   private:
     std::unique_ptr<crypto::merkle_tree::LMDBEnvironment> _lmdb_env;
-    std::unordered_map<MerkleTreeId, Tree> _trees;
+    uint64_t _historic_blocks_to_retain;
+    // The canonical fork owns the persisted stores so must outlive all other forks
+    Fork::SharedPtr _canonical_fork;
+    std::unordered_map<ForkId, Fork::SharedPtr> _forks;
+    ForkId _next_fork_id = CANONICAL_FORK_ID + 1;
+    uint64_t _commit_count = 0;
     bb::ThreadPool _workers;
     // Guards state reference access, flagged as mutable as used in otherwise const methods
     mutable std::mutex state_ref_mutex;
+    // Guards the set of forks
+    mutable std::mutex _forks_mutex;
+    // Serialises commits and fork creation so that a fork's state can't be committed on top of a newer state
+    std::mutex _commit_mutex;
 
     TreeStateReference get_tree_snapshot(MerkleTreeId id);
 
+    Fork::SharedPtr retrieve_fork(ForkId fork_id) const;
+    Fork::SharedPtr create_new_fork(ForkId fork_id);
+    void commit_trees(Fork& fork);
+    void rollback_trees(Fork& fork);
+    void apply_side_effects(Fork& fork,
+                            fr block_hash,
+                            const std::vector<bb::fr>& notes,
+                            const std::vector<bb::fr>& l1_to_l2_messages,
+                            const std::vector<crypto::merkle_tree::NullifierLeafValue>& nullifiers,
+                            const std::vector<std::vector<crypto::merkle_tree::PublicDataLeafValue>>& public_writes);
+    crypto::merkle_tree::LMDBWriteTransaction::Ptr create_write_transaction() const;
+
     static bool include_uncommitted(WorldStateRevision rev);
+    static std::optional<index_t> historic_block(WorldStateRevision rev);
     static bool block_state_matches_world_state(const StateReference& block_state_ref,
                                                 const StateReference& tree_state_ref);
 };
@@ -217,7 +344,8 @@ std::optional<crypto::merkle_tree::IndexedLeaf<T>> WorldState::get_indexed_leaf(
     using Store = CachedTreeStore<LMDBStore, T>;
     using Tree = IndexedTree<Store, HashPolicy>;
 
-    if (auto* const wrapper = std::get_if<TreeWithStore<Tree>>(&_trees.at(id))) {
+    Fork::SharedPtr fork = retrieve_fork(rev.forkId);
+    if (auto* const wrapper = std::get_if<TreeWithStore<Tree>>(&fork->_trees.at(id))) {
         std::optional<IndexedLeaf<T>> value;
         Signal signal;
         auto callback = [&](const TypedResponse<GetIndexedLeafResponse<T>>& response) {
@@ -228,7 +356,11 @@ std::optional<crypto::merkle_tree::IndexedLeaf<T>> WorldState::get_indexed_leaf(
             signal.signal_level(0);
         };
 
-        wrapper->tree->get_leaf(leaf, include_uncommitted(rev), callback);
+        if (auto block = historic_block(rev)) {
+            wrapper->tree->get_leaf_at_block(leaf, block.value(), callback);
+        } else {
+            wrapper->tree->get_leaf(leaf, include_uncommitted(rev), callback);
+        }
         signal.wait_for_level();
 
         return value;
@@ -243,28 +375,39 @@ std::optional<T> WorldState::get_leaf(const WorldStateRevision revision, MerkleT
     using namespace crypto::merkle_tree;
 
     bool uncommitted = include_uncommitted(revision);
+    std::optional<index_t> block = historic_block(revision);
+    Fork::SharedPtr fork = retrieve_fork(revision.forkId);
     std::optional<T> leaf;
     Signal signal;
     if constexpr (std::is_same_v<bb::fr, T>) {
-        const auto& wrapper = std::get<TreeWithStore<FrTree>>(_trees.at(tree_id));
-        wrapper.tree->get_leaf(leaf_index, uncommitted, [&signal, &leaf](const TypedResponse<GetLeafResponse>& resp) {
+        const auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(tree_id));
+        auto callback = [&signal, &leaf](const TypedResponse<GetLeafResponse>& resp) {
             if (resp.inner.leaf.has_value()) {
                 leaf = resp.inner.leaf.value();
             }
             signal.signal_level();
-        });
+        };
+        if (block.has_value()) {
+            wrapper.tree->get_leaf_at_block(leaf_index, block.value(), callback);
+        } else {
+            wrapper.tree->get_leaf(leaf_index, uncommitted, callback);
+        }
     } else {
         using Store = CachedTreeStore<LMDBStore, T>;
         using Tree = IndexedTree<Store, HashPolicy>;
 
-        auto& wrapper = std::get<TreeWithStore<Tree>>(_trees.at(tree_id));
-        wrapper.tree->get_leaf(
-            leaf_index, uncommitted, [&signal, &leaf](const TypedResponse<GetIndexedLeafResponse<T>>& resp) {
-                if (resp.inner.indexed_leaf.has_value()) {
-                    leaf = resp.inner.indexed_leaf.value().value;
-                }
-                signal.signal_level();
-            });
+        auto& wrapper = std::get<TreeWithStore<Tree>>(fork->_trees.at(tree_id));
+        auto callback = [&signal, &leaf](const TypedResponse<GetIndexedLeafResponse<T>>& resp) {
+            if (resp.inner.indexed_leaf.has_value()) {
+                leaf = resp.inner.indexed_leaf.value().value;
+            }
+            signal.signal_level();
+        };
+        if (block.has_value()) {
+            wrapper.tree->get_leaf_at_block(leaf_index, block.value(), callback);
+        } else {
+            wrapper.tree->get_leaf(leaf_index, uncommitted, callback);
+        }
     }
 
     signal.wait_for_level();
@@ -279,6 +422,7 @@ std::optional<index_t> WorldState::find_leaf_index(const WorldStateRevision rev,
 {
     using namespace crypto::merkle_tree;
     bool uncommitted = include_uncommitted(rev);
+    Fork::SharedPtr fork = retrieve_fork(rev.forkId);
     std::optional<index_t> index;
 
     Signal signal;
@@ -288,25 +432,71 @@ std::optional<index_t> WorldState::find_leaf_index(const WorldStateRevision rev,
         }
         signal.signal_level(0);
     };
+    std::optional<index_t> block = historic_block(rev);
+    auto find = [&](const auto& wrapper) {
+        if (block.has_value()) {
+            wrapper.tree->find_leaf_index_from_at_block(leaf, start_index, block.value(), callback);
+        } else {
+            wrapper.tree->find_leaf_index_from(leaf, start_index, uncommitted, callback);
+        }
+    };
     if constexpr (std::is_same_v<bb::fr, T>) {
-        const auto& wrapper = std::get<TreeWithStore<FrTree>>(_trees.at(id));
-        wrapper.tree->find_leaf_index_from(leaf, start_index, uncommitted, callback);
+        find(std::get<TreeWithStore<FrTree>>(fork->_trees.at(id)));
     } else {
         using Store = CachedTreeStore<LMDBStore, T>;
         using Tree = IndexedTree<Store, HashPolicy>;
 
-        auto& wrapper = std::get<TreeWithStore<Tree>>(_trees.at(id));
-        wrapper.tree->find_leaf_index_from(leaf, start_index, uncommitted, callback);
+        find(std::get<TreeWithStore<Tree>>(fork->_trees.at(id)));
     }
 
     signal.wait_for_level(0);
     return index;
 }
 
-template <typename T> void WorldState::append_leaves(MerkleTreeId id, const std::vector<T>& leaves)
+template <typename T>
+std::vector<std::optional<index_t>> WorldState::find_leaf_indices(const WorldStateRevision rev,
+                                                                  MerkleTreeId id,
+                                                                  const std::vector<T>& leaves) const
+{
+    using namespace crypto::merkle_tree;
+    bool uncommitted = include_uncommitted(rev);
+    Fork::SharedPtr fork = retrieve_fork(rev.forkId);
+    TypedResponse<FindLeafIndicesResponse> response;
+
+    Signal signal;
+    auto callback = [&](const TypedResponse<FindLeafIndicesResponse>& resp) {
+        response = resp;
+        signal.signal_level(0);
+    };
+    std::optional<index_t> block = historic_block(rev);
+    auto find = [&](const auto& wrapper) {
+        if (block.has_value()) {
+            wrapper.tree->find_leaf_indices_at_block(leaves, block.value(), callback);
+        } else {
+            wrapper.tree->find_leaf_indices(leaves, uncommitted, callback);
+        }
+    };
+    if constexpr (std::is_same_v<bb::fr, T>) {
+        find(std::get<TreeWithStore<FrTree>>(fork->_trees.at(id)));
+    } else {
+        using Store = CachedTreeStore<LMDBStore, T>;
+        using Tree = IndexedTree<Store, HashPolicy>;
+
+        find(std::get<TreeWithStore<Tree>>(fork->_trees.at(id)));
+    }
+
+    signal.wait_for_level(0);
+    if (!response.success) {
+        throw std::runtime_error(response.message);
+    }
+    return response.inner.leaf_indices;
+}
+
+template <typename T> void WorldState::append_leaves(MerkleTreeId id, const std::vector<T>& leaves, ForkId fork_id)
 {
     using namespace crypto::merkle_tree;
 
+    Fork::SharedPtr fork = retrieve_fork(fork_id);
     Signal signal;
 
     bool success = false;
@@ -316,12 +506,12 @@ template <typename T> void WorldState::append_leaves(MerkleTreeId id, const std:
     };
 
     if constexpr (std::is_same_v<bb::fr, T>) {
-        auto& wrapper = std::get<TreeWithStore<FrTree>>(_trees.at(id));
+        auto& wrapper = std::get<TreeWithStore<FrTree>>(fork->_trees.at(id));
         wrapper.tree->add_values(leaves, callback);
     } else {
         using Store = CachedTreeStore<LMDBStore, T>;
         using Tree = IndexedTree<Store, HashPolicy>;
-        auto& wrapper = std::get<TreeWithStore<Tree>>(_trees.at(id));
+        auto& wrapper = std::get<TreeWithStore<Tree>>(fork->_trees.at(id));
         wrapper.tree->add_or_update_values(leaves, 0, callback);
     }
 
@@ -335,7 +525,8 @@ template <typename T> void WorldState::append_leaves(MerkleTreeId id, const std:
 template <typename T>
 BatchInsertionResult<T> WorldState::batch_insert_indexed_leaves(MerkleTreeId id,
                                                                 const std::vector<T>& leaves,
-                                                                uint32_t subtree_depth)
+                                                                uint32_t subtree_depth,
+                                                                ForkId fork_id)
 {
     using namespace crypto::merkle_tree;
     using Store = CachedTreeStore<LMDBStore, T>;
@@ -343,7 +534,8 @@ BatchInsertionResult<T> WorldState::batch_insert_indexed_leaves(MerkleTreeId id,
 
     Signal signal;
     BatchInsertionResult<T> result;
-    const auto& wrapper = std::get<TreeWithStore<Tree>>(_trees.at(id));
+    Fork::SharedPtr fork = retrieve_fork(fork_id);
+    const auto& wrapper = std::get<TreeWithStore<Tree>>(fork->_trees.at(id));
     bool success = false;
     std::string error_msg;
 
@@ -4,7 +4,9 @@
 #include "barretenberg/ecc/curves/bn254/fr.hpp"
 #include "barretenberg/world_state/types.hpp"
 #include <filesystem>
+#include <map>
 #include <gtest/gtest.h>
+#include <thread>
 
 using namespace bb::world_state;
 using namespace bb::crypto::merkle_tree;
@@ -503,3 +505,366 @@ TEST_F(WorldStateTest, SyncCurrentBlock)
         EXPECT_EQ(state_ref.at(tree_id), snapshot);
     }
 }
+
+TEST_F(WorldStateTest, HistoricBlockQueries)
+{
+    WorldState ws(1, _directory, 1024);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+    auto nullifier_tree_id = MerkleTreeId::NULLIFIER_TREE;
+
+    ws.append_leaves<fr>(tree_id, { fr(42) });
+    ws.append_leaves<NullifierLeafValue>(nullifier_tree_id, { NullifierLeafValue(142) });
+    ws.commit();
+    auto block_1 = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+
+    ws.append_leaves<fr>(tree_id, { fr(43) });
+    ws.append_leaves<NullifierLeafValue>(nullifier_tree_id, { NullifierLeafValue(150) });
+    ws.commit();
+    auto block_2 = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+
+    // the genesis state is block 0
+    assert_tree_size(ws, WorldStateRevision::finalised_block(0), tree_id, 0);
+    assert_tree_size(ws, WorldStateRevision::finalised_block(0), nullifier_tree_id, 128);
+
+    // the state as of block 1 is unaffected by block 2
+    auto historic = ws.get_tree_info(WorldStateRevision::finalised_block(1), tree_id);
+    EXPECT_EQ(historic.size, block_1.size);
+    EXPECT_EQ(historic.root, block_1.root);
+    assert_leaf_value(ws, WorldStateRevision::finalised_block(1), tree_id, 0, fr(42));
+    assert_leaf_status<fr>(ws, WorldStateRevision::finalised_block(1), tree_id, 1, false);
+    assert_leaf_exists(ws, WorldStateRevision::finalised_block(1), tree_id, fr(43), false);
+    assert_sibling_path(ws, WorldStateRevision::finalised_block(1), tree_id, block_1.root, fr(42), 0);
+
+    assert_leaf_value(ws, WorldStateRevision::finalised_block(2), tree_id, 1, fr(43));
+    assert_leaf_index(ws, WorldStateRevision::finalised_block(2), tree_id, fr(43), 1);
+    assert_sibling_path(ws, WorldStateRevision::finalised_block(2), tree_id, block_2.root, fr(42), 0);
+    assert_sibling_path(ws, WorldStateRevision::finalised_block(2), tree_id, block_2.root, fr(43), 1);
+
+    // 150 was only inserted in block 2
+    EXPECT_EQ(ws.find_low_leaf_index(WorldStateRevision::finalised_block(1), nullifier_tree_id, 150),
+              std::make_pair(false, 128UL));
+    EXPECT_EQ(ws.find_low_leaf_index(WorldStateRevision::finalised_block(2), nullifier_tree_id, 150),
+              std::make_pair(true, 129UL));
+
+    // the low leaf of 150 was updated in block 2
+    auto low_leaf =
+        ws.get_indexed_leaf<NullifierLeafValue>(WorldStateRevision::finalised_block(1), nullifier_tree_id, 128);
+    EXPECT_EQ(low_leaf.value(), IndexedLeaf(NullifierLeafValue(142), 0, 0));
+    low_leaf = ws.get_indexed_leaf<NullifierLeafValue>(WorldStateRevision::finalised_block(2), nullifier_tree_id, 128);
+    EXPECT_EQ(low_leaf.value(), IndexedLeaf(NullifierLeafValue(142), 129, fr(150)));
+
+    // blocks in the future are not available
+    EXPECT_THROW(ws.get_tree_info(WorldStateRevision::finalised_block(3), tree_id), std::runtime_error);
+}
+
+TEST_F(WorldStateTest, BatchedQueriesMatchIndividualQueries)
+{
+    WorldState ws(4, _directory, 1024);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+    auto nullifier_tree_id = MerkleTreeId::NULLIFIER_TREE;
+
+    std::vector<fr> notes;
+    std::vector<NullifierLeafValue> nullifiers;
+    for (size_t i = 0; i < 100; ++i) {
+        notes.emplace_back(i + 1000);
+        nullifiers.emplace_back(i * 10 + 200);
+    }
+    ws.append_leaves<fr>(tree_id, notes);
+    ws.append_leaves<NullifierLeafValue>(nullifier_tree_id, nullifiers);
+    ws.commit();
+    ws.append_leaves<fr>(tree_id, { fr(42) });
+
+    std::vector<WorldStateRevision> revisions{ WorldStateRevision::uncommitted(),
+                                               WorldStateRevision::committed(),
+                                               WorldStateRevision::finalised_block(1) };
+    for (auto revision : revisions) {
+        std::vector<index_t> indices{ 99, 0, 5, 4, 5, 100, 64 };
+        auto paths = ws.get_sibling_paths(revision, tree_id, indices);
+        EXPECT_EQ(paths.size(), indices.size());
+        for (size_t i = 0; i < indices.size(); ++i) {
+            EXPECT_EQ(paths[i], ws.get_sibling_path(revision, tree_id, indices[i]));
+        }
+
+        std::vector<fr> leaves{ fr(1050), fr(42), fr(1000) };
+        auto leaf_indices = ws.find_leaf_indices<fr>(revision, tree_id, leaves);
+        EXPECT_EQ(leaf_indices.size(), leaves.size());
+        for (size_t i = 0; i < leaves.size(); ++i) {
+            EXPECT_EQ(leaf_indices[i], ws.find_leaf_index<fr>(revision, tree_id, leaves[i]));
+        }
+
+        std::vector<fr> keys{ fr(205), fr(200), fr(5), fr(5000) };
+        auto low_leaves = ws.find_low_leaf_indices(revision, nullifier_tree_id, keys);
+        EXPECT_EQ(low_leaves.size(), keys.size());
+        for (size_t i = 0; i < keys.size(); ++i) {
+            EXPECT_EQ(low_leaves[i], ws.find_low_leaf_index(revision, nullifier_tree_id, keys[i]));
+        }
+    }
+
+    EXPECT_THROW(ws.get_sibling_paths(WorldStateRevision::finalised_block(2), tree_id, { 0 }), std::runtime_error);
+}
+
+TEST_F(WorldStateTest, HistoricLowLeavesAfterManyLaterInsertions)
+{
+    WorldState ws(1, _directory, 1024);
+    auto tree_id = MerkleTreeId::NULLIFIER_TREE;
+    // All of the keys queried below the inserted keys have the same low leaf in every block
+    auto initial_low_leaf = ws.find_low_leaf_index(WorldStateRevision::finalised_block(0), tree_id, 999);
+
+    // Each block inserts keys above those of the previous blocks, so the low leaves of the greater keys as of the
+    // earlier blocks are found at the end of long chains of low leaf links
+    const uint64_t num_blocks = 16;
+    const uint64_t keys_per_block = 8;
+    std::vector<std::map<uint64_t, index_t>> inserted(num_blocks + 1);
+    for (uint64_t block = 1; block <= num_blocks; block++) {
+        std::vector<NullifierLeafValue> nullifiers;
+        for (uint64_t i = 0; i < keys_per_block; i++) {
+            nullifiers.emplace_back(1000 + block * 100 + i * 10);
+        }
+        ws.append_leaves<NullifierLeafValue>(tree_id, nullifiers);
+        ws.commit();
+        inserted[block] = inserted[block - 1];
+        for (const auto& nullifier : nullifiers) {
+            auto index = ws.find_leaf_index<NullifierLeafValue>(WorldStateRevision::committed(), tree_id, nullifier);
+            inserted[block][static_cast<uint64_t>(nullifier.value)] = index.value();
+        }
+    }
+
+    for (uint32_t block = 0; block <= num_blocks; block++) {
+        for (uint64_t key = 995; key < 1100 + num_blocks * 100; key += 5) {
+            // The low leaf is the greatest key inserted as of the block that is no greater than the key queried
+            auto it = inserted[block].upper_bound(key);
+            auto expected = initial_low_leaf;
+            if (it != inserted[block].begin()) {
+                --it;
+                expected = std::make_pair(it->first == key, it->second);
+            }
+            EXPECT_EQ(ws.find_low_leaf_index(WorldStateRevision::finalised_block(block), tree_id, key), expected);
+        }
+    }
+}
+
+TEST_F(WorldStateTest, HistoricBlocksArePruned)
+{
+    WorldState ws(1, _directory, 1024, 2);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+
+    std::vector<TreeMetaResponse> blocks;
+    for (uint64_t i = 1; i <= 3; i++) {
+        ws.append_leaves<fr>(tree_id, { fr(i) });
+        ws.commit();
+        blocks.push_back(ws.get_tree_info(WorldStateRevision::committed(), tree_id));
+    }
+
+    // only the last 2 blocks are retained
+    EXPECT_THROW(ws.get_tree_info(WorldStateRevision::finalised_block(1), tree_id), std::runtime_error);
+    EXPECT_THROW(ws.get_sibling_path(WorldStateRevision::finalised_block(1), tree_id, 0), std::runtime_error);
+
+    // pruning must not remove the versions still visible to the retained blocks
+    for (uint32_t block = 2; block <= 3; block++) {
+        const auto& expected = blocks[block - 1];
+        auto info = ws.get_tree_info(WorldStateRevision::finalised_block(block), tree_id);
+        EXPECT_EQ(info.size, expected.size);
+        EXPECT_EQ(info.root, expected.root);
+        for (uint64_t i = 0; i < block; i++) {
+            assert_sibling_path(
+                ws, WorldStateRevision::finalised_block(block), tree_id, expected.root, fr(i + 1), i);
+        }
+    }
+}
+
+TEST_F(WorldStateTest, ForksAreIndependent)
+{
+    WorldState ws(1, _directory, 1024);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+
+    ForkId fork_1 = ws.create_fork();
+    ForkId fork_2 = ws.create_fork();
+
+    ws.append_leaves<fr>(tree_id, { fr(42) }, fork_1);
+    ws.append_leaves<fr>(tree_id, { fr(43), fr(44) }, fork_2);
+
+    // each fork only sees its own uncommitted changes
+    assert_tree_size(ws, WorldStateRevision::uncommitted(fork_1), tree_id, 1);
+    assert_leaf_value(ws, WorldStateRevision::uncommitted(fork_1), tree_id, 0, fr(42));
+    assert_tree_size(ws, WorldStateRevision::uncommitted(fork_2), tree_id, 2);
+    assert_leaf_value(ws, WorldStateRevision::uncommitted(fork_2), tree_id, 0, fr(43));
+    assert_tree_size(ws, WorldStateRevision::uncommitted(), tree_id, 0);
+    assert_tree_size(ws, WorldStateRevision::committed(), tree_id, 0);
+
+    auto fork_state_ref = ws.get_state_reference(WorldStateRevision::uncommitted(fork_1));
+    ws.commit_fork(fork_1);
+
+    // the committed state is now that of the committed fork
+    auto state_ref = ws.get_state_reference(WorldStateRevision::committed());
+    for (const auto& [id, snapshot] : fork_state_ref) {
+        EXPECT_EQ(state_ref.at(id), snapshot);
+    }
+    assert_leaf_value(ws, WorldStateRevision::finalised_block(1), tree_id, 0, fr(42));
+    EXPECT_THROW(ws.get_tree_info(WorldStateRevision::uncommitted(fork_1), tree_id), std::runtime_error);
+
+    // the other fork is no longer based on the latest committed state
+    EXPECT_THROW(ws.commit_fork(fork_2), std::runtime_error);
+    assert_tree_size(ws, WorldStateRevision::committed(), tree_id, 1);
+
+    ws.delete_fork(fork_2);
+    EXPECT_THROW(ws.delete_fork(fork_2), std::runtime_error);
+    EXPECT_THROW(ws.delete_fork(CANONICAL_FORK_ID), std::runtime_error);
+}
+
+TEST_F(WorldStateTest, ForksAreUnaffectedByLaterCommits)
+{
+    WorldState ws(1, _directory, 1024);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+
+    ws.append_leaves<fr>(tree_id, { fr(42) });
+    ws.commit();
+    ForkId fork = ws.create_fork();
+    auto fork_info = ws.get_tree_info(WorldStateRevision::committed(fork), tree_id);
+
+    ws.append_leaves<fr>(tree_id, { fr(43) });
+    ws.commit();
+    assert_tree_size(ws, WorldStateRevision::committed(), tree_id, 2);
+
+    // the fork still reads the committed state as of its creation
+    auto info = ws.get_tree_info(WorldStateRevision::committed(fork), tree_id);
+    EXPECT_EQ(info.size, 1);
+    EXPECT_EQ(info.root, fork_info.root);
+    assert_leaf_status<fr>(ws, WorldStateRevision::committed(fork), tree_id, 1, false);
+    assert_leaf_exists(ws, WorldStateRevision::committed(fork), tree_id, fr(43), false);
+    assert_sibling_path(ws, WorldStateRevision::committed(fork), tree_id, fork_info.root, fr(42), 0);
+
+    // and its uncommitted state builds on that snapshot
+    ws.append_leaves<fr>(tree_id, { fr(44) }, fork);
+    assert_tree_size(ws, WorldStateRevision::uncommitted(fork), tree_id, 2);
+    assert_leaf_value(ws, WorldStateRevision::uncommitted(fork), tree_id, 1, fr(44));
+    assert_leaf_exists(ws, WorldStateRevision::uncommitted(fork), tree_id, fr(43), false);
+
+    EXPECT_THROW(ws.commit_fork(fork), std::runtime_error);
+    ws.delete_fork(fork);
+}
+
+TEST_F(WorldStateTest, ForksCanBeModifiedConcurrently)
+{
+    WorldState ws(4, _directory, 1024);
+    auto tree_id = MerkleTreeId::NULLIFIER_TREE;
+
+    std::vector<ForkId> forks;
+    for (uint64_t i = 0; i < 4; i++) {
+        forks.push_back(ws.create_fork());
+    }
+
+    std::vector<std::thread> threads;
+    for (uint64_t i = 0; i < forks.size(); i++) {
+        threads.emplace_back([&ws, &forks, tree_id, i]() {
+            for (uint64_t j = 0; j < 10; j++) {
+                ws.append_leaves<NullifierLeafValue>(tree_id, { NullifierLeafValue(1000 * (i + 1) + j) }, forks[i]);
+            }
+        });
+    }
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (uint64_t i = 0; i < forks.size(); i++) {
+        auto revision = WorldStateRevision::uncommitted(forks[i]);
+        assert_tree_size(ws, revision, tree_id, 138);
+        for (uint64_t k = 0; k < forks.size(); k++) {
+            assert_leaf_exists(ws, revision, tree_id, NullifierLeafValue(1000 * (k + 1)), i == k);
+        }
+    }
+    assert_tree_size(ws, WorldStateRevision::uncommitted(), tree_id, 128);
+
+    ws.commit_fork(forks[2]);
+    assert_tree_size(ws, WorldStateRevision::committed(), tree_id, 138);
+    assert_leaf_index(ws, WorldStateRevision::committed(), tree_id, NullifierLeafValue(3000), 128);
+}
+
+TEST_F(WorldStateTest, CommittedNodesAreCachedUntilNextCommit)
+{
+    WorldState ws(1, _directory, 1024);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+
+    ws.append_leaves<fr>(tree_id, { fr(42) });
+    ws.commit();
+    auto first = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+    assert_sibling_path(ws, WorldStateRevision::committed(), tree_id, first.root, fr(42), 0);
+
+    // the upper levels of the path are now served from the cache
+    auto before = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+    assert_sibling_path(ws, WorldStateRevision::committed(), tree_id, first.root, fr(42), 0);
+    auto after = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+    EXPECT_GT(after.nodeCacheHits, before.nodeCacheHits);
+    EXPECT_EQ(after.nodeCacheMisses, before.nodeCacheMisses);
+
+    // a commit invalidates the cached nodes
+    ws.append_leaves<fr>(tree_id, { fr(43) });
+    ws.commit();
+    auto second = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+    EXPECT_NE(second.root, first.root);
+    assert_sibling_path(ws, WorldStateRevision::committed(), tree_id, second.root, fr(42), 0);
+    assert_sibling_path(ws, WorldStateRevision::committed(), tree_id, second.root, fr(43), 1);
+    EXPECT_GT(ws.get_tree_info(WorldStateRevision::committed(), tree_id).nodeCacheMisses, after.nodeCacheMisses);
+}
+
+TEST_F(WorldStateTest, ForksShareTheCommittedNodeCache)
+{
+    WorldState ws(1, _directory, 1024);
+    auto tree_id = MerkleTreeId::NOTE_HASH_TREE;
+
+    ws.append_leaves<fr>(tree_id, { fr(42) });
+    ws.commit();
+    auto info = ws.get_tree_info(WorldStateRevision::committed(), tree_id);
+    assert_sibling_path(ws, WorldStateRevision::committed(), tree_id, info.root, fr(42), 0);
+
+    // a fork of the same committed state is served from the nodes cached by the canonical tree
+    ForkId fork = ws.create_fork();
+    auto before = ws.get_tree_info(WorldStateRevision::committed(fork), tree_id);
+    assert_sibling_path(ws, WorldStateRevision::committed(fork), tree_id, info.root, fr(42), 0);
+    auto after = ws.get_tree_info(WorldStateRevision::committed(fork), tree_id);
+    EXPECT_GT(after.nodeCacheHits, before.nodeCacheHits);
+    EXPECT_EQ(after.nodeCacheMisses, before.nodeCacheMisses);
+    ws.delete_fork(fork);
+}
+
+TEST_F(WorldStateTest, ApplyBlock)
+{
+    WorldState ws(1, _directory, 1024);
+    StateReference block_state_ref = {
+        { MerkleTreeId::NULLIFIER_TREE,
+          { fr("0x0342578609a7358092788d0eed7d1ee0ec8e0c596c0b1e85ba980ddd5cc79d04"), 129 } },
+        { MerkleTreeId::NOTE_HASH_TREE,
+          { fr("0x15dad063953d8d216c1db77739d6fb27e1b73a5beef748a1208898b3428781eb"), 1 } },
+        { MerkleTreeId::PUBLIC_DATA_TREE,
+          { fr("0x0278dcf9ff541da255ee722aecfad849b66af0d42c2924d949b5a509f2e1aec9"), 129 } },
+        { MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+          { fr("0x20ea8ca97f96508aaed2d6cdc4198a41c77c640bfa8785a51bb905b9a672ba0b"), 1 } },
+    };
+
+    // uncommitted changes are discarded
+    ws.append_leaves<fr>(MerkleTreeId::NOTE_HASH_TREE, { fr(1000) });
+
+    auto state_ref =
+        ws.apply_block(fr(1), { 42 }, { 43 }, { NullifierLeafValue(144) }, { { PublicDataLeafValue(145, 1) } });
+    for (const auto& [tree_id, snapshot] : block_state_ref) {
+        EXPECT_EQ(state_ref.at(tree_id), snapshot);
+    }
+    EXPECT_EQ(state_ref, ws.get_state_reference(WorldStateRevision::committed()));
+    EXPECT_EQ(state_ref, ws.get_state_reference(WorldStateRevision::uncommitted()));
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::NOTE_HASH_TREE, 0, fr(42));
+    assert_leaf_value(ws, WorldStateRevision::committed(), MerkleTreeId::ARCHIVE, 0, fr(1));
+
+    // all trees are committed as the same block
+    for (auto tree_id : { MerkleTreeId::NULLIFIER_TREE,
+                          MerkleTreeId::NOTE_HASH_TREE,
+                          MerkleTreeId::PUBLIC_DATA_TREE,
+                          MerkleTreeId::L1_TO_L2_MESSAGE_TREE,
+                          MerkleTreeId::ARCHIVE }) {
+        auto info = ws.get_tree_info(WorldStateRevision::finalised_block(1), tree_id);
+        EXPECT_EQ(info.root, state_ref.at(tree_id).first);
+    }
+
+    // a failed block leaves the committed state untouched
+    EXPECT_THROW(ws.apply_block(fr(2), {}, {}, { NullifierLeafValue(144) }, {}), std::runtime_error);
+    EXPECT_EQ(state_ref, ws.get_state_reference(WorldStateRevision::committed()));
+    EXPECT_EQ(state_ref, ws.get_state_reference(WorldStateRevision::uncommitted()));
+}
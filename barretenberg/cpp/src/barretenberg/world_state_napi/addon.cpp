@@ -37,7 +37,16 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
     }
 
     std::string data_dir = info[0].As<Napi::String>();
-    _ws = std::make_unique<WorldState>(16, data_dir, 1024 * 1024); // 1 GiB
+
+    uint64_t historic_blocks_to_retain = DEFAULT_HISTORIC_BLOCKS_TO_RETAIN;
+    if (info.Length() > 1) {
+        if (!info[1].IsNumber()) {
+            throw Napi::TypeError::New(env, "Number of historic blocks to retain needs to be a number");
+        }
+        historic_blocks_to_retain = static_cast<uint64_t>(info[1].As<Napi::Number>().Int64Value());
+    }
+
+    _ws = std::make_unique<WorldState>(16, data_dir, 1024 * 1024, historic_blocks_to_retain); // 1 GiB
 
     _dispatcher.registerTarget(
         WorldStateMessageType::GET_TREE_INFO,
@@ -59,6 +68,10 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
         WorldStateMessageType::GET_SIBLING_PATH,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_path(obj, buffer); });
 
+    _dispatcher.registerTarget(
+        WorldStateMessageType::GET_SIBLING_PATHS,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return get_sibling_paths(obj, buffer); });
+
     _dispatcher.registerTarget(
         WorldStateMessageType::FIND_LEAF_INDEX,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_leaf_index(obj, buffer); });
@@ -67,6 +80,14 @@ WorldStateAddon::WorldStateAddon(const Napi::CallbackInfo& info)
         WorldStateMessageType::FIND_LOW_LEAF,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_low_leaf(obj, buffer); });
 
+    _dispatcher.registerTarget(
+        WorldStateMessageType::FIND_LEAF_INDICES,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_leaf_indices(obj, buffer); });
+
+    _dispatcher.registerTarget(
+        WorldStateMessageType::FIND_LOW_LEAVES,
+        [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return find_low_leaves(obj, buffer); });
+
     _dispatcher.registerTarget(
         WorldStateMessageType::APPEND_LEAVES,
         [this](msgpack::object& obj, msgpack::sbuffer& buffer) { return append_leaves(obj, buffer); });
@@ -132,7 +153,9 @@ bool WorldStateAddon::get_tree_info(msgpack::object& obj, msgpack::sbuffer& buff
 
     MsgHeader header(request.header.messageId);
     messaging::TypedMessage<GetTreeInfoResponse> resp_msg(
-        WorldStateMessageType::GET_TREE_INFO, header, { request.value.treeId, info.root, info.size, info.depth });
+        WorldStateMessageType::GET_TREE_INFO,
+        header,
+        { request.value.treeId, info.root, info.size, info.depth, info.nodeCacheHits, info.nodeCacheMisses });
 
     msgpack::pack(buffer, resp_msg);
 
@@ -249,6 +272,23 @@ bool WorldStateAddon::get_sibling_path(msgpack::object& obj, msgpack::sbuffer& b
     return true;
 }
 
+bool WorldStateAddon::get_sibling_paths(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<GetSiblingPathsRequest> request;
+    obj.convert(request);
+
+    std::vector<fr_sibling_path> paths = _ws->get_sibling_paths(
+        revision_from_input(request.value.revision), request.value.treeId, request.value.leafIndices);
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<fr_sibling_path>> resp_msg(
+        WorldStateMessageType::GET_SIBLING_PATHS, header, paths);
+
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
 bool WorldStateAddon::find_leaf_index(msgpack::object& obj, msgpack::sbuffer& buffer) const
 {
     TypedMessage<TreeIdAndRevisionRequest> request;
@@ -305,6 +345,68 @@ bool WorldStateAddon::find_low_leaf(msgpack::object& obj, msgpack::sbuffer& buff
     return true;
 }
 
+bool WorldStateAddon::find_leaf_indices(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<TreeIdAndRevisionRequest> request;
+    obj.convert(request);
+
+    std::vector<std::optional<index_t>> indices;
+    switch (request.value.treeId) {
+    case MerkleTreeId::NOTE_HASH_TREE:
+    case MerkleTreeId::L1_TO_L2_MESSAGE_TREE:
+    case MerkleTreeId::ARCHIVE: {
+        TypedMessage<FindLeafIndicesRequest<bb::fr>> r1;
+        obj.convert(r1);
+        indices = _ws->find_leaf_indices<bb::fr>(
+            revision_from_input(request.value.revision), request.value.treeId, r1.value.leaves);
+        break;
+    }
+
+    case MerkleTreeId::PUBLIC_DATA_TREE: {
+        TypedMessage<FindLeafIndicesRequest<crypto::merkle_tree::PublicDataLeafValue>> r2;
+        obj.convert(r2);
+        indices = _ws->find_leaf_indices<PublicDataLeafValue>(
+            revision_from_input(request.value.revision), request.value.treeId, r2.value.leaves);
+        break;
+    }
+    case MerkleTreeId::NULLIFIER_TREE: {
+        TypedMessage<FindLeafIndicesRequest<crypto::merkle_tree::NullifierLeafValue>> r3;
+        obj.convert(r3);
+        indices = _ws->find_leaf_indices<NullifierLeafValue>(
+            revision_from_input(request.value.revision), request.value.treeId, r3.value.leaves);
+        break;
+    }
+    }
+
+    MsgHeader header(request.header.messageId);
+    messaging::TypedMessage<std::vector<std::optional<index_t>>> resp_msg(
+        WorldStateMessageType::FIND_LEAF_INDICES, header, indices);
+    msgpack::pack(buffer, resp_msg);
+
+    return true;
+}
+
+bool WorldStateAddon::find_low_leaves(msgpack::object& obj, msgpack::sbuffer& buffer) const
+{
+    TypedMessage<FindLowLeavesRequest> request;
+    obj.convert(request);
+
+    std::vector<std::pair<bool, index_t>> low_leaves = _ws->find_low_leaf_indices(
+        revision_from_input(request.value.revision), request.value.treeId, request.value.keys);
+
+    std::vector<FindLowLeafResponse> results;
+    results.reserve(low_leaves.size());
+    for (const auto& [already_present, index] : low_leaves) {
+        results.push_back({ already_present, index });
+    }
+
+    MsgHeader header(request.header.messageId);
+    TypedMessage<std::vector<FindLowLeafResponse>> response(WorldStateMessageType::FIND_LOW_LEAVES, header, results);
+    msgpack::pack(buffer, response);
+
+    return true;
+}
+
 bool WorldStateAddon::append_leaves(msgpack::object& obj, msgpack::sbuffer& buf)
 {
     TypedMessage<TreeIdOnlyRequest> request;
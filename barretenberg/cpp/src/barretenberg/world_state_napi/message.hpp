@@ -7,6 +7,7 @@
 #include "barretenberg/world_state/world_state.hpp"
 #include <cstdint>
 #include <string>
+#include <vector>
 
 namespace bb::world_state {
 
@@ -31,7 +32,11 @@ enum WorldStateMessageType {
     COMMIT,
     ROLLBACK,
 
-    SYNC_BLOCK
+    SYNC_BLOCK,
+
+    GET_SIBLING_PATHS,
+    FIND_LEAF_INDICES,
+    FIND_LOW_LEAVES
 };
 
 struct TreeIdOnlyRequest {
@@ -64,7 +69,9 @@ struct GetTreeInfoResponse {
     fr root;
     index_t size;
     uint32_t depth;
-    MSGPACK_FIELDS(treeId, root, size, depth);
+    uint64_t nodeCacheHits;
+    uint64_t nodeCacheMisses;
+    MSGPACK_FIELDS(treeId, root, size, depth, nodeCacheHits, nodeCacheMisses);
 };
 
 struct GetStateReferenceRequest {
@@ -98,6 +105,13 @@ struct GetSiblingPathRequest {
     MSGPACK_FIELDS(treeId, revision, leafIndex);
 };
 
+struct GetSiblingPathsRequest {
+    MerkleTreeId treeId;
+    int revision;
+    std::vector<index_t> leafIndices;
+    MSGPACK_FIELDS(treeId, revision, leafIndices);
+};
+
 template <typename T> struct FindLeafIndexRequest {
     MerkleTreeId treeId;
     int revision;
@@ -105,6 +119,13 @@ template <typename T> struct FindLeafIndexRequest {
     MSGPACK_FIELDS(treeId, revision, leaf);
 };
 
+template <typename T> struct FindLeafIndicesRequest {
+    MerkleTreeId treeId;
+    int revision;
+    std::vector<T> leaves;
+    MSGPACK_FIELDS(treeId, revision, leaves);
+};
+
 struct FindLowLeafRequest {
     MerkleTreeId treeId;
     int revision;
@@ -118,6 +139,13 @@ struct FindLowLeafResponse {
     MSGPACK_FIELDS(alreadyPresent, index);
 };
 
+struct FindLowLeavesRequest {
+    MerkleTreeId treeId;
+    int revision;
+    std::vector<fr> keys;
+    MSGPACK_FIELDS(treeId, revision, keys);
+};
+
 template <typename T> struct AppendLeavesRequest {
     MerkleTreeId treeId;
     std::vector<T> leaves;
@@ -66,6 +66,10 @@ export enum WorldStateMessageType {
   ROLLBACK,
 
   SYNC_BLOCK,
+
+  GET_SIBLING_PATHS,
+  FIND_LEAF_INDICES,
+  FIND_LOW_LEAVES,
 }
 
 interface WithTreeId {
@@ -105,11 +109,18 @@ interface GetTreeInfoResponse {
   depth: UInt32;
   size: bigint | number;
   root: Buffer;
+  nodeCacheHits: bigint | number;
+  nodeCacheMisses: bigint | number;
 }
 
 interface GetSiblingPathRequest extends WithTreeId, WithLeafIndex, WithWorldStateRevision {}
 type GetSiblingPathResponse = Buffer[];
 
+interface GetSiblingPathsRequest extends WithTreeId, WithWorldStateRevision {
+  leafIndices: bigint[];
+}
+type GetSiblingPathsResponse = Buffer[][];
+
 interface GetStateReferenceRequest extends WithWorldStateRevision {}
 interface GetStateReferenceResponse {
   state: Record<MerkleTreeId, TreeStateReference>;
@@ -126,6 +137,9 @@ interface FindLeafIndexRequest extends WithTreeId, WithLeafValue, WithWorldState
 }
 type FindLeafIndexResponse = bigint | null;
 
+interface FindLeafIndicesRequest extends WithTreeId, WithLeaves, WithWorldStateRevision {}
+type FindLeafIndicesResponse = (bigint | number | null)[];
+
 interface FindLowLeafRequest extends WithTreeId, WithWorldStateRevision {
   key: Fr;
 }
@@ -134,6 +148,11 @@ interface FindLowLeafResponse {
   alreadyPresent: boolean;
 }
 
+interface FindLowLeavesRequest extends WithTreeId, WithWorldStateRevision {
+  keys: Fr[];
+}
+type FindLowLeavesResponse = FindLowLeafResponse[];
+
 interface AppendLeavesRequest extends WithTreeId, WithLeaves {}
 
 interface BatchInsertRequest extends WithTreeId, WithLeaves {
@@ -187,6 +206,10 @@ export type WorldStateRequest = {
   [WorldStateMessageType.ROLLBACK]: void;
 
   [WorldStateMessageType.SYNC_BLOCK]: SyncBlockRequest;
+
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsRequest;
+  [WorldStateMessageType.FIND_LEAF_INDICES]: FindLeafIndicesRequest;
+  [WorldStateMessageType.FIND_LOW_LEAVES]: FindLowLeavesRequest;
 };
 
 export type WorldStateResponse = {
@@ -209,6 +232,10 @@ export type WorldStateResponse = {
   [WorldStateMessageType.ROLLBACK]: void;
 
   [WorldStateMessageType.SYNC_BLOCK]: SyncBlockResponse;
+
+  [WorldStateMessageType.GET_SIBLING_PATHS]: GetSiblingPathsResponse;
+  [WorldStateMessageType.FIND_LEAF_INDICES]: FindLeafIndicesResponse;
+  [WorldStateMessageType.FIND_LOW_LEAVES]: FindLowLeavesResponse;
 };
 
 export type WorldStateRevision = -1 | 0 | UInt32;